@@ -0,0 +1,99 @@
+# This file will be configured to contain variables for CPack. These variables
+# should be set in the CMake list file of the project before CPack module is
+# included. The list of available CPACK_xxx variables and their associated
+# documentation may be obtained using
+#  cpack --help-variable-list
+#
+# Some variables are common to all generators (e.g. CPACK_PACKAGE_NAME)
+# and some are specific to a generator
+# (e.g. CPACK_NSIS_EXTRA_INSTALL_COMMANDS). The generator specific variables
+# usually begin with CPACK_<GENNAME>_xxxx.
+
+
+set(CPACK_ALL_INSTALL_TYPES "Standard;Developer")
+set(CPACK_ARCHIVE_COMPONENT_INSTALL "ON")
+set(CPACK_BUILD_SOURCE_DIRS "/root/repo;/root/repo/_dbg_build")
+set(CPACK_CMAKE_GENERATOR "Unix Makefiles")
+set(CPACK_COMPONENTS_ALL "doc;config;header;program;shared;static")
+set(CPACK_COMPONENTS_ALL_SET_BY_USER "TRUE")
+set(CPACK_COMPONENTS_GROUPING "ALL_COMPONENTS_IN_ONE")
+set(CPACK_COMPONENT_CONFIG_DISPLAY_NAME "Configuration")
+set(CPACK_COMPONENT_CONFIG_GROUP "Runtime")
+set(CPACK_COMPONENT_CONFIG_INSTALL_TYPES "Standard;Developer")
+set(CPACK_COMPONENT_DOC_DISPLAY_NAME "Documentation")
+set(CPACK_COMPONENT_DOC_GROUP "Development")
+set(CPACK_COMPONENT_DOC_INSTALL_TYPES "Standard;Developer")
+set(CPACK_COMPONENT_HEADER_DEPENDS "static")
+set(CPACK_COMPONENT_HEADER_DISPLAY_NAME "C++ Headers")
+set(CPACK_COMPONENT_HEADER_GROUP "Development")
+set(CPACK_COMPONENT_HEADER_INSTALL_TYPES "Developer")
+set(CPACK_COMPONENT_PROGRAM_DISPLAY_NAME "Programs")
+set(CPACK_COMPONENT_PROGRAM_GROUP "Runtime")
+set(CPACK_COMPONENT_PROGRAM_INSTALL_TYPES "Standard;Developer")
+set(CPACK_COMPONENT_SHARED_DISPLAY_NAME "Shared Libs")
+set(CPACK_COMPONENT_SHARED_GROUP "Runtime")
+set(CPACK_COMPONENT_SHARED_INSTALL_TYPES "Standard;Developer")
+set(CPACK_COMPONENT_STATIC_DEPENDS "header")
+set(CPACK_COMPONENT_STATIC_DISPLAY_NAME "Static Libs")
+set(CPACK_COMPONENT_STATIC_GROUP "Development")
+set(CPACK_COMPONENT_STATIC_INSTALL_TYPES "Developer")
+set(CPACK_COMPONENT_UNSPECIFIED_HIDDEN "TRUE")
+set(CPACK_COMPONENT_UNSPECIFIED_REQUIRED "TRUE")
+set(CPACK_DEFAULT_PACKAGE_DESCRIPTION_FILE "/usr/share/cmake-3.25/Templates/CPack.GenericDescription.txt")
+set(CPACK_DEFAULT_PACKAGE_DESCRIPTION_SUMMARY "toolbox-cpp built using CMake")
+set(CPACK_GENERATOR "TGZ;RPM;DEB")
+set(CPACK_INSTALL_CMAKE_PROJECTS "/root/repo/_dbg_build;toolbox-cpp;ALL;/")
+set(CPACK_INSTALL_PREFIX "/usr/local")
+set(CPACK_MODULE_PATH ";/root/repo/etc/cmake")
+set(CPACK_NSIS_DISPLAY_NAME "toolbox-cpp snapshot")
+set(CPACK_NSIS_INSTALLER_ICON_CODE "")
+set(CPACK_NSIS_INSTALLER_MUI_ICON_CODE "")
+set(CPACK_NSIS_INSTALL_ROOT "$PROGRAMFILES")
+set(CPACK_NSIS_PACKAGE_NAME "toolbox-cpp snapshot")
+set(CPACK_NSIS_UNINSTALL_NAME "Uninstall")
+set(CPACK_OBJCOPY_EXECUTABLE "/usr/bin/objcopy")
+set(CPACK_OBJDUMP_EXECUTABLE "/usr/bin/objdump")
+set(CPACK_OUTPUT_CONFIG_FILE "/root/repo/_dbg_build/CPackConfig.cmake")
+set(CPACK_OUTPUT_FILE_PREFIX "dist")
+set(CPACK_PACKAGE_CONTACT "development@reactivemarkets.com")
+set(CPACK_PACKAGE_DEFAULT_LOCATION "/")
+set(CPACK_PACKAGE_DESCRIPTION_FILE "/usr/share/cmake-3.25/Templates/CPack.GenericDescription.txt")
+set(CPACK_PACKAGE_DESCRIPTION_SUMMARY "Toolbox - The Reactive C++ Toolbox")
+set(CPACK_PACKAGE_FILE_NAME "toolbox-cpp-snapshot-x86_64")
+set(CPACK_PACKAGE_HOMEPAGE_URL "https://github.com/reactivemarkets/toolbox-cpp")
+set(CPACK_PACKAGE_INSTALL_DIRECTORY "toolbox-cpp snapshot")
+set(CPACK_PACKAGE_INSTALL_REGISTRY_KEY "toolbox-cpp snapshot")
+set(CPACK_PACKAGE_NAME "toolbox-cpp")
+set(CPACK_PACKAGE_RELOCATABLE "true")
+set(CPACK_PACKAGE_VENDOR "Reactive Markets Limited")
+set(CPACK_PACKAGE_VERSION "snapshot")
+set(CPACK_PACKAGE_VERSION_MAJOR "0")
+set(CPACK_PACKAGE_VERSION_MINOR "1")
+set(CPACK_PACKAGE_VERSION_PATCH "1")
+set(CPACK_PACKAGING_INSTALL_PREFIX "/usr/local")
+set(CPACK_PROJECT_CONFIG_FILE "/root/repo/CPackProjectConfig.cmake")
+set(CPACK_READELF_EXECUTABLE "/usr/bin/readelf")
+set(CPACK_RESOURCE_FILE_LICENSE "/usr/share/cmake-3.25/Templates/CPack.GenericLicense.txt")
+set(CPACK_RESOURCE_FILE_README "/usr/share/cmake-3.25/Templates/CPack.GenericDescription.txt")
+set(CPACK_RESOURCE_FILE_WELCOME "/usr/share/cmake-3.25/Templates/CPack.GenericWelcome.txt")
+set(CPACK_SET_DESTDIR "OFF")
+set(CPACK_SOURCE_GENERATOR "TBZ2;TGZ;TXZ;TZ")
+set(CPACK_SOURCE_OUTPUT_CONFIG_FILE "/root/repo/_dbg_build/CPackSourceConfig.cmake")
+set(CPACK_SOURCE_RPM "OFF")
+set(CPACK_SOURCE_TBZ2 "ON")
+set(CPACK_SOURCE_TGZ "ON")
+set(CPACK_SOURCE_TXZ "ON")
+set(CPACK_SOURCE_TZ "ON")
+set(CPACK_SOURCE_ZIP "OFF")
+set(CPACK_SYSTEM_NAME "x86_64")
+set(CPACK_THREADS "1")
+set(CPACK_TOPLEVEL_TAG "x86_64")
+set(CPACK_WIX_SIZEOF_VOID_P "8")
+
+if(NOT CPACK_PROPERTIES_FILE)
+  set(CPACK_PROPERTIES_FILE "/root/repo/_dbg_build/CPackProperties.cmake")
+endif()
+
+if(EXISTS ${CPACK_PROPERTIES_FILE})
+  include(${CPACK_PROPERTIES_FILE})
+endif()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_dbg_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("toolbox")
+subdirs("bench")
+subdirs("example")
+subdirs("image")
+subdirs("doc")
+subdirs("etc")
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tb-bench"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/tb-bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
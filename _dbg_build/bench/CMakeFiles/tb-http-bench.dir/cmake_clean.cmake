@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tb-http-bench"
+  "../bin/tb-http-bench.pdb"
+  "CMakeFiles/tb-http-bench.dir/Http.bm.cpp.o"
+  "CMakeFiles/tb-http-bench.dir/Http.bm.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tb-http-bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/bench/Log.bm.cpp" "bench/CMakeFiles/tb-log-bench.dir/Log.bm.cpp.o" "gcc" "bench/CMakeFiles/tb-log-bench.dir/Log.bm.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dbg_build/toolbox/CMakeFiles/tb-bm-shared.dir/DependInfo.cmake"
+  "/root/repo/_dbg_build/toolbox/CMakeFiles/tb-core-shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tb-map-bench"
+  "../bin/tb-map-bench.pdb"
+  "CMakeFiles/tb-map-bench.dir/Map.bm.cpp.o"
+  "CMakeFiles/tb-map-bench.dir/Map.bm.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tb-map-bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tb-resp-bench"
+  "../bin/tb-resp-bench.pdb"
+  "CMakeFiles/tb-resp-bench.dir/Resp.bm.cpp.o"
+  "CMakeFiles/tb-resp-bench.dir/Resp.bm.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tb-resp-bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
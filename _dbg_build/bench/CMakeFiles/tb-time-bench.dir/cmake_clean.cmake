@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tb-time-bench"
+  "../bin/tb-time-bench.pdb"
+  "CMakeFiles/tb-time-bench.dir/Time.bm.cpp.o"
+  "CMakeFiles/tb-time-bench.dir/Time.bm.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tb-time-bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tb-timer-bench"
+  "../bin/tb-timer-bench.pdb"
+  "CMakeFiles/tb-timer-bench.dir/Timer.bm.cpp.o"
+  "CMakeFiles/tb-timer-bench.dir/Timer.bm.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tb-timer-bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tb-util-bench"
+  "../bin/tb-util-bench.pdb"
+  "CMakeFiles/tb-util-bench.dir/Util.bm.cpp.o"
+  "CMakeFiles/tb-util-bench.dir/Util.bm.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tb-util-bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
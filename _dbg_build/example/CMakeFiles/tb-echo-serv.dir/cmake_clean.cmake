@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tb-echo-serv"
+  "../bin/tb-echo-serv.pdb"
+  "CMakeFiles/tb-echo-serv.dir/EchoServ.cpp.o"
+  "CMakeFiles/tb-echo-serv.dir/EchoServ.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tb-echo-serv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tb-resp-load"
+  "../bin/tb-resp-load.pdb"
+  "CMakeFiles/tb-resp-load.dir/RespLoad.cpp.o"
+  "CMakeFiles/tb-resp-load.dir/RespLoad.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tb-resp-load.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
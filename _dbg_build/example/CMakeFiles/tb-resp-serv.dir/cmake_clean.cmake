@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tb-resp-serv"
+  "../bin/tb-resp-serv.pdb"
+  "CMakeFiles/tb-resp-serv.dir/RespServ.cpp.o"
+  "CMakeFiles/tb-resp-serv.dir/RespServ.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tb-resp-serv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,53 @@
+/*
+ * The Reactive C++ Toolbox.
+ * Copyright (C) 2013-2019 Swirly Cloud Limited
+ * Copyright (C) 2021 Reactive Markets Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TOOLBOX_CONFIG_H
+#define TOOLBOX_CONFIG_H
+
+/**
+ * Toolbox version.
+ */
+#define TOOLBOX_VERSION "snapshot"
+
+/**
+ * Macro for packed structures.
+ */
+#define TOOLBOX_PACKED __attribute__((packed))
+
+/**
+ * Macro for exporting weak symbols.
+ */
+#define TOOLBOX_WEAK __attribute__((visibility("default"), weak))
+
+/**
+ * Macro for exporting classes and functions that compose the public API.
+ */
+#define TOOLBOX_API __attribute__((visibility("default")))
+
+/**
+ * True if SystemTap support is enabled.
+ */
+#define TOOLBOX_HAVE_SYSTEMTAP 0
+
+/**
+ * True if debug build is enabled.
+ */
+#ifndef TOOLBOX_BUILD_DEBUG
+#define TOOLBOX_BUILD_DEBUG 1
+#endif
+
+#endif // TOOLBOX_CONFIG_H
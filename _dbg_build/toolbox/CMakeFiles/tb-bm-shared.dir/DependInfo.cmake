@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/toolbox/bm/Benchmark.cpp" "toolbox/CMakeFiles/tb-bm-shared.dir/bm/Benchmark.cpp.o" "gcc" "toolbox/CMakeFiles/tb-bm-shared.dir/bm/Benchmark.cpp.o.d"
+  "/root/repo/toolbox/bm/Context.cpp" "toolbox/CMakeFiles/tb-bm-shared.dir/bm/Context.cpp.o" "gcc" "toolbox/CMakeFiles/tb-bm-shared.dir/bm/Context.cpp.o.d"
+  "/root/repo/toolbox/bm/Range.cpp" "toolbox/CMakeFiles/tb-bm-shared.dir/bm/Range.cpp.o" "gcc" "toolbox/CMakeFiles/tb-bm-shared.dir/bm/Range.cpp.o.d"
+  "/root/repo/toolbox/bm/Record.cpp" "toolbox/CMakeFiles/tb-bm-shared.dir/bm/Record.cpp.o" "gcc" "toolbox/CMakeFiles/tb-bm-shared.dir/bm/Record.cpp.o.d"
+  "/root/repo/toolbox/bm/Suite.cpp" "toolbox/CMakeFiles/tb-bm-shared.dir/bm/Suite.cpp.o" "gcc" "toolbox/CMakeFiles/tb-bm-shared.dir/bm/Suite.cpp.o.d"
+  "/root/repo/toolbox/bm/Utility.cpp" "toolbox/CMakeFiles/tb-bm-shared.dir/bm/Utility.cpp.o" "gcc" "toolbox/CMakeFiles/tb-bm-shared.dir/bm/Utility.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dbg_build/toolbox/CMakeFiles/tb-core-shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,85 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/toolbox/Main.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/Main.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/Main.ut.cpp.o.d"
+  "/root/repo/toolbox/hdr/Encoding.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/hdr/Encoding.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/hdr/Encoding.ut.cpp.o.d"
+  "/root/repo/toolbox/hdr/Histogram.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/hdr/Histogram.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/hdr/Histogram.ut.cpp.o.d"
+  "/root/repo/toolbox/hdr/IntervalLog.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/hdr/IntervalLog.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/hdr/IntervalLog.ut.cpp.o.d"
+  "/root/repo/toolbox/hdr/Iterator.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/hdr/Iterator.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/hdr/Iterator.ut.cpp.o.d"
+  "/root/repo/toolbox/hdr/PackedCounts.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/hdr/PackedCounts.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/hdr/PackedCounts.ut.cpp.o.d"
+  "/root/repo/toolbox/hdr/Recorder.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/hdr/Recorder.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/hdr/Recorder.ut.cpp.o.d"
+  "/root/repo/toolbox/hdr/Utility.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/hdr/Utility.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/hdr/Utility.ut.cpp.o.d"
+  "/root/repo/toolbox/http/Admission.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/http/Admission.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/http/Admission.ut.cpp.o.d"
+  "/root/repo/toolbox/http/Clnt.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/http/Clnt.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/http/Clnt.ut.cpp.o.d"
+  "/root/repo/toolbox/http/Compress.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/http/Compress.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/http/Compress.ut.cpp.o.d"
+  "/root/repo/toolbox/http/Metrics.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/http/Metrics.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/http/Metrics.ut.cpp.o.d"
+  "/root/repo/toolbox/http/Parser.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/http/Parser.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/http/Parser.ut.cpp.o.d"
+  "/root/repo/toolbox/http/Request.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/http/Request.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/http/Request.ut.cpp.o.d"
+  "/root/repo/toolbox/http/RequestParser.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/http/RequestParser.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/http/RequestParser.ut.cpp.o.d"
+  "/root/repo/toolbox/http/ResponseCache.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/http/ResponseCache.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/http/ResponseCache.ut.cpp.o.d"
+  "/root/repo/toolbox/http/Router.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/http/Router.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/http/Router.ut.cpp.o.d"
+  "/root/repo/toolbox/http/Serv.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/http/Serv.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/http/Serv.ut.cpp.o.d"
+  "/root/repo/toolbox/http/Stream.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/http/Stream.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/http/Stream.ut.cpp.o.d"
+  "/root/repo/toolbox/http/Types.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/http/Types.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/http/Types.ut.cpp.o.d"
+  "/root/repo/toolbox/http/Url.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/http/Url.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/http/Url.ut.cpp.o.d"
+  "/root/repo/toolbox/http/WebSocket.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/http/WebSocket.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/http/WebSocket.ut.cpp.o.d"
+  "/root/repo/toolbox/io/Buffer.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/io/Buffer.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/io/Buffer.ut.cpp.o.d"
+  "/root/repo/toolbox/io/Disposer.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/io/Disposer.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/io/Disposer.ut.cpp.o.d"
+  "/root/repo/toolbox/io/Handle.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/io/Handle.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/io/Handle.ut.cpp.o.d"
+  "/root/repo/toolbox/io/Hook.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/io/Hook.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/io/Hook.ut.cpp.o.d"
+  "/root/repo/toolbox/io/Reactor.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/io/Reactor.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/io/Reactor.ut.cpp.o.d"
+  "/root/repo/toolbox/io/Timer.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/io/Timer.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/io/Timer.ut.cpp.o.d"
+  "/root/repo/toolbox/net/Endpoint.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/net/Endpoint.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/net/Endpoint.ut.cpp.o.d"
+  "/root/repo/toolbox/net/Frame.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/net/Frame.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/net/Frame.ut.cpp.o.d"
+  "/root/repo/toolbox/net/IoSock.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/net/IoSock.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/net/IoSock.ut.cpp.o.d"
+  "/root/repo/toolbox/net/RateLimit.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/net/RateLimit.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/net/RateLimit.ut.cpp.o.d"
+  "/root/repo/toolbox/net/Resolver.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/net/Resolver.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/net/Resolver.ut.cpp.o.d"
+  "/root/repo/toolbox/net/Socket.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/net/Socket.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/net/Socket.ut.cpp.o.d"
+  "/root/repo/toolbox/resp/Encoder.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/resp/Encoder.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/resp/Encoder.ut.cpp.o.d"
+  "/root/repo/toolbox/resp/Parser.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/resp/Parser.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/resp/Parser.ut.cpp.o.d"
+  "/root/repo/toolbox/resp/RespClnt.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/resp/RespClnt.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/resp/RespClnt.ut.cpp.o.d"
+  "/root/repo/toolbox/sys/Date.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/sys/Date.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/sys/Date.ut.cpp.o.d"
+  "/root/repo/toolbox/sys/Log.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/sys/Log.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/sys/Log.ut.cpp.o.d"
+  "/root/repo/toolbox/sys/Thread.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/sys/Thread.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/sys/Thread.ut.cpp.o.d"
+  "/root/repo/toolbox/sys/Time.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/sys/Time.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/sys/Time.ut.cpp.o.d"
+  "/root/repo/toolbox/util/Allocator.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/util/Allocator.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/util/Allocator.ut.cpp.o.d"
+  "/root/repo/toolbox/util/Argv.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/util/Argv.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/util/Argv.ut.cpp.o.d"
+  "/root/repo/toolbox/util/Array.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/util/Array.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/util/Array.ut.cpp.o.d"
+  "/root/repo/toolbox/util/Base64.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/util/Base64.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/util/Base64.ut.cpp.o.d"
+  "/root/repo/toolbox/util/Config.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/util/Config.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/util/Config.ut.cpp.o.d"
+  "/root/repo/toolbox/util/Enum.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/util/Enum.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/util/Enum.ut.cpp.o.d"
+  "/root/repo/toolbox/util/Exception.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/util/Exception.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/util/Exception.ut.cpp.o.d"
+  "/root/repo/toolbox/util/Finally.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/util/Finally.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/util/Finally.ut.cpp.o.d"
+  "/root/repo/toolbox/util/IntTypes.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/util/IntTypes.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/util/IntTypes.ut.cpp.o.d"
+  "/root/repo/toolbox/util/Math.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/util/Math.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/util/Math.ut.cpp.o.d"
+  "/root/repo/toolbox/util/Options.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/util/Options.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/util/Options.ut.cpp.o.d"
+  "/root/repo/toolbox/util/RefCount.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/util/RefCount.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/util/RefCount.ut.cpp.o.d"
+  "/root/repo/toolbox/util/RingBuffer.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/util/RingBuffer.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/util/RingBuffer.ut.cpp.o.d"
+  "/root/repo/toolbox/util/Slot.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/util/Slot.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/util/Slot.ut.cpp.o.d"
+  "/root/repo/toolbox/util/Stream.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/util/Stream.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/util/Stream.ut.cpp.o.d"
+  "/root/repo/toolbox/util/StreamInserter.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/util/StreamInserter.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/util/StreamInserter.ut.cpp.o.d"
+  "/root/repo/toolbox/util/String.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/util/String.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/util/String.ut.cpp.o.d"
+  "/root/repo/toolbox/util/StringBuf.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/util/StringBuf.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/util/StringBuf.ut.cpp.o.d"
+  "/root/repo/toolbox/util/Struct.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/util/Struct.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/util/Struct.ut.cpp.o.d"
+  "/root/repo/toolbox/util/Tokeniser.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/util/Tokeniser.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/util/Tokeniser.ut.cpp.o.d"
+  "/root/repo/toolbox/util/Traits.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/util/Traits.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/util/Traits.ut.cpp.o.d"
+  "/root/repo/toolbox/util/Trans.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/util/Trans.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/util/Trans.ut.cpp.o.d"
+  "/root/repo/toolbox/util/Utility.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/util/Utility.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/util/Utility.ut.cpp.o.d"
+  "/root/repo/toolbox/util/VarSub.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/util/VarSub.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/util/VarSub.ut.cpp.o.d"
+  "/root/repo/toolbox/util/Version.ut.cpp" "toolbox/CMakeFiles/tb-core-test.dir/util/Version.ut.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-test.dir/util/Version.ut.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dbg_build/toolbox/CMakeFiles/tb-core-shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
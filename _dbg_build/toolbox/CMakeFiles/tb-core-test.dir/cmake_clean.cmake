@@ -0,0 +1,141 @@
+file(REMOVE_RECURSE
+  "../bin/tb-core-test"
+  "../bin/tb-core-test.pdb"
+  "CMakeFiles/tb-core-test.dir/Main.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/Main.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/hdr/Encoding.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/hdr/Encoding.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/hdr/Histogram.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/hdr/Histogram.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/hdr/IntervalLog.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/hdr/IntervalLog.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/hdr/Iterator.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/hdr/Iterator.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/hdr/PackedCounts.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/hdr/PackedCounts.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/hdr/Recorder.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/hdr/Recorder.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/hdr/Utility.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/hdr/Utility.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/http/Admission.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/http/Admission.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/http/Clnt.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/http/Clnt.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/http/Compress.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/http/Compress.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/http/Metrics.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/http/Metrics.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/http/Parser.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/http/Parser.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/http/Request.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/http/Request.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/http/RequestParser.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/http/RequestParser.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/http/ResponseCache.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/http/ResponseCache.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/http/Router.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/http/Router.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/http/Serv.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/http/Serv.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/http/Stream.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/http/Stream.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/http/Types.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/http/Types.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/http/Url.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/http/Url.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/http/WebSocket.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/http/WebSocket.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/io/Buffer.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/io/Buffer.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/io/Disposer.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/io/Disposer.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/io/Handle.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/io/Handle.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/io/Hook.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/io/Hook.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/io/Reactor.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/io/Reactor.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/io/Timer.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/io/Timer.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/net/Endpoint.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/net/Endpoint.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/net/Frame.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/net/Frame.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/net/IoSock.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/net/IoSock.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/net/RateLimit.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/net/RateLimit.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/net/Resolver.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/net/Resolver.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/net/Socket.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/net/Socket.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/resp/Encoder.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/resp/Encoder.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/resp/Parser.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/resp/Parser.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/resp/RespClnt.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/resp/RespClnt.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/sys/Date.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/sys/Date.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/sys/Log.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/sys/Log.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/sys/Thread.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/sys/Thread.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/sys/Time.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/sys/Time.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/util/Allocator.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/util/Allocator.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/util/Argv.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/util/Argv.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/util/Array.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/util/Array.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/util/Base64.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/util/Base64.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/util/Config.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/util/Config.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/util/Enum.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/util/Enum.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/util/Exception.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/util/Exception.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/util/Finally.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/util/Finally.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/util/IntTypes.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/util/IntTypes.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/util/Math.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/util/Math.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/util/Options.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/util/Options.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/util/RefCount.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/util/RefCount.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/util/RingBuffer.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/util/RingBuffer.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/util/Slot.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/util/Slot.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/util/Stream.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/util/Stream.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/util/StreamInserter.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/util/StreamInserter.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/util/String.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/util/String.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/util/StringBuf.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/util/StringBuf.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/util/Struct.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/util/Struct.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/util/Tokeniser.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/util/Tokeniser.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/util/Traits.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/util/Traits.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/util/Trans.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/util/Trans.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/util/Utility.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/util/Utility.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/util/VarSub.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/util/VarSub.ut.cpp.o.d"
+  "CMakeFiles/tb-core-test.dir/util/Version.ut.cpp.o"
+  "CMakeFiles/tb-core-test.dir/util/Version.ut.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tb-core-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
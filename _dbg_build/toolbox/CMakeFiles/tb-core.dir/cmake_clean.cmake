@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tb-core"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/tb-core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
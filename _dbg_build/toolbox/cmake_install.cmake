@@ -0,0 +1,550 @@
+# Install script for directory: /root/repo/toolbox
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Debug")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox" TYPE FILE FILES "/root/repo/_dbg_build/include/toolbox/Config.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "static" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE STATIC_LIBRARY FILES "/root/repo/_dbg_build/lib/libtb_core.a")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "shared" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_dbg_build/lib/libtb_core.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libtb_core.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libtb_core.so")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libtb_core.so")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "shared" OR NOT CMAKE_INSTALL_COMPONENT)
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "static" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE STATIC_LIBRARY FILES "/root/repo/_dbg_build/lib/libtb_bm.a")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "shared" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_dbg_build/lib/libtb_bm.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libtb_bm.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libtb_bm.so")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libtb_bm.so")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "shared" OR NOT CMAKE_INSTALL_COMPONENT)
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox" TYPE FILE FILES "/root/repo/toolbox/bm.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox" TYPE FILE FILES "/root/repo/toolbox/hdr.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox" TYPE FILE FILES "/root/repo/toolbox/http.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox" TYPE FILE FILES "/root/repo/toolbox/io.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox" TYPE FILE FILES "/root/repo/toolbox/net.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox" TYPE FILE FILES "/root/repo/toolbox/resp.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox" TYPE FILE FILES "/root/repo/toolbox/sys.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox" TYPE FILE FILES "/root/repo/toolbox/util.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/hdr" TYPE FILE FILES "/root/repo/toolbox/hdr/Encoding.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/hdr" TYPE FILE FILES "/root/repo/toolbox/hdr/Histogram.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/hdr" TYPE FILE FILES "/root/repo/toolbox/hdr/IntervalLog.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/hdr" TYPE FILE FILES "/root/repo/toolbox/hdr/Iterator.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/hdr" TYPE FILE FILES "/root/repo/toolbox/hdr/PackedCounts.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/hdr" TYPE FILE FILES "/root/repo/toolbox/hdr/Recorder.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/hdr" TYPE FILE FILES "/root/repo/toolbox/hdr/Utility.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/http" TYPE FILE FILES "/root/repo/toolbox/http/Admission.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/http" TYPE FILE FILES "/root/repo/toolbox/http/App.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/http" TYPE FILE FILES "/root/repo/toolbox/http/Clnt.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/http" TYPE FILE FILES "/root/repo/toolbox/http/ClntConn.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/http" TYPE FILE FILES "/root/repo/toolbox/http/Compress.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/http" TYPE FILE FILES "/root/repo/toolbox/http/Conn.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/http" TYPE FILE FILES "/root/repo/toolbox/http/Error.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/http" TYPE FILE FILES "/root/repo/toolbox/http/Exception.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/http" TYPE FILE FILES "/root/repo/toolbox/http/Metrics.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/http" TYPE FILE FILES "/root/repo/toolbox/http/Parser.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/http" TYPE FILE FILES "/root/repo/toolbox/http/Request.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/http" TYPE FILE FILES "/root/repo/toolbox/http/RequestParser.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/http" TYPE FILE FILES "/root/repo/toolbox/http/Response.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/http" TYPE FILE FILES "/root/repo/toolbox/http/ResponseCache.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/http" TYPE FILE FILES "/root/repo/toolbox/http/Router.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/http" TYPE FILE FILES "/root/repo/toolbox/http/Serv.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/http" TYPE FILE FILES "/root/repo/toolbox/http/Stream.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/http" TYPE FILE FILES "/root/repo/toolbox/http/Types.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/http" TYPE FILE FILES "/root/repo/toolbox/http/Url.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/http" TYPE FILE FILES "/root/repo/toolbox/http/WebSocket.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/http" TYPE FILE FILES "/root/repo/toolbox/http/WsApp.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/http" TYPE FILE FILES "/root/repo/toolbox/http/WsConn.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/io" TYPE FILE FILES "/root/repo/toolbox/io/Buffer.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/io" TYPE FILE FILES "/root/repo/toolbox/io/Disposer.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/io" TYPE FILE FILES "/root/repo/toolbox/io/Epoll.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/io" TYPE FILE FILES "/root/repo/toolbox/io/Event.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/io" TYPE FILE FILES "/root/repo/toolbox/io/EventFd.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/io" TYPE FILE FILES "/root/repo/toolbox/io/File.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/io" TYPE FILE FILES "/root/repo/toolbox/io/Handle.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/io" TYPE FILE FILES "/root/repo/toolbox/io/Hook.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/io" TYPE FILE FILES "/root/repo/toolbox/io/Reactor.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/io" TYPE FILE FILES "/root/repo/toolbox/io/Runner.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/io" TYPE FILE FILES "/root/repo/toolbox/io/SharedBuffer.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/io" TYPE FILE FILES "/root/repo/toolbox/io/Stream.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/io" TYPE FILE FILES "/root/repo/toolbox/io/Timer.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/io" TYPE FILE FILES "/root/repo/toolbox/io/TimerFd.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/io" TYPE FILE FILES "/root/repo/toolbox/io/Waker.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/net" TYPE FILE FILES "/root/repo/toolbox/net/DgramSock.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/net" TYPE FILE FILES "/root/repo/toolbox/net/Endian.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/net" TYPE FILE FILES "/root/repo/toolbox/net/Endpoint.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/net" TYPE FILE FILES "/root/repo/toolbox/net/Error.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/net" TYPE FILE FILES "/root/repo/toolbox/net/Frame.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/net" TYPE FILE FILES "/root/repo/toolbox/net/IoSock.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/net" TYPE FILE FILES "/root/repo/toolbox/net/IpAddr.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/net" TYPE FILE FILES "/root/repo/toolbox/net/McastSock.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/net" TYPE FILE FILES "/root/repo/toolbox/net/Protocol.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/net" TYPE FILE FILES "/root/repo/toolbox/net/RateLimit.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/net" TYPE FILE FILES "/root/repo/toolbox/net/Resolver.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/net" TYPE FILE FILES "/root/repo/toolbox/net/Socket.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/net" TYPE FILE FILES "/root/repo/toolbox/net/StreamAcceptor.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/net" TYPE FILE FILES "/root/repo/toolbox/net/StreamConnector.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/net" TYPE FILE FILES "/root/repo/toolbox/net/StreamSock.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/resp" TYPE FILE FILES "/root/repo/toolbox/resp/Encoder.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/resp" TYPE FILE FILES "/root/repo/toolbox/resp/Exception.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/resp" TYPE FILE FILES "/root/repo/toolbox/resp/Parser.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/resp" TYPE FILE FILES "/root/repo/toolbox/resp/RespClnt.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/resp" TYPE FILE FILES "/root/repo/toolbox/resp/RespReply.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/sys" TYPE FILE FILES "/root/repo/toolbox/sys/Daemon.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/sys" TYPE FILE FILES "/root/repo/toolbox/sys/Date.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/sys" TYPE FILE FILES "/root/repo/toolbox/sys/Error.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/sys" TYPE FILE FILES "/root/repo/toolbox/sys/Limits.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/sys" TYPE FILE FILES "/root/repo/toolbox/sys/Log.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/sys" TYPE FILE FILES "/root/repo/toolbox/sys/Logger.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/sys" TYPE FILE FILES "/root/repo/toolbox/sys/PidFile.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/sys" TYPE FILE FILES "/root/repo/toolbox/sys/Runner.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/sys" TYPE FILE FILES "/root/repo/toolbox/sys/Signal.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/sys" TYPE FILE FILES "/root/repo/toolbox/sys/System.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/sys" TYPE FILE FILES "/root/repo/toolbox/sys/Thread.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/sys" TYPE FILE FILES "/root/repo/toolbox/sys/Time.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/sys" TYPE FILE FILES "/root/repo/toolbox/sys/Trace.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/Alarm.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/Allocator.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/Argv.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/Array.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/Base64.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/Config.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/Enum.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/Exception.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/Finally.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/IntTypes.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/Math.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/Options.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/RefCount.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/RingBuffer.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/RobinHood.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/Slot.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/Storage.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/Stream.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/StringBuf.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/StreamInserter.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/String.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/Struct.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/TaskQueue.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/Tokeniser.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/Traits.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/Trans.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/TypeTraits.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/Utility.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/Variant.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/VarSub.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/util" TYPE FILE FILES "/root/repo/toolbox/util/Version.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "header" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/toolbox/contrib" TYPE FILE FILES "/root/repo/toolbox/contrib/http_parser.h")
+endif()
+
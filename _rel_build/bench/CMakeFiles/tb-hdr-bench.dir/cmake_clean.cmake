@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tb-hdr-bench"
+  "../bin/tb-hdr-bench.pdb"
+  "CMakeFiles/tb-hdr-bench.dir/Hdr.bm.cpp.o"
+  "CMakeFiles/tb-hdr-bench.dir/Hdr.bm.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tb-hdr-bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
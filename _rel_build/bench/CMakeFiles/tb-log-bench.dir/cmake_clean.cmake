@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tb-log-bench"
+  "../bin/tb-log-bench.pdb"
+  "CMakeFiles/tb-log-bench.dir/Log.bm.cpp.o"
+  "CMakeFiles/tb-log-bench.dir/Log.bm.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tb-log-bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
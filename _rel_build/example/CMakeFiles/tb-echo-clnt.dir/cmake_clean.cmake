@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tb-echo-clnt"
+  "../bin/tb-echo-clnt.pdb"
+  "CMakeFiles/tb-echo-clnt.dir/EchoClnt.cpp.o"
+  "CMakeFiles/tb-echo-clnt.dir/EchoClnt.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tb-echo-clnt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
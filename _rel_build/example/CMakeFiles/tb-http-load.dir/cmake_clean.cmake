@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tb-http-load"
+  "../bin/tb-http-load.pdb"
+  "CMakeFiles/tb-http-load.dir/HttpLoad.cpp.o"
+  "CMakeFiles/tb-http-load.dir/HttpLoad.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tb-http-load.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/tb-http-serv"
+  "../bin/tb-http-serv.pdb"
+  "CMakeFiles/tb-http-serv.dir/HttpServ.cpp.o"
+  "CMakeFiles/tb-http-serv.dir/HttpServ.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tb-http-serv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../lib/libtb_bm.pdb"
+  "../lib/libtb_bm.so"
+  "CMakeFiles/tb-bm-shared.dir/bm/Benchmark.cpp.o"
+  "CMakeFiles/tb-bm-shared.dir/bm/Benchmark.cpp.o.d"
+  "CMakeFiles/tb-bm-shared.dir/bm/Context.cpp.o"
+  "CMakeFiles/tb-bm-shared.dir/bm/Context.cpp.o.d"
+  "CMakeFiles/tb-bm-shared.dir/bm/Range.cpp.o"
+  "CMakeFiles/tb-bm-shared.dir/bm/Range.cpp.o.d"
+  "CMakeFiles/tb-bm-shared.dir/bm/Record.cpp.o"
+  "CMakeFiles/tb-bm-shared.dir/bm/Record.cpp.o.d"
+  "CMakeFiles/tb-bm-shared.dir/bm/Suite.cpp.o"
+  "CMakeFiles/tb-bm-shared.dir/bm/Suite.cpp.o.d"
+  "CMakeFiles/tb-bm-shared.dir/bm/Utility.cpp.o"
+  "CMakeFiles/tb-bm-shared.dir/bm/Utility.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tb-bm-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
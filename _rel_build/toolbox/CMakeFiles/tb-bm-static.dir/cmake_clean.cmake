@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../lib/libtb_bm.a"
+  "../lib/libtb_bm.pdb"
+  "CMakeFiles/tb-bm-static.dir/bm/Benchmark.cpp.o"
+  "CMakeFiles/tb-bm-static.dir/bm/Benchmark.cpp.o.d"
+  "CMakeFiles/tb-bm-static.dir/bm/Context.cpp.o"
+  "CMakeFiles/tb-bm-static.dir/bm/Context.cpp.o.d"
+  "CMakeFiles/tb-bm-static.dir/bm/Range.cpp.o"
+  "CMakeFiles/tb-bm-static.dir/bm/Range.cpp.o.d"
+  "CMakeFiles/tb-bm-static.dir/bm/Record.cpp.o"
+  "CMakeFiles/tb-bm-static.dir/bm/Record.cpp.o.d"
+  "CMakeFiles/tb-bm-static.dir/bm/Suite.cpp.o"
+  "CMakeFiles/tb-bm-static.dir/bm/Suite.cpp.o.d"
+  "CMakeFiles/tb-bm-static.dir/bm/Utility.cpp.o"
+  "CMakeFiles/tb-bm-static.dir/bm/Utility.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tb-bm-static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
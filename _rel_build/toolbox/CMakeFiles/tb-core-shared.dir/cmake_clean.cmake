@@ -0,0 +1,225 @@
+file(REMOVE_RECURSE
+  "../lib/libtb_core.pdb"
+  "../lib/libtb_core.so"
+  "CMakeFiles/tb-core-shared.dir/hdr/Encoding.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/hdr/Encoding.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/hdr/Histogram.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/hdr/Histogram.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/hdr/IntervalLog.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/hdr/IntervalLog.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/hdr/Iterator.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/hdr/Iterator.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/hdr/PackedCounts.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/hdr/PackedCounts.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/hdr/Recorder.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/hdr/Recorder.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/hdr/Utility.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/hdr/Utility.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/http/Admission.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/http/Admission.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/http/App.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/http/App.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/http/Clnt.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/http/Clnt.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/http/ClntConn.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/http/ClntConn.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/http/Compress.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/http/Compress.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/http/Conn.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/http/Conn.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/http/Error.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/http/Error.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/http/Exception.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/http/Exception.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/http/Metrics.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/http/Metrics.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/http/Parser.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/http/Parser.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/http/Request.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/http/Request.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/http/RequestParser.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/http/RequestParser.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/http/Response.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/http/Response.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/http/ResponseCache.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/http/ResponseCache.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/http/Router.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/http/Router.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/http/Serv.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/http/Serv.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/http/Stream.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/http/Stream.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/http/Types.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/http/Types.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/http/Url.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/http/Url.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/http/WebSocket.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/http/WebSocket.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/http/WsApp.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/http/WsApp.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/http/WsConn.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/http/WsConn.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/io/Buffer.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/io/Buffer.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/io/Disposer.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/io/Disposer.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/io/Epoll.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/io/Epoll.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/io/Event.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/io/Event.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/io/EventFd.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/io/EventFd.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/io/File.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/io/File.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/io/Handle.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/io/Handle.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/io/Hook.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/io/Hook.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/io/Reactor.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/io/Reactor.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/io/Runner.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/io/Runner.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/io/SharedBuffer.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/io/SharedBuffer.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/io/Stream.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/io/Stream.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/io/Timer.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/io/Timer.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/io/TimerFd.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/io/TimerFd.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/io/Waker.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/io/Waker.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/net/DgramSock.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/net/DgramSock.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/net/Endian.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/net/Endian.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/net/Endpoint.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/net/Endpoint.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/net/Error.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/net/Error.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/net/Frame.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/net/Frame.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/net/IoSock.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/net/IoSock.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/net/IpAddr.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/net/IpAddr.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/net/McastSock.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/net/McastSock.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/net/Protocol.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/net/Protocol.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/net/RateLimit.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/net/RateLimit.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/net/Resolver.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/net/Resolver.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/net/Socket.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/net/Socket.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/net/StreamAcceptor.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/net/StreamAcceptor.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/net/StreamConnector.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/net/StreamConnector.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/net/StreamSock.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/net/StreamSock.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/resp/Encoder.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/resp/Encoder.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/resp/Exception.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/resp/Exception.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/resp/Parser.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/resp/Parser.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/resp/RespClnt.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/resp/RespClnt.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/resp/RespReply.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/resp/RespReply.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/sys/Daemon.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/sys/Daemon.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/sys/Date.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/sys/Date.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/sys/Error.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/sys/Error.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/sys/Limits.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/sys/Limits.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/sys/Log.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/sys/Log.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/sys/Logger.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/sys/Logger.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/sys/PidFile.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/sys/PidFile.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/sys/Runner.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/sys/Runner.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/sys/Signal.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/sys/Signal.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/sys/System.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/sys/System.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/sys/Thread.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/sys/Thread.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/sys/Time.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/sys/Time.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/sys/Trace.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/sys/Trace.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/Alarm.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/Alarm.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/Allocator.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/Allocator.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/Argv.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/Argv.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/Array.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/Array.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/Base64.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/Base64.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/Config.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/Config.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/Enum.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/Enum.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/Exception.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/Exception.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/Finally.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/Finally.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/IntTypes.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/IntTypes.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/Math.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/Math.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/Options.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/Options.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/RefCount.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/RefCount.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/RingBuffer.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/RingBuffer.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/RobinHood.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/RobinHood.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/Slot.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/Slot.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/Storage.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/Storage.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/Stream.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/Stream.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/StreamInserter.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/StreamInserter.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/String.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/String.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/StringBuf.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/StringBuf.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/Struct.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/Struct.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/TaskQueue.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/TaskQueue.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/Tokeniser.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/Tokeniser.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/Traits.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/Traits.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/Trans.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/Trans.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/TypeTraits.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/TypeTraits.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/Utility.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/Utility.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/VarSub.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/VarSub.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/Variant.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/Variant.cpp.o.d"
+  "CMakeFiles/tb-core-shared.dir/util/Version.cpp.o"
+  "CMakeFiles/tb-core-shared.dir/util/Version.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tb-core-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
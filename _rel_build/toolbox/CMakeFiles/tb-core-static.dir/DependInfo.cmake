@@ -0,0 +1,126 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/toolbox/hdr/Encoding.cpp" "toolbox/CMakeFiles/tb-core-static.dir/hdr/Encoding.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/hdr/Encoding.cpp.o.d"
+  "/root/repo/toolbox/hdr/Histogram.cpp" "toolbox/CMakeFiles/tb-core-static.dir/hdr/Histogram.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/hdr/Histogram.cpp.o.d"
+  "/root/repo/toolbox/hdr/IntervalLog.cpp" "toolbox/CMakeFiles/tb-core-static.dir/hdr/IntervalLog.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/hdr/IntervalLog.cpp.o.d"
+  "/root/repo/toolbox/hdr/Iterator.cpp" "toolbox/CMakeFiles/tb-core-static.dir/hdr/Iterator.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/hdr/Iterator.cpp.o.d"
+  "/root/repo/toolbox/hdr/PackedCounts.cpp" "toolbox/CMakeFiles/tb-core-static.dir/hdr/PackedCounts.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/hdr/PackedCounts.cpp.o.d"
+  "/root/repo/toolbox/hdr/Recorder.cpp" "toolbox/CMakeFiles/tb-core-static.dir/hdr/Recorder.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/hdr/Recorder.cpp.o.d"
+  "/root/repo/toolbox/hdr/Utility.cpp" "toolbox/CMakeFiles/tb-core-static.dir/hdr/Utility.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/hdr/Utility.cpp.o.d"
+  "/root/repo/toolbox/http/Admission.cpp" "toolbox/CMakeFiles/tb-core-static.dir/http/Admission.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/http/Admission.cpp.o.d"
+  "/root/repo/toolbox/http/App.cpp" "toolbox/CMakeFiles/tb-core-static.dir/http/App.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/http/App.cpp.o.d"
+  "/root/repo/toolbox/http/Clnt.cpp" "toolbox/CMakeFiles/tb-core-static.dir/http/Clnt.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/http/Clnt.cpp.o.d"
+  "/root/repo/toolbox/http/ClntConn.cpp" "toolbox/CMakeFiles/tb-core-static.dir/http/ClntConn.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/http/ClntConn.cpp.o.d"
+  "/root/repo/toolbox/http/Compress.cpp" "toolbox/CMakeFiles/tb-core-static.dir/http/Compress.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/http/Compress.cpp.o.d"
+  "/root/repo/toolbox/http/Conn.cpp" "toolbox/CMakeFiles/tb-core-static.dir/http/Conn.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/http/Conn.cpp.o.d"
+  "/root/repo/toolbox/http/Error.cpp" "toolbox/CMakeFiles/tb-core-static.dir/http/Error.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/http/Error.cpp.o.d"
+  "/root/repo/toolbox/http/Exception.cpp" "toolbox/CMakeFiles/tb-core-static.dir/http/Exception.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/http/Exception.cpp.o.d"
+  "/root/repo/toolbox/http/Metrics.cpp" "toolbox/CMakeFiles/tb-core-static.dir/http/Metrics.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/http/Metrics.cpp.o.d"
+  "/root/repo/toolbox/http/Parser.cpp" "toolbox/CMakeFiles/tb-core-static.dir/http/Parser.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/http/Parser.cpp.o.d"
+  "/root/repo/toolbox/http/Request.cpp" "toolbox/CMakeFiles/tb-core-static.dir/http/Request.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/http/Request.cpp.o.d"
+  "/root/repo/toolbox/http/RequestParser.cpp" "toolbox/CMakeFiles/tb-core-static.dir/http/RequestParser.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/http/RequestParser.cpp.o.d"
+  "/root/repo/toolbox/http/Response.cpp" "toolbox/CMakeFiles/tb-core-static.dir/http/Response.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/http/Response.cpp.o.d"
+  "/root/repo/toolbox/http/ResponseCache.cpp" "toolbox/CMakeFiles/tb-core-static.dir/http/ResponseCache.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/http/ResponseCache.cpp.o.d"
+  "/root/repo/toolbox/http/Router.cpp" "toolbox/CMakeFiles/tb-core-static.dir/http/Router.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/http/Router.cpp.o.d"
+  "/root/repo/toolbox/http/Serv.cpp" "toolbox/CMakeFiles/tb-core-static.dir/http/Serv.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/http/Serv.cpp.o.d"
+  "/root/repo/toolbox/http/Stream.cpp" "toolbox/CMakeFiles/tb-core-static.dir/http/Stream.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/http/Stream.cpp.o.d"
+  "/root/repo/toolbox/http/Types.cpp" "toolbox/CMakeFiles/tb-core-static.dir/http/Types.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/http/Types.cpp.o.d"
+  "/root/repo/toolbox/http/Url.cpp" "toolbox/CMakeFiles/tb-core-static.dir/http/Url.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/http/Url.cpp.o.d"
+  "/root/repo/toolbox/http/WebSocket.cpp" "toolbox/CMakeFiles/tb-core-static.dir/http/WebSocket.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/http/WebSocket.cpp.o.d"
+  "/root/repo/toolbox/http/WsApp.cpp" "toolbox/CMakeFiles/tb-core-static.dir/http/WsApp.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/http/WsApp.cpp.o.d"
+  "/root/repo/toolbox/http/WsConn.cpp" "toolbox/CMakeFiles/tb-core-static.dir/http/WsConn.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/http/WsConn.cpp.o.d"
+  "/root/repo/toolbox/io/Buffer.cpp" "toolbox/CMakeFiles/tb-core-static.dir/io/Buffer.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/io/Buffer.cpp.o.d"
+  "/root/repo/toolbox/io/Disposer.cpp" "toolbox/CMakeFiles/tb-core-static.dir/io/Disposer.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/io/Disposer.cpp.o.d"
+  "/root/repo/toolbox/io/Epoll.cpp" "toolbox/CMakeFiles/tb-core-static.dir/io/Epoll.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/io/Epoll.cpp.o.d"
+  "/root/repo/toolbox/io/Event.cpp" "toolbox/CMakeFiles/tb-core-static.dir/io/Event.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/io/Event.cpp.o.d"
+  "/root/repo/toolbox/io/EventFd.cpp" "toolbox/CMakeFiles/tb-core-static.dir/io/EventFd.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/io/EventFd.cpp.o.d"
+  "/root/repo/toolbox/io/File.cpp" "toolbox/CMakeFiles/tb-core-static.dir/io/File.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/io/File.cpp.o.d"
+  "/root/repo/toolbox/io/Handle.cpp" "toolbox/CMakeFiles/tb-core-static.dir/io/Handle.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/io/Handle.cpp.o.d"
+  "/root/repo/toolbox/io/Hook.cpp" "toolbox/CMakeFiles/tb-core-static.dir/io/Hook.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/io/Hook.cpp.o.d"
+  "/root/repo/toolbox/io/Reactor.cpp" "toolbox/CMakeFiles/tb-core-static.dir/io/Reactor.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/io/Reactor.cpp.o.d"
+  "/root/repo/toolbox/io/Runner.cpp" "toolbox/CMakeFiles/tb-core-static.dir/io/Runner.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/io/Runner.cpp.o.d"
+  "/root/repo/toolbox/io/SharedBuffer.cpp" "toolbox/CMakeFiles/tb-core-static.dir/io/SharedBuffer.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/io/SharedBuffer.cpp.o.d"
+  "/root/repo/toolbox/io/Stream.cpp" "toolbox/CMakeFiles/tb-core-static.dir/io/Stream.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/io/Stream.cpp.o.d"
+  "/root/repo/toolbox/io/Timer.cpp" "toolbox/CMakeFiles/tb-core-static.dir/io/Timer.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/io/Timer.cpp.o.d"
+  "/root/repo/toolbox/io/TimerFd.cpp" "toolbox/CMakeFiles/tb-core-static.dir/io/TimerFd.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/io/TimerFd.cpp.o.d"
+  "/root/repo/toolbox/io/Waker.cpp" "toolbox/CMakeFiles/tb-core-static.dir/io/Waker.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/io/Waker.cpp.o.d"
+  "/root/repo/toolbox/net/DgramSock.cpp" "toolbox/CMakeFiles/tb-core-static.dir/net/DgramSock.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/net/DgramSock.cpp.o.d"
+  "/root/repo/toolbox/net/Endian.cpp" "toolbox/CMakeFiles/tb-core-static.dir/net/Endian.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/net/Endian.cpp.o.d"
+  "/root/repo/toolbox/net/Endpoint.cpp" "toolbox/CMakeFiles/tb-core-static.dir/net/Endpoint.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/net/Endpoint.cpp.o.d"
+  "/root/repo/toolbox/net/Error.cpp" "toolbox/CMakeFiles/tb-core-static.dir/net/Error.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/net/Error.cpp.o.d"
+  "/root/repo/toolbox/net/Frame.cpp" "toolbox/CMakeFiles/tb-core-static.dir/net/Frame.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/net/Frame.cpp.o.d"
+  "/root/repo/toolbox/net/IoSock.cpp" "toolbox/CMakeFiles/tb-core-static.dir/net/IoSock.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/net/IoSock.cpp.o.d"
+  "/root/repo/toolbox/net/IpAddr.cpp" "toolbox/CMakeFiles/tb-core-static.dir/net/IpAddr.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/net/IpAddr.cpp.o.d"
+  "/root/repo/toolbox/net/McastSock.cpp" "toolbox/CMakeFiles/tb-core-static.dir/net/McastSock.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/net/McastSock.cpp.o.d"
+  "/root/repo/toolbox/net/Protocol.cpp" "toolbox/CMakeFiles/tb-core-static.dir/net/Protocol.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/net/Protocol.cpp.o.d"
+  "/root/repo/toolbox/net/RateLimit.cpp" "toolbox/CMakeFiles/tb-core-static.dir/net/RateLimit.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/net/RateLimit.cpp.o.d"
+  "/root/repo/toolbox/net/Resolver.cpp" "toolbox/CMakeFiles/tb-core-static.dir/net/Resolver.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/net/Resolver.cpp.o.d"
+  "/root/repo/toolbox/net/Socket.cpp" "toolbox/CMakeFiles/tb-core-static.dir/net/Socket.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/net/Socket.cpp.o.d"
+  "/root/repo/toolbox/net/StreamAcceptor.cpp" "toolbox/CMakeFiles/tb-core-static.dir/net/StreamAcceptor.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/net/StreamAcceptor.cpp.o.d"
+  "/root/repo/toolbox/net/StreamConnector.cpp" "toolbox/CMakeFiles/tb-core-static.dir/net/StreamConnector.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/net/StreamConnector.cpp.o.d"
+  "/root/repo/toolbox/net/StreamSock.cpp" "toolbox/CMakeFiles/tb-core-static.dir/net/StreamSock.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/net/StreamSock.cpp.o.d"
+  "/root/repo/toolbox/resp/Encoder.cpp" "toolbox/CMakeFiles/tb-core-static.dir/resp/Encoder.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/resp/Encoder.cpp.o.d"
+  "/root/repo/toolbox/resp/Exception.cpp" "toolbox/CMakeFiles/tb-core-static.dir/resp/Exception.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/resp/Exception.cpp.o.d"
+  "/root/repo/toolbox/resp/Parser.cpp" "toolbox/CMakeFiles/tb-core-static.dir/resp/Parser.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/resp/Parser.cpp.o.d"
+  "/root/repo/toolbox/resp/RespClnt.cpp" "toolbox/CMakeFiles/tb-core-static.dir/resp/RespClnt.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/resp/RespClnt.cpp.o.d"
+  "/root/repo/toolbox/resp/RespReply.cpp" "toolbox/CMakeFiles/tb-core-static.dir/resp/RespReply.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/resp/RespReply.cpp.o.d"
+  "/root/repo/toolbox/sys/Daemon.cpp" "toolbox/CMakeFiles/tb-core-static.dir/sys/Daemon.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/sys/Daemon.cpp.o.d"
+  "/root/repo/toolbox/sys/Date.cpp" "toolbox/CMakeFiles/tb-core-static.dir/sys/Date.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/sys/Date.cpp.o.d"
+  "/root/repo/toolbox/sys/Error.cpp" "toolbox/CMakeFiles/tb-core-static.dir/sys/Error.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/sys/Error.cpp.o.d"
+  "/root/repo/toolbox/sys/Limits.cpp" "toolbox/CMakeFiles/tb-core-static.dir/sys/Limits.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/sys/Limits.cpp.o.d"
+  "/root/repo/toolbox/sys/Log.cpp" "toolbox/CMakeFiles/tb-core-static.dir/sys/Log.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/sys/Log.cpp.o.d"
+  "/root/repo/toolbox/sys/Logger.cpp" "toolbox/CMakeFiles/tb-core-static.dir/sys/Logger.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/sys/Logger.cpp.o.d"
+  "/root/repo/toolbox/sys/PidFile.cpp" "toolbox/CMakeFiles/tb-core-static.dir/sys/PidFile.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/sys/PidFile.cpp.o.d"
+  "/root/repo/toolbox/sys/Runner.cpp" "toolbox/CMakeFiles/tb-core-static.dir/sys/Runner.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/sys/Runner.cpp.o.d"
+  "/root/repo/toolbox/sys/Signal.cpp" "toolbox/CMakeFiles/tb-core-static.dir/sys/Signal.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/sys/Signal.cpp.o.d"
+  "/root/repo/toolbox/sys/System.cpp" "toolbox/CMakeFiles/tb-core-static.dir/sys/System.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/sys/System.cpp.o.d"
+  "/root/repo/toolbox/sys/Thread.cpp" "toolbox/CMakeFiles/tb-core-static.dir/sys/Thread.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/sys/Thread.cpp.o.d"
+  "/root/repo/toolbox/sys/Time.cpp" "toolbox/CMakeFiles/tb-core-static.dir/sys/Time.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/sys/Time.cpp.o.d"
+  "/root/repo/toolbox/sys/Trace.cpp" "toolbox/CMakeFiles/tb-core-static.dir/sys/Trace.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/sys/Trace.cpp.o.d"
+  "/root/repo/toolbox/util/Alarm.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/Alarm.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/Alarm.cpp.o.d"
+  "/root/repo/toolbox/util/Allocator.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/Allocator.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/Allocator.cpp.o.d"
+  "/root/repo/toolbox/util/Argv.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/Argv.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/Argv.cpp.o.d"
+  "/root/repo/toolbox/util/Array.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/Array.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/Array.cpp.o.d"
+  "/root/repo/toolbox/util/Base64.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/Base64.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/Base64.cpp.o.d"
+  "/root/repo/toolbox/util/Config.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/Config.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/Config.cpp.o.d"
+  "/root/repo/toolbox/util/Enum.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/Enum.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/Enum.cpp.o.d"
+  "/root/repo/toolbox/util/Exception.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/Exception.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/Exception.cpp.o.d"
+  "/root/repo/toolbox/util/Finally.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/Finally.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/Finally.cpp.o.d"
+  "/root/repo/toolbox/util/IntTypes.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/IntTypes.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/IntTypes.cpp.o.d"
+  "/root/repo/toolbox/util/Math.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/Math.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/Math.cpp.o.d"
+  "/root/repo/toolbox/util/Options.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/Options.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/Options.cpp.o.d"
+  "/root/repo/toolbox/util/RefCount.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/RefCount.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/RefCount.cpp.o.d"
+  "/root/repo/toolbox/util/RingBuffer.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/RingBuffer.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/RingBuffer.cpp.o.d"
+  "/root/repo/toolbox/util/RobinHood.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/RobinHood.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/RobinHood.cpp.o.d"
+  "/root/repo/toolbox/util/Slot.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/Slot.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/Slot.cpp.o.d"
+  "/root/repo/toolbox/util/Storage.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/Storage.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/Storage.cpp.o.d"
+  "/root/repo/toolbox/util/Stream.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/Stream.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/Stream.cpp.o.d"
+  "/root/repo/toolbox/util/StreamInserter.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/StreamInserter.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/StreamInserter.cpp.o.d"
+  "/root/repo/toolbox/util/String.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/String.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/String.cpp.o.d"
+  "/root/repo/toolbox/util/StringBuf.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/StringBuf.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/StringBuf.cpp.o.d"
+  "/root/repo/toolbox/util/Struct.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/Struct.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/Struct.cpp.o.d"
+  "/root/repo/toolbox/util/TaskQueue.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/TaskQueue.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/TaskQueue.cpp.o.d"
+  "/root/repo/toolbox/util/Tokeniser.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/Tokeniser.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/Tokeniser.cpp.o.d"
+  "/root/repo/toolbox/util/Traits.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/Traits.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/Traits.cpp.o.d"
+  "/root/repo/toolbox/util/Trans.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/Trans.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/Trans.cpp.o.d"
+  "/root/repo/toolbox/util/TypeTraits.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/TypeTraits.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/TypeTraits.cpp.o.d"
+  "/root/repo/toolbox/util/Utility.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/Utility.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/Utility.cpp.o.d"
+  "/root/repo/toolbox/util/VarSub.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/VarSub.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/VarSub.cpp.o.d"
+  "/root/repo/toolbox/util/Variant.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/Variant.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/Variant.cpp.o.d"
+  "/root/repo/toolbox/util/Version.cpp" "toolbox/CMakeFiles/tb-core-static.dir/util/Version.cpp.o" "gcc" "toolbox/CMakeFiles/tb-core-static.dir/util/Version.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,225 @@
+file(REMOVE_RECURSE
+  "../lib/libtb_core.a"
+  "../lib/libtb_core.pdb"
+  "CMakeFiles/tb-core-static.dir/hdr/Encoding.cpp.o"
+  "CMakeFiles/tb-core-static.dir/hdr/Encoding.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/hdr/Histogram.cpp.o"
+  "CMakeFiles/tb-core-static.dir/hdr/Histogram.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/hdr/IntervalLog.cpp.o"
+  "CMakeFiles/tb-core-static.dir/hdr/IntervalLog.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/hdr/Iterator.cpp.o"
+  "CMakeFiles/tb-core-static.dir/hdr/Iterator.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/hdr/PackedCounts.cpp.o"
+  "CMakeFiles/tb-core-static.dir/hdr/PackedCounts.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/hdr/Recorder.cpp.o"
+  "CMakeFiles/tb-core-static.dir/hdr/Recorder.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/hdr/Utility.cpp.o"
+  "CMakeFiles/tb-core-static.dir/hdr/Utility.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/http/Admission.cpp.o"
+  "CMakeFiles/tb-core-static.dir/http/Admission.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/http/App.cpp.o"
+  "CMakeFiles/tb-core-static.dir/http/App.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/http/Clnt.cpp.o"
+  "CMakeFiles/tb-core-static.dir/http/Clnt.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/http/ClntConn.cpp.o"
+  "CMakeFiles/tb-core-static.dir/http/ClntConn.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/http/Compress.cpp.o"
+  "CMakeFiles/tb-core-static.dir/http/Compress.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/http/Conn.cpp.o"
+  "CMakeFiles/tb-core-static.dir/http/Conn.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/http/Error.cpp.o"
+  "CMakeFiles/tb-core-static.dir/http/Error.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/http/Exception.cpp.o"
+  "CMakeFiles/tb-core-static.dir/http/Exception.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/http/Metrics.cpp.o"
+  "CMakeFiles/tb-core-static.dir/http/Metrics.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/http/Parser.cpp.o"
+  "CMakeFiles/tb-core-static.dir/http/Parser.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/http/Request.cpp.o"
+  "CMakeFiles/tb-core-static.dir/http/Request.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/http/RequestParser.cpp.o"
+  "CMakeFiles/tb-core-static.dir/http/RequestParser.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/http/Response.cpp.o"
+  "CMakeFiles/tb-core-static.dir/http/Response.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/http/ResponseCache.cpp.o"
+  "CMakeFiles/tb-core-static.dir/http/ResponseCache.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/http/Router.cpp.o"
+  "CMakeFiles/tb-core-static.dir/http/Router.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/http/Serv.cpp.o"
+  "CMakeFiles/tb-core-static.dir/http/Serv.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/http/Stream.cpp.o"
+  "CMakeFiles/tb-core-static.dir/http/Stream.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/http/Types.cpp.o"
+  "CMakeFiles/tb-core-static.dir/http/Types.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/http/Url.cpp.o"
+  "CMakeFiles/tb-core-static.dir/http/Url.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/http/WebSocket.cpp.o"
+  "CMakeFiles/tb-core-static.dir/http/WebSocket.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/http/WsApp.cpp.o"
+  "CMakeFiles/tb-core-static.dir/http/WsApp.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/http/WsConn.cpp.o"
+  "CMakeFiles/tb-core-static.dir/http/WsConn.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/io/Buffer.cpp.o"
+  "CMakeFiles/tb-core-static.dir/io/Buffer.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/io/Disposer.cpp.o"
+  "CMakeFiles/tb-core-static.dir/io/Disposer.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/io/Epoll.cpp.o"
+  "CMakeFiles/tb-core-static.dir/io/Epoll.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/io/Event.cpp.o"
+  "CMakeFiles/tb-core-static.dir/io/Event.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/io/EventFd.cpp.o"
+  "CMakeFiles/tb-core-static.dir/io/EventFd.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/io/File.cpp.o"
+  "CMakeFiles/tb-core-static.dir/io/File.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/io/Handle.cpp.o"
+  "CMakeFiles/tb-core-static.dir/io/Handle.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/io/Hook.cpp.o"
+  "CMakeFiles/tb-core-static.dir/io/Hook.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/io/Reactor.cpp.o"
+  "CMakeFiles/tb-core-static.dir/io/Reactor.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/io/Runner.cpp.o"
+  "CMakeFiles/tb-core-static.dir/io/Runner.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/io/SharedBuffer.cpp.o"
+  "CMakeFiles/tb-core-static.dir/io/SharedBuffer.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/io/Stream.cpp.o"
+  "CMakeFiles/tb-core-static.dir/io/Stream.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/io/Timer.cpp.o"
+  "CMakeFiles/tb-core-static.dir/io/Timer.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/io/TimerFd.cpp.o"
+  "CMakeFiles/tb-core-static.dir/io/TimerFd.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/io/Waker.cpp.o"
+  "CMakeFiles/tb-core-static.dir/io/Waker.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/net/DgramSock.cpp.o"
+  "CMakeFiles/tb-core-static.dir/net/DgramSock.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/net/Endian.cpp.o"
+  "CMakeFiles/tb-core-static.dir/net/Endian.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/net/Endpoint.cpp.o"
+  "CMakeFiles/tb-core-static.dir/net/Endpoint.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/net/Error.cpp.o"
+  "CMakeFiles/tb-core-static.dir/net/Error.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/net/Frame.cpp.o"
+  "CMakeFiles/tb-core-static.dir/net/Frame.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/net/IoSock.cpp.o"
+  "CMakeFiles/tb-core-static.dir/net/IoSock.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/net/IpAddr.cpp.o"
+  "CMakeFiles/tb-core-static.dir/net/IpAddr.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/net/McastSock.cpp.o"
+  "CMakeFiles/tb-core-static.dir/net/McastSock.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/net/Protocol.cpp.o"
+  "CMakeFiles/tb-core-static.dir/net/Protocol.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/net/RateLimit.cpp.o"
+  "CMakeFiles/tb-core-static.dir/net/RateLimit.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/net/Resolver.cpp.o"
+  "CMakeFiles/tb-core-static.dir/net/Resolver.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/net/Socket.cpp.o"
+  "CMakeFiles/tb-core-static.dir/net/Socket.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/net/StreamAcceptor.cpp.o"
+  "CMakeFiles/tb-core-static.dir/net/StreamAcceptor.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/net/StreamConnector.cpp.o"
+  "CMakeFiles/tb-core-static.dir/net/StreamConnector.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/net/StreamSock.cpp.o"
+  "CMakeFiles/tb-core-static.dir/net/StreamSock.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/resp/Encoder.cpp.o"
+  "CMakeFiles/tb-core-static.dir/resp/Encoder.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/resp/Exception.cpp.o"
+  "CMakeFiles/tb-core-static.dir/resp/Exception.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/resp/Parser.cpp.o"
+  "CMakeFiles/tb-core-static.dir/resp/Parser.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/resp/RespClnt.cpp.o"
+  "CMakeFiles/tb-core-static.dir/resp/RespClnt.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/resp/RespReply.cpp.o"
+  "CMakeFiles/tb-core-static.dir/resp/RespReply.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/sys/Daemon.cpp.o"
+  "CMakeFiles/tb-core-static.dir/sys/Daemon.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/sys/Date.cpp.o"
+  "CMakeFiles/tb-core-static.dir/sys/Date.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/sys/Error.cpp.o"
+  "CMakeFiles/tb-core-static.dir/sys/Error.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/sys/Limits.cpp.o"
+  "CMakeFiles/tb-core-static.dir/sys/Limits.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/sys/Log.cpp.o"
+  "CMakeFiles/tb-core-static.dir/sys/Log.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/sys/Logger.cpp.o"
+  "CMakeFiles/tb-core-static.dir/sys/Logger.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/sys/PidFile.cpp.o"
+  "CMakeFiles/tb-core-static.dir/sys/PidFile.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/sys/Runner.cpp.o"
+  "CMakeFiles/tb-core-static.dir/sys/Runner.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/sys/Signal.cpp.o"
+  "CMakeFiles/tb-core-static.dir/sys/Signal.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/sys/System.cpp.o"
+  "CMakeFiles/tb-core-static.dir/sys/System.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/sys/Thread.cpp.o"
+  "CMakeFiles/tb-core-static.dir/sys/Thread.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/sys/Time.cpp.o"
+  "CMakeFiles/tb-core-static.dir/sys/Time.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/sys/Trace.cpp.o"
+  "CMakeFiles/tb-core-static.dir/sys/Trace.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/Alarm.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/Alarm.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/Allocator.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/Allocator.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/Argv.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/Argv.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/Array.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/Array.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/Base64.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/Base64.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/Config.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/Config.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/Enum.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/Enum.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/Exception.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/Exception.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/Finally.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/Finally.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/IntTypes.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/IntTypes.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/Math.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/Math.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/Options.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/Options.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/RefCount.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/RefCount.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/RingBuffer.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/RingBuffer.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/RobinHood.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/RobinHood.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/Slot.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/Slot.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/Storage.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/Storage.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/Stream.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/Stream.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/StreamInserter.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/StreamInserter.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/String.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/String.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/StringBuf.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/StringBuf.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/Struct.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/Struct.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/TaskQueue.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/TaskQueue.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/Tokeniser.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/Tokeniser.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/Traits.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/Traits.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/Trans.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/Trans.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/TypeTraits.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/TypeTraits.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/Utility.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/Utility.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/VarSub.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/VarSub.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/Variant.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/Variant.cpp.o.d"
+  "CMakeFiles/tb-core-static.dir/util/Version.cpp.o"
+  "CMakeFiles/tb-core-static.dir/util/Version.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tb-core-static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
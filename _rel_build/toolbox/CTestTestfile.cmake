@@ -0,0 +1,136 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/toolbox
+# Build directory: /root/repo/_rel_build/toolbox
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(hdr::EncodingSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "EncodingSuite")
+set_tests_properties(hdr::EncodingSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(hdr::HistogramSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "HistogramSuite")
+set_tests_properties(hdr::HistogramSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(hdr::IntervalLogSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "IntervalLogSuite")
+set_tests_properties(hdr::IntervalLogSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(hdr::IteratorSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "IteratorSuite")
+set_tests_properties(hdr::IteratorSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(hdr::PackedCountsSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "PackedCountsSuite")
+set_tests_properties(hdr::PackedCountsSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(hdr::RecorderSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "RecorderSuite")
+set_tests_properties(hdr::RecorderSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(hdr::UtilitySuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "UtilitySuite")
+set_tests_properties(hdr::UtilitySuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(http::AdmissionSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "AdmissionSuite")
+set_tests_properties(http::AdmissionSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(http::ClntSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "ClntSuite")
+set_tests_properties(http::ClntSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(http::CompressSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "CompressSuite")
+set_tests_properties(http::CompressSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(http::MetricsSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "MetricsSuite")
+set_tests_properties(http::MetricsSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(http::ParserSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "ParserSuite")
+set_tests_properties(http::ParserSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(http::RequestSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "RequestSuite")
+set_tests_properties(http::RequestSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(http::RequestParserSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "RequestParserSuite")
+set_tests_properties(http::RequestParserSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(http::ResponseCacheSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "ResponseCacheSuite")
+set_tests_properties(http::ResponseCacheSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(http::RouterSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "RouterSuite")
+set_tests_properties(http::RouterSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(http::ServSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "ServSuite")
+set_tests_properties(http::ServSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(http::StreamSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "StreamSuite")
+set_tests_properties(http::StreamSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(http::TypesSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "TypesSuite")
+set_tests_properties(http::TypesSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(http::UrlSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "UrlSuite")
+set_tests_properties(http::UrlSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(http::WebSocketSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "WebSocketSuite")
+set_tests_properties(http::WebSocketSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(io::BufferSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "BufferSuite")
+set_tests_properties(io::BufferSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(io::DisposerSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "DisposerSuite")
+set_tests_properties(io::DisposerSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(io::HandleSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "HandleSuite")
+set_tests_properties(io::HandleSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(io::HookSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "HookSuite")
+set_tests_properties(io::HookSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(io::ReactorSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "ReactorSuite")
+set_tests_properties(io::ReactorSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(io::TimerSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "TimerSuite")
+set_tests_properties(io::TimerSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(net::EndpointSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "EndpointSuite")
+set_tests_properties(net::EndpointSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(net::FrameSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "FrameSuite")
+set_tests_properties(net::FrameSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(net::IoSockSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "IoSockSuite")
+set_tests_properties(net::IoSockSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(net::RateLimitSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "RateLimitSuite")
+set_tests_properties(net::RateLimitSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(net::ResolverSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "ResolverSuite")
+set_tests_properties(net::ResolverSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(net::SocketSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "SocketSuite")
+set_tests_properties(net::SocketSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(resp::EncoderSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "EncoderSuite")
+set_tests_properties(resp::EncoderSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(resp::ParserSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "ParserSuite")
+set_tests_properties(resp::ParserSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(resp::RespClntSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "RespClntSuite")
+set_tests_properties(resp::RespClntSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(sys::DateSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "DateSuite")
+set_tests_properties(sys::DateSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(sys::LogSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "LogSuite")
+set_tests_properties(sys::LogSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(sys::ThreadSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "ThreadSuite")
+set_tests_properties(sys::ThreadSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(sys::TimeSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "TimeSuite")
+set_tests_properties(sys::TimeSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(util::AllocatorSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "AllocatorSuite")
+set_tests_properties(util::AllocatorSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(util::ArgvSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "ArgvSuite")
+set_tests_properties(util::ArgvSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(util::ArraySuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "ArraySuite")
+set_tests_properties(util::ArraySuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(util::Base64Suite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "Base64Suite")
+set_tests_properties(util::Base64Suite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(util::ConfigSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "ConfigSuite")
+set_tests_properties(util::ConfigSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(util::EnumSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "EnumSuite")
+set_tests_properties(util::EnumSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(util::ExceptionSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "ExceptionSuite")
+set_tests_properties(util::ExceptionSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(util::FinallySuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "FinallySuite")
+set_tests_properties(util::FinallySuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(util::IntTypesSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "IntTypesSuite")
+set_tests_properties(util::IntTypesSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(util::MathSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "MathSuite")
+set_tests_properties(util::MathSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(util::OptionsSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "OptionsSuite")
+set_tests_properties(util::OptionsSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(util::RefCountSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "RefCountSuite")
+set_tests_properties(util::RefCountSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(util::RingBufferSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "RingBufferSuite")
+set_tests_properties(util::RingBufferSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(util::SlotSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "SlotSuite")
+set_tests_properties(util::SlotSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(util::StreamSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "StreamSuite")
+set_tests_properties(util::StreamSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(util::StringBufSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "StringBufSuite")
+set_tests_properties(util::StringBufSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(util::StreamInserterSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "StreamInserterSuite")
+set_tests_properties(util::StreamInserterSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(util::StringSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "StringSuite")
+set_tests_properties(util::StringSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(util::StructSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "StructSuite")
+set_tests_properties(util::StructSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(util::TokeniserSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "TokeniserSuite")
+set_tests_properties(util::TokeniserSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(util::TraitsSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "TraitsSuite")
+set_tests_properties(util::TraitsSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(util::TransSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "TransSuite")
+set_tests_properties(util::TransSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(util::UtilitySuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "UtilitySuite")
+set_tests_properties(util::UtilitySuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(util::VarSubSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "VarSubSuite")
+set_tests_properties(util::VarSubSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
+add_test(util::VersionSuite "/root/repo/_rel_build/bin/tb-core-test" "-l" "error" "-t" "VersionSuite")
+set_tests_properties(util::VersionSuite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/toolbox/CMakeLists.txt;306;add_test;/root/repo/toolbox/CMakeLists.txt;0;")
@@ -0,0 +1,136 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <toolbox/hdr/Histogram.hpp>
+
+#include <toolbox/bm.hpp>
+
+#include <array>
+#include <iomanip>
+#include <iostream>
+
+// This benchmark compares the record and construction cost of dense and packed histogram storage,
+// and reports the memory used by each for a benchmark-sized histogram. The batch benchmarks report
+// the per-record cost of record_values_batch().
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+constexpr int64_t Lowest{1};
+constexpr int64_t Highest{1'000'000'000};
+constexpr int Significant{5};
+
+/// Latencies in nanoseconds, mostly between 1us and 100us with a tail to 10ms.
+const auto Values = [] {
+    array<int64_t, 1024> values{};
+    uint64_t x{88172645463325252ULL};
+    for (auto& value : values) {
+        // Xorshift.
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        value = 1000 + x % 99'000;
+        if (x % 100 == 0) {
+            value += x % 10'000'000;
+        }
+    }
+    return values;
+}();
+
+void run_record(bm::Context& ctx, CountsStorage storage)
+{
+    Histogram h{Lowest, Highest, Significant, storage};
+    size_t i{0};
+    while (ctx) {
+        for (auto _ : ctx.range(1000)) {
+            bm::do_not_optimise(h.record_value(Values[i++ % Values.size()]));
+        }
+    }
+}
+
+void run_record_batch(bm::Context& ctx, CountsStorage storage)
+{
+    Histogram h{Lowest, Highest, Significant, storage};
+    while (ctx) {
+        const auto range = ctx.range(Values.size());
+        bm::do_not_optimise(h.record_values_batch(Values));
+    }
+}
+
+void run_construct(bm::Context& ctx, CountsStorage storage)
+{
+    while (ctx) {
+        for (auto _ : ctx.range(10)) {
+            Histogram h{Lowest, Highest, Significant, storage};
+            bm::do_not_optimise(h.record_value(Values[0]));
+        }
+    }
+}
+
+void report_memory(ostream& os, CountsStorage storage, const char* name)
+{
+    Histogram h{Lowest, Highest, Significant, storage};
+    const auto empty = h.memory_size();
+    for (const auto value : Values) {
+        h.record_value(value);
+    }
+    os << left << setw(45) << name << right << setw(15) << empty << setw(15) << h.memory_size()
+       << endl;
+}
+
+TOOLBOX_BENCHMARK(hdr_dense_record)
+{
+    run_record(ctx, CountsStorage::Dense);
+}
+
+TOOLBOX_BENCHMARK(hdr_packed_record)
+{
+    run_record(ctx, CountsStorage::Packed);
+}
+
+TOOLBOX_BENCHMARK(hdr_dense_record_batch)
+{
+    run_record_batch(ctx, CountsStorage::Dense);
+}
+
+TOOLBOX_BENCHMARK(hdr_packed_record_batch)
+{
+    run_record_batch(ctx, CountsStorage::Packed);
+}
+
+TOOLBOX_BENCHMARK(hdr_dense_construct)
+{
+    run_construct(ctx, CountsStorage::Dense);
+}
+
+TOOLBOX_BENCHMARK(hdr_packed_construct)
+{
+    run_construct(ctx, CountsStorage::Packed);
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    cout << left << setw(45) << "MEMORY" << right << setw(15) << "EMPTY" << setw(15) << "RECORDED"
+         << endl;
+    cout << setw(75) << setfill('-') << '-' << setfill(' ') << endl;
+    report_memory(cout, CountsStorage::Dense, "hdr_dense");
+    report_memory(cout, CountsStorage::Packed, "hdr_packed");
+    cout << endl;
+    return bm::detail::main(argc, argv);
+}
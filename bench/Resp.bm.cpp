@@ -0,0 +1,112 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <toolbox/resp/Parser.hpp>
+
+#include <toolbox/bm.hpp>
+
+// This benchmark compares the per-character and buffer-at-a-time entry points of the RESP parser.
+
+TOOLBOX_BENCHMARK_MAIN
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+/// A pipelined batch of typical commands.
+const string Commands = [] {
+    string s;
+    for (int i{0}; i < 10; ++i) {
+        s += "*3\r\n$3\r\nSET\r\n$10\r\nsession:42\r\n$64\r\n" + string(64, 'x') + "\r\n";
+        s += "*2\r\n$3\r\nGET\r\n$10\r\nsession:42\r\n";
+    }
+    return s;
+}();
+
+/// A single reply with a large bulk string.
+const string LargeReply = "$4096\r\n" + string(4096, 'x') + "\r\n";
+
+class Parser : public BasicParser<Parser> {
+    friend class BasicParser<Parser>;
+
+  public:
+    void run_put(string_view msg)
+    {
+        for (const auto c : msg) {
+            put(c);
+        }
+        bm::do_not_optimise(total_);
+    }
+    void run_parse(string_view msg)
+    {
+        const auto n = parse({msg.data(), msg.size()});
+        bm::do_not_optimise(n);
+        bm::do_not_optimise(total_);
+    }
+
+  private:
+    void on_resp_command_line(string_view line) { total_ += line.size(); }
+    void on_resp_string(string_view s) { total_ += s.size(); }
+    void on_resp_error(string_view e) { total_ += e.size(); }
+    void on_resp_integer(int64_t i) { total_ += i; }
+    void on_resp_array_begin(int n) { total_ += n; }
+    void on_resp_array_end() {}
+    void on_resp_reset() noexcept {}
+
+    size_t total_{0};
+};
+
+TOOLBOX_BENCHMARK(resp_put_commands)
+{
+    Parser p;
+    while (ctx) {
+        for (auto _ : ctx.range(1000)) {
+            p.run_put(Commands);
+        }
+    }
+}
+
+TOOLBOX_BENCHMARK(resp_parse_commands)
+{
+    Parser p;
+    while (ctx) {
+        for (auto _ : ctx.range(1000)) {
+            p.run_parse(Commands);
+        }
+    }
+}
+
+TOOLBOX_BENCHMARK(resp_put_large_reply)
+{
+    Parser p;
+    while (ctx) {
+        for (auto _ : ctx.range(1000)) {
+            p.run_put(LargeReply);
+        }
+    }
+}
+
+TOOLBOX_BENCHMARK(resp_parse_large_reply)
+{
+    Parser p;
+    while (ctx) {
+        for (auto _ : ctx.range(1000)) {
+            p.run_parse(LargeReply);
+        }
+    }
+}
+
+} // namespace
@@ -0,0 +1,138 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <toolbox/hdr.hpp>
+#include <toolbox/http.hpp>
+#include <toolbox/net.hpp>
+#include <toolbox/sys.hpp>
+#include <toolbox/util.hpp>
+
+// A pipelined HTTP load generator. Each batch of requests is written in a single call, and the
+// round-trip time of the batch is recorded once all of its responses have been received. For
+// example, run the following against tb-http-serv:
+//
+//   tb-http-load -n 1000000 -d 64 tcp4://127.0.0.1:8888
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+class ResponseCounter : public BasicParser<ResponseCounter> {
+    friend class BasicParser<ResponseCounter>;
+
+  public:
+    ResponseCounter()
+    : BasicParser<ResponseCounter>{Type::Response}
+    {
+    }
+    using BasicParser<ResponseCounter>::parse;
+
+    int count() const noexcept { return count_; }
+    void clear() noexcept { count_ = 0; }
+
+  private:
+    bool on_http_message_begin(CyclTime now) noexcept { return true; }
+    bool on_http_url(CyclTime now, string_view sv) noexcept { return true; }
+    bool on_http_status(CyclTime now, string_view sv) noexcept { return true; }
+    bool on_http_header_field(CyclTime now, string_view sv, First first) noexcept { return true; }
+    bool on_http_header_value(CyclTime now, string_view sv, First first) noexcept { return true; }
+    bool on_http_headers_end(CyclTime now) noexcept { return true; }
+    bool on_http_body(CyclTime now, string_view sv) noexcept { return true; }
+    bool on_http_message_end(CyclTime now) noexcept
+    {
+        ++count_;
+        return true;
+    }
+    bool on_http_chunk_header(CyclTime now, size_t len) noexcept { return true; }
+    bool on_http_chunk_end(CyclTime now) noexcept { return true; }
+
+    int count_{0};
+};
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    int ret = 1;
+    try {
+
+        string uri{"tcp4://127.0.0.1:8888"};
+        string path{"/foo"};
+        int64_t total{100000};
+        int depth{16};
+
+        Options opts{"Usage: tb-http-load [OPTIONS] [URI]"};
+        // clang-format off
+        opts('n', "requests", Value{total}, "Total number of requests")
+            ('d', "depth", Value{depth}, "Number of pipelined requests per batch")
+            ('p', "path", Value{path}, "Request path")
+            (Value{uri}, "Server endpoint");
+        // clang-format on
+        opts.parse(argc, argv);
+        if (depth <= 0 || total <= 0) {
+            throw runtime_error{"invalid options"};
+        }
+
+        string req;
+        for (int i{0}; i < depth; ++i) {
+            req += "GET " + path + " HTTP/1.1\r\nHost: localhost\r\n\r\n";
+        }
+
+        const auto ep = parse_stream_endpoint(uri);
+        StreamSockClnt sock{ep.protocol()};
+        sock.connect(ep);
+        if (sock.is_ip_family()) {
+            set_tcp_no_delay(sock.get(), true);
+        }
+
+        // Batch round-trip times in nanoseconds.
+        Histogram hist{1, 10'000'000'000, 3};
+        ResponseCounter counter;
+        Buffer in;
+
+        const auto batches = (total + depth - 1) / depth;
+        const auto start = MonoClock::now();
+        for (int64_t i{0}; i < batches; ++i) {
+            const auto t0 = MonoClock::now();
+            for (size_t n{0}; n < req.size();) {
+                n += sock.write({req.data() + n, req.size() - n});
+            }
+            counter.clear();
+            while (counter.count() < depth) {
+                const auto size = sock.read(in.prepare(65536));
+                if (size == 0) {
+                    throw runtime_error{"connection closed by peer"};
+                }
+                in.commit(size);
+                in.consume(counter.parse(CyclTime::current(), in.data()));
+            }
+            hist.record_value((MonoClock::now() - t0).count());
+        }
+        const auto elapsed = chrono::duration<double>(MonoClock::now() - start).count();
+
+        cout << "requests:   " << batches * depth << '\n'
+             << "depth:      " << depth << '\n'
+             << "elapsed:    " << elapsed << "s\n"
+             << "throughput: " << static_cast<int64_t>(batches * depth / elapsed) << " req/s\n"
+             << "batch latency (us):\n"
+             << put_percentiles(hist, 5, 1000.0);
+        ret = 0;
+
+    } catch (const std::exception& e) {
+        TOOLBOX_ERROR << "exception on main thread: " << e.what();
+    }
+    return ret;
+}
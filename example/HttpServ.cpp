@@ -24,23 +24,66 @@ using namespace toolbox;
 
 namespace {
 
-void on_foo(const Request& req, http::OStream& os)
+void on_foo(CyclTime now, const Request& req, const RouteParams& params, http::OStream& os)
 {
+    os.reset(Status::Ok, TextPlain);
     os << "Hello, Foo!";
+    os.commit();
 }
 
-void on_bar(const Request& req, http::OStream& os)
+void on_bar(CyclTime now, const Request& req, const RouteParams& params, http::OStream& os)
 {
+    os.reset(Status::Ok, TextPlain);
     os << "Hello, Bar!";
+    os.commit();
 }
 
+void on_hello(CyclTime now, const Request& req, const RouteParams& params, http::OStream& os)
+{
+    os.reset(Status::Ok, TextPlain);
+    os << "Hello, " << params["name"] << '!';
+    os.commit();
+}
+
+/// Echo each WebSocket message back to the sender.
+class EchoWsApp final : public WsApp {
+  protected:
+    void do_on_ws_open(CyclTime now, WsConn& conn) override
+    {
+        TOOLBOX_INFO << "websocket open: " << conn.endpoint();
+    }
+    void do_on_ws_message(CyclTime now, WsConn& conn, WsOpcode opcode, string_view data) override
+    {
+        conn.send(now, opcode, data);
+    }
+    void do_on_ws_close(CyclTime now, WsConn& conn) noexcept override
+    {
+        TOOLBOX_INFO << "websocket close: " << conn.endpoint();
+    }
+};
+
 class ExampleApp final : public App {
   public:
-    using Slot = BasicSlot<const Request&, http::OStream&>;
-    using SlotMap = RobinMap<std::string, Slot>;
-
+    ExampleApp()
+    {
+        // Compress bodies of 1KiB or more for clients that accept it.
+        const CompressOptions copts{.threshold = 1024, .level = 6};
+        cache_.set_compression(copts);
+        set_compression(copts);
+        set_response_cache(&cache_);
+        set_ws_app(&ws_app_);
+        metrics_app_.mount(router_);
+    }
     ~ExampleApp() override = default;
-    void bind(const std::string& path, Slot slot) { slot_map_[path] = slot; }
+    void route(Method method, string_view pattern, Router::Handler handler)
+    {
+        router_.add(method, pattern, handler);
+    }
+    /// Static responses are served from the cache without calling do_on_http_message().
+    void bind_static(const std::string& path, std::string_view body)
+    {
+        cache_.insert(Method::Get, path, Status::Ok, TextPlain, body);
+    }
 
   protected:
     void do_on_http_connect(CyclTime now, const Endpoint& ep) noexcept override
@@ -56,18 +99,35 @@ class ExampleApp final : public App {
     {
         TOOLBOX_ERROR << "http session error: " << ep << ": " << e.what();
     }
+    bool do_on_http_headers(CyclTime now, const Endpoint& ep, const Request& req) override
+    {
+        // Stream uploads rather than buffering them in the request.
+        upload_size_ = 0;
+        return req.path() == "/upload";
+    }
+    size_t do_on_http_body_chunk(CyclTime now, const Endpoint& ep, const Request& req,
+                                 string_view data, http::OStream& os) override
+    {
+        upload_size_ += data.size();
+        return data.size();
+    }
+    void do_on_http_message_end(CyclTime now, const Endpoint& ep, const Request& req,
+                                http::OStream& os) override
+    {
+        os.reset(Status::Ok, TextPlain);
+        os << "Received " << upload_size_ << " bytes";
+        os.commit();
+    }
     void do_on_http_message(CyclTime now, const Endpoint& ep, const Request& req,
                             http::OStream& os) override
     {
-        const auto it = slot_map_.find(string{req.path()});
-        if (it != slot_map_.end()) {
-            os.reset(Status::Ok, TextPlain);
-            it->second(req, os);
-        } else {
-            os.reset(Status::NotFound, TextPlain);
-            os << "Error 404 - Page not found";
+        requests_.inc();
+        const auto status = router_.dispatch(now, req, os);
+        if (status != Status::Ok) {
+            os.reset(status, TextPlain);
+            os << "Error " << status << " - " << enum_string(status);
+            os.commit();
         }
-        os.commit();
     }
     void do_on_http_timeout(CyclTime now, const Endpoint& ep) noexcept override
     {
@@ -75,7 +135,13 @@ class ExampleApp final : public App {
     }
 
   private:
-    SlotMap slot_map_;
+    ResponseCache cache_;
+    EchoWsApp ws_app_;
+    Router router_;
+    MetricRegistry metrics_;
+    Counter& requests_{metrics_.counter("http_requests_total", "Requests dispatched to the router.")};
+    MetricsApp metrics_app_{metrics_};
+    size_t upload_size_{0};
 };
 
 } // namespace
@@ -89,8 +155,10 @@ int main(int argc, char* argv[])
 
         Reactor reactor{1024};
         ExampleApp app;
-        app.bind("/foo", bind<on_foo>());
-        app.bind("/bar", bind<on_bar>());
+        app.route(Method::Get, "/foo", bind<on_foo>());
+        app.route(Method::Get, "/bar", bind<on_bar>());
+        app.route(Method::Get, "/hello/:name", bind<on_hello>());
+        app.bind_static("/health", "OK");
 
         const TcpEndpoint ep{TcpProtocol::v4(), 8888};
         Serv http_serv{start_time, reactor, ep, app};
@@ -0,0 +1,228 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <toolbox/hdr.hpp>
+#include <toolbox/net.hpp>
+#include <toolbox/resp.hpp>
+#include <toolbox/sys.hpp>
+#include <toolbox/util.hpp>
+
+#include <iostream>
+#include <random>
+
+#include <poll.h>
+
+// A pipelined RESP load generator. Each round writes a batch of SET and GET commands to every
+// shard, and the round-trip time of the round is recorded once all of the replies have been
+// received. Keys are routed to shards by key number modulo the number of shards. For example, run
+// the following against tb-resp-serv:
+//
+//   tb-resp-load -n 1000000 -d 64 -r 20
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+class ReplyCounter : public BasicParser<ReplyCounter> {
+    friend class BasicParser<ReplyCounter>;
+
+  public:
+    using BasicParser<ReplyCounter>::parse;
+
+    int count() const noexcept { return count_; }
+    int64_t errors() const noexcept { return errors_; }
+    void clear() noexcept { count_ = 0; }
+
+  private:
+    void on_resp_command_line(string_view line) { throw resp::Exception{"invalid reply"}; }
+    void on_resp_string(string_view s) { on_value(); }
+    void on_resp_error(string_view e)
+    {
+        ++errors_;
+        on_value();
+    }
+    void on_resp_integer(int64_t i) { on_value(); }
+    void on_resp_array_begin(int n) { ++depth_; }
+    void on_resp_array_end()
+    {
+        --depth_;
+        on_value();
+    }
+    void on_resp_reset() noexcept { depth_ = 0; }
+    void on_value() noexcept
+    {
+        if (depth_ == 0) {
+            ++count_;
+        }
+    }
+
+    int count_{0}, depth_{0};
+    int64_t errors_{0};
+};
+
+struct Shard {
+    explicit Shard(const StreamEndpoint& ep)
+    : sock{ep.protocol()}
+    {
+        sock.connect(ep);
+        if (sock.is_ip_family()) {
+            set_tcp_no_delay(sock.get(), true);
+        }
+    }
+    StreamSockClnt sock;
+    Buffer in, out;
+    resp::Encoder enc{out};
+    ReplyCounter counter;
+};
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    int ret = 1;
+    try {
+
+        string addr{"127.0.0.1"};
+        int port{6379};
+        int shards{1};
+        int64_t total{100000};
+        int depth{16};
+        int64_t keys{100000};
+        int size{16};
+        int ratio{50};
+
+        Options opts{"Usage: tb-resp-load [OPTIONS]"};
+        // clang-format off
+        opts('a', "addr", Value{addr}, "Server address")
+            ('p', "port", Value{port}, "Base port")
+            ('s', "shards", Value{shards}, "Number of shards on consecutive ports")
+            ('n', "commands", Value{total}, "Total number of commands")
+            ('d', "depth", Value{depth}, "Number of pipelined commands per batch")
+            ('k', "keys", Value{keys}, "Number of distinct keys")
+            ('v', "size", Value{size}, "Value size in bytes")
+            ('r', "ratio", Value{ratio}, "Percentage of commands that are SET");
+        // clang-format on
+        opts.parse(argc, argv);
+        if (depth <= 0 || total <= 0 || shards <= 0 || keys < shards || size < 0 || ratio < 0
+            || ratio > 100) {
+            throw runtime_error{"invalid options"};
+        }
+
+        vector<unique_ptr<Shard>> shard_list;
+        for (int i{0}; i < shards; ++i) {
+            const auto uri = "tcp4://" + addr + ':' + to_string(port + i);
+            shard_list.push_back(make_unique<Shard>(parse_stream_endpoint(uri)));
+        }
+
+        const string value(size, 'x');
+        minstd_rand rng{1};
+        uniform_int_distribution<int64_t> key_dist{0, keys / shards - 1};
+        uniform_int_distribution<int> op_dist{0, 99};
+        string key;
+
+        // Round-trip times in nanoseconds.
+        Histogram hist{1, 10'000'000'000, 3};
+
+        vector<pollfd> fds(shards);
+        const int64_t per_round{static_cast<int64_t>(depth) * shards};
+        const auto rounds = (total + per_round - 1) / per_round;
+        const auto start = MonoClock::now();
+        for (int64_t i{0}; i < rounds; ++i) {
+            for (int s{0}; s < shards; ++s) {
+                auto& shard = *shard_list[s];
+                for (int j{0}; j < depth; ++j) {
+                    key = "key:";
+                    key += to_string(key_dist(rng) * shards + s);
+                    if (op_dist(rng) < ratio) {
+                        shard.enc.put("SET", string_view{key}, string_view{value});
+                    } else {
+                        shard.enc.put("GET", string_view{key});
+                    }
+                }
+            }
+            const auto t0 = MonoClock::now();
+            for (auto& shard : shard_list) {
+                shard->counter.clear();
+            }
+            // Replies are read while the batch is being written, because the server stops reading
+            // while its output is blocked, so a large batch would otherwise deadlock.
+            for (;;) {
+                bool done{true};
+                for (int s{0}; s < shards; ++s) {
+                    const auto& shard = *shard_list[s];
+                    short events{0};
+                    if (!shard.out.empty()) {
+                        events |= POLLOUT;
+                    }
+                    if (shard.counter.count() < depth) {
+                        events |= POLLIN;
+                    }
+                    fds[s] = {shard.sock.get(), events, 0};
+                    done = done && events == 0;
+                }
+                if (done) {
+                    break;
+                }
+                if (::poll(fds.data(), fds.size(), -1) < 0) {
+                    throw system_error{error_code{errno, system_category()}, "poll"};
+                }
+                for (int s{0}; s < shards; ++s) {
+                    auto& shard = *shard_list[s];
+                    if (fds[s].revents & POLLOUT) {
+                        error_code ec;
+                        const auto size = shard.sock.send(shard.out.data(), MSG_DONTWAIT, ec);
+                        if (ec) {
+                            if (ec != errc::operation_would_block) {
+                                throw system_error{ec, "send"};
+                            }
+                        } else {
+                            shard.out.consume(size);
+                        }
+                    }
+                    if (fds[s].revents & (POLLIN | POLLHUP | POLLERR)) {
+                        const auto size = shard.sock.read(shard.in.prepare(65536));
+                        if (size == 0) {
+                            throw runtime_error{"connection closed by peer"};
+                        }
+                        shard.in.commit(size);
+                        shard.in.consume(shard.counter.parse(shard.in.data()));
+                    }
+                }
+            }
+            hist.record_value((MonoClock::now() - t0).count());
+        }
+        const auto elapsed = chrono::duration<double>(MonoClock::now() - start).count();
+
+        int64_t errors{0};
+        for (const auto& shard : shard_list) {
+            errors += shard->counter.errors();
+        }
+        cout << "commands:   " << rounds * per_round << '\n'
+             << "shards:     " << shards << '\n'
+             << "depth:      " << depth << '\n'
+             << "errors:     " << errors << '\n'
+             << "elapsed:    " << elapsed << "s\n"
+             << "throughput: " << static_cast<int64_t>(rounds * per_round / elapsed)
+             << " cmd/s\n"
+             << "round latency (us):\n"
+             << put_percentiles(hist, 5, 1000.0);
+        ret = 0;
+
+    } catch (const std::exception& e) {
+        TOOLBOX_ERROR << "exception on main thread: " << e.what();
+    }
+    return ret;
+}
@@ -0,0 +1,404 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <toolbox/io.hpp>
+#include <toolbox/net.hpp>
+#include <toolbox/resp.hpp>
+#include <toolbox/sys.hpp>
+#include <toolbox/util.hpp>
+
+#include <charconv>
+
+// An in-memory key-value server that speaks enough RESP for GET, SET, DEL, INCR and MGET. Each
+// shard runs its own reactor thread with a private keyspace, and listens on consecutive ports
+// starting at the base port. Clients must therefore route keys to shards themselves. For example:
+//
+//   tb-resp-serv -s 2
+//   tb-resp-load -s 2 -n 1000000 -d 64
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+constexpr auto IdleTimeout = 60s;
+
+/// Heterogeneous lookup, so that reads do not allocate.
+struct KeyHash {
+    using is_transparent = void;
+    size_t operator()(string_view key) const noexcept
+    {
+        return robin_hood::hash_bytes(key.data(), key.size());
+    }
+};
+
+struct KeyEqual {
+    using is_transparent = void;
+    bool operator()(string_view lhs, string_view rhs) const noexcept { return lhs == rhs; }
+};
+
+using Store = RobinFlatMap<string, string, KeyHash, KeyEqual>;
+
+class RespConn : BasicParser<RespConn> {
+
+    friend class BasicParser<RespConn>;
+    // Automatically unlink when object is destroyed.
+    using AutoUnlinkOption = boost::intrusive::link_mode<boost::intrusive::auto_unlink>;
+
+  public:
+    RespConn(CyclTime now, Reactor& r, IoSock&& sock, const StreamEndpoint& ep, Store& store)
+    : reactor_{r}
+    , sock_{std::move(sock)}
+    , ep_{ep}
+    , store_{store}
+    {
+        sub_ = r.subscribe(*sock_, EpollIn, bind<&RespConn::on_io_event>(this));
+        schedule_timer(now);
+    }
+    void dispose(CyclTime now) noexcept
+    {
+        TOOLBOX_INFO << "connection closed: " << ep_;
+        delete this;
+    }
+    boost::intrusive::list_member_hook<AutoUnlinkOption> list_hook;
+
+  private:
+    ~RespConn() = default;
+    void on_io_event(CyclTime now, int fd, unsigned events)
+    {
+        try {
+            if ((events & EpollHup) && write_blocked_) {
+                // The peer has hung up, so the blocked replies can never be delivered.
+                dispose(now);
+                return;
+            }
+            // Input is not polled while replies are blocked, so that a client cannot grow the
+            // output buffer without limit.
+            if (!write_blocked_ && (events & (EpollIn | EpollHup))) {
+                const auto size = os::read(fd, in_.prepare(65536));
+                if (size == 0) {
+                    dispose(now);
+                    return;
+                }
+                // Commit actual bytes read.
+                in_.commit(size);
+                // The replies to all of the commands that were read are written together.
+                in_.consume(parse(in_.data()));
+                schedule_timer(now);
+            } else if (!(events & EpollOut)) {
+                return;
+            }
+            flush_output();
+        } catch (const resp::Exception& e) {
+            TOOLBOX_ERROR << "protocol error: " << ep_ << ": " << e.what();
+            dispose(now);
+        } catch (const std::exception& e) {
+            TOOLBOX_ERROR << "exception on input: " << ep_ << ": " << e.what();
+            dispose(now);
+        }
+    }
+    void on_timer(CyclTime now, Timer& tmr)
+    {
+        TOOLBOX_INFO << "timeout: " << ep_;
+        dispose(now);
+    }
+    void on_resp_command_line(string_view line)
+    {
+        // Inline commands, as typed into telnet.
+        argc_ = 0;
+        for (;;) {
+            const auto pos = line.find_first_not_of(' ');
+            if (pos == string_view::npos) {
+                break;
+            }
+            line.remove_prefix(pos);
+            const auto end = min(line.find(' '), line.size());
+            put_arg(line.substr(0, end));
+            line.remove_prefix(end);
+        }
+        if (argc_ > 0) {
+            execute();
+        }
+    }
+    void on_resp_string(string_view s)
+    {
+        if (depth_ != 1) {
+            throw resp::Exception{"expected array of bulk strings"};
+        }
+        put_arg(s);
+    }
+    void on_resp_error(string_view e) { throw resp::Exception{"expected array of bulk strings"}; }
+    void on_resp_integer(int64_t i) { throw resp::Exception{"expected array of bulk strings"}; }
+    void on_resp_array_begin(int n)
+    {
+        if (++depth_ > 1) {
+            throw resp::Exception{"expected array of bulk strings"};
+        }
+        argc_ = 0;
+    }
+    void on_resp_array_end()
+    {
+        --depth_;
+        if (argc_ > 0) {
+            execute();
+        }
+    }
+    void on_resp_reset() noexcept
+    {
+        depth_ = 0;
+        argc_ = 0;
+    }
+    void put_arg(string_view sv)
+    {
+        // Argument strings are reused from one command to the next.
+        if (argc_ == args_.size()) {
+            args_.emplace_back(sv);
+        } else {
+            args_[argc_].assign(sv);
+        }
+        ++argc_;
+    }
+    void execute()
+    {
+        const string_view cmd{args_[0]};
+        if (iequals(cmd, "GET")) {
+            if (check_args(2, 2)) {
+                put_value(args_[1]);
+            }
+        } else if (iequals(cmd, "SET")) {
+            if (check_args(3, 3)) {
+                if (auto it = store_.find(args_[1]); it != store_.end()) {
+                    it->second.assign(args_[2]);
+                } else {
+                    store_.emplace(args_[1], args_[2]);
+                }
+                enc_.put_simple("OK");
+            }
+        } else if (iequals(cmd, "DEL")) {
+            if (check_args(2, argc_)) {
+                int64_t n{0};
+                for (size_t i{1}; i < argc_; ++i) {
+                    n += store_.erase(args_[i]);
+                }
+                enc_.put_integer(n);
+            }
+        } else if (iequals(cmd, "INCR")) {
+            if (check_args(2, 2)) {
+                incr(args_[1]);
+            }
+        } else if (iequals(cmd, "MGET")) {
+            if (check_args(2, argc_)) {
+                enc_.put_array(argc_ - 1);
+                for (size_t i{1}; i < argc_; ++i) {
+                    put_value(args_[i]);
+                }
+            }
+        } else if (iequals(cmd, "PING")) {
+            if (check_args(1, 2)) {
+                argc_ == 1 ? enc_.put_simple("PONG") : enc_.put_bulk(string_view{args_[1]});
+            }
+        } else if (iequals(cmd, "CONFIG")) {
+            // redis-benchmark queries the configuration on startup.
+            enc_.put_array(0);
+        } else {
+            enc_.put_error("ERR unknown command");
+        }
+    }
+    bool check_args(size_t min_args, size_t max_args)
+    {
+        if (argc_ < min_args || argc_ > max_args) {
+            enc_.put_error("ERR wrong number of arguments");
+            return false;
+        }
+        return true;
+    }
+    void put_value(string_view key)
+    {
+        if (const auto it = store_.find(key); it != store_.end()) {
+            enc_.put_bulk(string_view{it->second});
+        } else {
+            enc_.put_null();
+        }
+    }
+    void incr(string_view key)
+    {
+        int64_t val{0};
+        auto it = store_.find(key);
+        if (it != store_.end()) {
+            const auto& s = it->second;
+            const auto [end, ec] = from_chars(s.data(), s.data() + s.size(), val);
+            if (ec != errc{} || end != s.data() + s.size() || val == INT64_MAX) {
+                enc_.put_error("ERR value is not an integer or out of range");
+                return;
+            }
+        } else {
+            it = store_.emplace(string{key}, string{}).first;
+        }
+        ++val;
+        char buf[20];
+        const auto* const end = to_chars(buf, buf + sizeof(buf), val).ptr;
+        it->second.assign(buf, end - buf);
+        enc_.put_integer(val);
+    }
+    void flush_output()
+    {
+        if (out_.empty()) {
+            return;
+        }
+        error_code ec;
+        // Report a closed connection as an error rather than raising SIGPIPE.
+        const auto size = sock_.send(out_.data(), MSG_NOSIGNAL, ec);
+        if (ec) {
+            if (ec != errc::operation_would_block) {
+                throw system_error{ec, "write"};
+            }
+        } else {
+            out_.consume(size);
+        }
+        const bool blocked{!out_.empty()};
+        if (blocked != write_blocked_) {
+            // Poll for writability instead of input until the output buffer has been drained.
+            // Input would otherwise remain readable, and a level-triggered reactor would spin.
+            sub_.set_events(blocked ? EpollOut : EpollIn);
+            write_blocked_ = blocked;
+        }
+    }
+    void schedule_timer(CyclTime now)
+    {
+        tmr_ = reactor_.timer(now.mono_time() + IdleTimeout, Priority::Low,
+                              bind<&RespConn::on_timer>(this));
+    }
+
+    Reactor& reactor_;
+    IoSock sock_;
+    const StreamEndpoint ep_;
+    Store& store_;
+    Reactor::Handle sub_;
+    Timer tmr_;
+    Buffer in_, out_;
+    resp::Encoder enc_{out_};
+    vector<string> args_;
+    size_t argc_{0};
+    int depth_{0};
+    bool write_blocked_{false};
+};
+
+class RespServ : public StreamAcceptor<RespServ> {
+
+    friend StreamAcceptor<RespServ>;
+    using ConstantTimeSizeOption = boost::intrusive::constant_time_size<false>;
+    using MemberHookOption = boost::intrusive::member_hook<RespConn, decltype(RespConn::list_hook),
+                                                           &RespConn::list_hook>;
+    using ConnList = boost::intrusive::list<RespConn, ConstantTimeSizeOption, MemberHookOption>;
+
+  public:
+    RespServ(CyclTime now, Reactor& r, const Endpoint& ep)
+    : StreamAcceptor{r, ep}
+    , reactor_{r}
+    {
+    }
+    ~RespServ()
+    {
+        const auto now = CyclTime::current();
+        conn_list_.clear_and_dispose([now](auto* conn) { conn->dispose(now); });
+    }
+
+  private:
+    void on_sock_prepare(CyclTime now, IoSock& sock) {}
+    void on_sock_accept(CyclTime now, IoSock&& sock, const Endpoint& ep)
+    {
+        TOOLBOX_INFO << "connection opened: " << ep;
+        auto* const conn = new RespConn{now, reactor_, std::move(sock), ep, store_};
+        conn_list_.push_back(*conn);
+    }
+    Reactor& reactor_;
+    /// The keyspace is private to the shard, so that no locking is required.
+    Store store_;
+    // List of active connections.
+    ConnList conn_list_;
+};
+
+struct Shard {
+    Shard(CyclTime now, const TcpEndpoint& ep)
+    : serv{now, reactor, ep}
+    {
+    }
+    Reactor reactor{1024};
+    RespServ serv;
+};
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    int ret = 1;
+    try {
+
+        int port{6379};
+        int shards{1};
+
+        Options opts{"Usage: tb-resp-serv [OPTIONS]"};
+        // clang-format off
+        opts('p', "port", Value{port}, "Base port")
+            ('s', "shards", Value{shards}, "Number of shards, each with its own reactor thread");
+        // clang-format on
+        opts.parse(argc, argv);
+        if (shards <= 0 || port <= 0 || port + shards > 65536) {
+            throw runtime_error{"invalid options"};
+        }
+
+        const auto start_time = CyclTime::now();
+
+        vector<unique_ptr<Shard>> shard_list;
+        for (int i{0}; i < shards; ++i) {
+            const TcpEndpoint ep{TcpProtocol::v4(), static_cast<unsigned short>(port + i)};
+            shard_list.push_back(make_unique<Shard>(start_time, ep));
+            TOOLBOX_INFO << "shard " << i << " listening on " << ep;
+        }
+
+        // Start service threads. The runners are stopped before the shards are destroyed.
+        pthread_setname_np(pthread_self(), "main");
+        vector<unique_ptr<ReactorRunner>> runners;
+        for (int i{0}; i < shards; ++i) {
+            runners.push_back(make_unique<ReactorRunner>(shard_list[i]->reactor, 100,
+                                                         "shard" + to_string(i)));
+        }
+
+        // Wait for termination.
+        SigWait sig_wait;
+        for (;;) {
+            switch (const auto sig = sig_wait()) {
+            case SIGHUP:
+                TOOLBOX_INFO << "received SIGHUP";
+                continue;
+            case SIGINT:
+                TOOLBOX_INFO << "received SIGINT";
+                break;
+            case SIGTERM:
+                TOOLBOX_INFO << "received SIGTERM";
+                break;
+            default:
+                TOOLBOX_INFO << "received signal: " << sig;
+                continue;
+            }
+            break;
+        }
+        ret = 0;
+
+    } catch (const std::exception& e) {
+        TOOLBOX_ERROR << "exception on main thread: " << e.what();
+    }
+    return ret;
+}
@@ -32,7 +32,7 @@ class TOOLBOX_API BenchmarkSuite {
         using namespace std::literals::chrono_literals;
         constexpr auto duration = 3s;
 
-        Histogram hist{1, 1'000'000'000, 5};
+        Histogram hist{1, 1'000'000'000, 5, CountsStorage::Packed};
         Context ctx{hist};
         Alarm alarm{duration, [&ctx]() { ctx.stop(); }};
         fn(ctx);
@@ -16,8 +16,12 @@
 #ifndef TOOLBOX_HDR_HPP
 #define TOOLBOX_HDR_HPP
 
+#include "hdr/Encoding.hpp"
 #include "hdr/Histogram.hpp"
+#include "hdr/IntervalLog.hpp"
 #include "hdr/Iterator.hpp"
+#include "hdr/PackedCounts.hpp"
+#include "hdr/Recorder.hpp"
 #include "hdr/Utility.hpp"
 
 #endif // TOOLBOX_HDR_HPP
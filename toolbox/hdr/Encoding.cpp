@@ -0,0 +1,249 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Encoding.hpp"
+
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include <zlib.h>
+
+namespace toolbox {
+inline namespace hdr {
+using namespace std;
+namespace {
+
+/// Size of the uncompressed V2 header.
+constexpr size_t HeaderSize{40};
+/// Size of the compressed V2 header.
+constexpr size_t CompressedHeaderSize{8};
+/// The maximum size of a ZigZag LEB128 encoded value.
+constexpr size_t MaxVarIntSize{9};
+
+/// The cookie base excludes the word size bits.
+constexpr int32_t cookie_base(int32_t cookie) noexcept
+{
+    return cookie & ~0xf0;
+}
+
+template <typename ValueT>
+void put_be(string& out, ValueT val)
+{
+    uint64_t n;
+    if constexpr (is_floating_point_v<ValueT>) {
+        static_assert(sizeof(ValueT) == sizeof(n));
+        memcpy(&n, &val, sizeof(n));
+    } else {
+        n = static_cast<uint64_t>(val);
+    }
+    for (int i{static_cast<int>(sizeof(ValueT)) - 1}; i >= 0; --i) {
+        out += static_cast<char>((n >> (i * 8)) & 0xff);
+    }
+}
+
+template <typename ValueT>
+ValueT get_be(const char* in) noexcept
+{
+    uint64_t n{0};
+    for (size_t i{0}; i < sizeof(ValueT); ++i) {
+        n = (n << 8) | static_cast<unsigned char>(in[i]);
+    }
+    if constexpr (is_floating_point_v<ValueT>) {
+        ValueT val;
+        memcpy(&val, &n, sizeof(val));
+        return val;
+    } else {
+        return static_cast<ValueT>(n);
+    }
+}
+
+void put_be32_at(string& out, size_t pos, int32_t val) noexcept
+{
+    const auto n = static_cast<uint32_t>(val);
+    for (int i{0}; i < 4; ++i) {
+        out[pos + i] = static_cast<char>((n >> ((3 - i) * 8)) & 0xff);
+    }
+}
+
+/// Appends the value with ZigZag LEB128 encoding. The ninth byte, if any, holds the final eight
+/// bits, so that the encoding never exceeds nine bytes.
+void put_var_int(string& out, int64_t val)
+{
+    uint64_t n{(static_cast<uint64_t>(val) << 1) ^ static_cast<uint64_t>(val >> 63)};
+    char buf[MaxVarIntSize];
+    size_t len{0};
+    while (len < 8 && n >= 0x80) {
+        buf[len++] = static_cast<char>((n & 0x7f) | 0x80);
+        n >>= 7;
+    }
+    buf[len++] = static_cast<char>(n);
+    out.append(buf, len);
+}
+
+/// Returns the decoded value, and advances the input.
+int64_t get_var_int(const char*& it, const char* end)
+{
+    uint64_t n{0};
+    for (int shift{0};; shift += 7) {
+        if (it == end) {
+            throw invalid_argument{"truncated histogram encoding"};
+        }
+        const auto b = static_cast<unsigned char>(*it++);
+        if (shift == 56) {
+            n |= uint64_t{b} << 56;
+            break;
+        }
+        n |= uint64_t{b & 0x7fU} << shift;
+        if ((b & 0x80) == 0) {
+            break;
+        }
+    }
+    return static_cast<int64_t>(n >> 1) ^ -static_cast<int64_t>(n & 1);
+}
+
+void inflate_all(string_view in, string& out)
+{
+    z_stream zs{};
+    if (inflateInit(&zs) != Z_OK) {
+        throw runtime_error{"inflateInit failed"};
+    }
+    zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(in.data()));
+    zs.avail_in = static_cast<uInt>(in.size());
+    int rc{Z_OK};
+    do {
+        const auto pos = out.size();
+        out.resize(pos + max<size_t>(in.size() * 4, 4096));
+        zs.next_out = reinterpret_cast<Bytef*>(out.data() + pos);
+        zs.avail_out = static_cast<uInt>(out.size() - pos);
+        rc = inflate(&zs, Z_NO_FLUSH);
+        out.resize(out.size() - zs.avail_out);
+    } while (rc == Z_OK);
+    inflateEnd(&zs);
+    if (rc != Z_STREAM_END) {
+        throw invalid_argument{"invalid compressed histogram"};
+    }
+}
+
+Histogram decode_uncompressed(string_view in)
+{
+    if (in.size() < HeaderSize || cookie_base(get_be<int32_t>(in.data())) != 0x1c849303) {
+        throw invalid_argument{"unsupported histogram encoding"};
+    }
+    const auto payload_len = get_be<int32_t>(in.data() + 4);
+    // The normalising index offset is ignored, because counts are encoded in logical order.
+    const auto significant_figures = get_be<int32_t>(in.data() + 12);
+    const auto lowest = get_be<int64_t>(in.data() + 16);
+    const auto highest = get_be<int64_t>(in.data() + 24);
+    if (payload_len < 0 || in.size() - HeaderSize < static_cast<size_t>(payload_len)) {
+        throw invalid_argument{"truncated histogram encoding"};
+    }
+
+    Histogram h{lowest, highest, significant_figures};
+    const auto* it = in.data() + HeaderSize;
+    const auto* const end = it + payload_len;
+    int64_t index{0};
+    while (it != end) {
+        const auto count = get_var_int(it, end);
+        if (count < 0) {
+            // A run of empty buckets.
+            if (count < -int64_t{h.counts_len()}) {
+                throw invalid_argument{"histogram encoding exceeds counts length"};
+            }
+            index -= count;
+            continue;
+        }
+        if (index >= h.counts_len()) {
+            throw invalid_argument{"histogram encoding exceeds counts length"};
+        }
+        if (count > 0) {
+            h.record_values(h.value_at_index(static_cast<int32_t>(index)), count);
+        }
+        ++index;
+    }
+    return h;
+}
+
+} // namespace
+
+void encode_histogram(const Histogram& h, string& out)
+{
+    const auto start = out.size();
+    put_be(out, V2EncodingCookie);
+    // The payload length is written when known.
+    put_be(out, int32_t{0});
+    put_be(out, int32_t{0});
+    put_be(out, h.significant_figures());
+    put_be(out, h.lowest_trackable_value());
+    put_be(out, h.highest_trackable_value());
+    put_be(out, 1.0);
+
+    // Counts after the highest non-zero count are not encoded.
+    int32_t limit{h.counts_len()};
+    while (limit > 0 && h.count_at_index(limit - 1) == 0) {
+        --limit;
+    }
+    for (int32_t i{0}; i < limit;) {
+        const auto count = h.count_at_index(i++);
+        if (count == 0) {
+            int64_t zeros{1};
+            while (i < limit && h.count_at_index(i) == 0) {
+                ++zeros;
+                ++i;
+            }
+            put_var_int(out, zeros > 1 ? -zeros : 0);
+        } else {
+            put_var_int(out, count);
+        }
+    }
+    put_be32_at(out, start + 4, static_cast<int32_t>(out.size() - start - HeaderSize));
+}
+
+void encode_compressed_histogram(const Histogram& h, string& out, int level)
+{
+    string raw;
+    encode_histogram(h, raw);
+
+    const auto start = out.size();
+    put_be(out, V2CompressedEncodingCookie);
+    put_be(out, int32_t{0});
+    auto len = compressBound(raw.size());
+    out.resize(start + CompressedHeaderSize + len);
+    if (compress2(reinterpret_cast<Bytef*>(out.data() + start + CompressedHeaderSize), &len,
+                  reinterpret_cast<const Bytef*>(raw.data()), raw.size(), level)
+        != Z_OK) {
+        throw runtime_error{"compress2 failed"};
+    }
+    out.resize(start + CompressedHeaderSize + len);
+    put_be32_at(out, start + 4, static_cast<int32_t>(len));
+}
+
+Histogram decode_histogram(string_view in)
+{
+    if (in.size() >= CompressedHeaderSize
+        && cookie_base(get_be<int32_t>(in.data())) == 0x1c849304) {
+        const auto len = get_be<int32_t>(in.data() + 4);
+        if (len < 0 || in.size() - CompressedHeaderSize < static_cast<size_t>(len)) {
+            throw invalid_argument{"truncated histogram encoding"};
+        }
+        string raw;
+        inflate_all(in.substr(CompressedHeaderSize, len), raw);
+        return decode_uncompressed(raw);
+    }
+    return decode_uncompressed(in);
+}
+
+} // namespace hdr
+} // namespace toolbox
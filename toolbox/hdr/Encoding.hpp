@@ -0,0 +1,60 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_HDR_ENCODING
+#define TOOLBOX_HDR_ENCODING
+
+#include <toolbox/hdr/Histogram.hpp>
+
+#include <string>
+#include <string_view>
+
+namespace toolbox {
+/// A C++ port of HdrHistogram_c written Michael Barker and released to the public domain.
+inline namespace hdr {
+
+/// Cookie of the uncompressed V2 encoding.
+constexpr std::int32_t V2EncodingCookie{0x1c849303 | 0x10};
+/// Cookie of the compressed V2 encoding.
+constexpr std::int32_t V2CompressedEncodingCookie{0x1c849304 | 0x10};
+
+/// Append the uncompressed V2 encoding of the histogram, which is the format used by the Java and
+/// C implementations. The counts are ZigZag LEB128 encoded, with runs of empty buckets encoded as a
+/// single negative count.
+///
+/// \param h The histogram to encode.
+/// \param out The output string.
+TOOLBOX_API void encode_histogram(const Histogram& h, std::string& out);
+
+/// Append the compressed V2 encoding of the histogram, which is the uncompressed encoding
+/// compressed with zlib. The base64 form of this encoding is used in interval logs.
+///
+/// \param h The histogram to encode.
+/// \param out The output string.
+/// \param level The zlib compression level from 1 to 9, or -1 for the default.
+TOOLBOX_API void encode_compressed_histogram(const Histogram& h, std::string& out,
+                                             int level = -1);
+
+/// Decode a histogram from either the compressed or uncompressed V2 encoding.
+///
+/// \param in The encoded histogram.
+/// \return the decoded histogram.
+/// \throws std::invalid_argument if the encoding is invalid or unsupported.
+TOOLBOX_API Histogram decode_histogram(std::string_view in);
+
+} // namespace hdr
+} // namespace toolbox
+
+#endif // TOOLBOX_HDR_ENCODING
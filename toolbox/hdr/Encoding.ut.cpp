@@ -0,0 +1,121 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Encoding.hpp"
+
+#include <toolbox/util/Base64.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+bool equal_counts(const Histogram& lhs, const Histogram& rhs)
+{
+    if (lhs.counts_len() != rhs.counts_len() || lhs.total_count() != rhs.total_count()) {
+        return false;
+    }
+    for (int32_t i{0}; i < lhs.counts_len(); ++i) {
+        if (lhs.count_at_index(i) != rhs.count_at_index(i)) {
+            return false;
+        }
+    }
+    return lhs.min() == rhs.min() && lhs.max() == rhs.max();
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(EncodingSuite)
+
+BOOST_AUTO_TEST_CASE(EncodingLayoutCase)
+{
+    Histogram h{1, 100000, 2};
+    h.record_value(1);
+    string out;
+    encode_histogram(h, out);
+    BOOST_TEST(out.size() == 42U);
+    // Cookie, payload length, normalising index offset and significant figures.
+    BOOST_TEST(out.substr(0, 16) == "\x1c\x84\x93\x13\0\0\0\x02\0\0\0\0\0\0\0\x02"sv);
+    // Lowest and highest trackable values.
+    BOOST_TEST(out.substr(16, 16) == "\0\0\0\0\0\0\0\x01\0\0\0\0\0\x01\x86\xa0"sv);
+    // Conversion ratio of 1.0.
+    BOOST_TEST(out.substr(32, 8) == "\x3f\xf0\0\0\0\0\0\0"sv);
+    // A single zero count, and then a count of one.
+    BOOST_TEST(out.substr(40) == "\x00\x02"sv);
+}
+
+BOOST_AUTO_TEST_CASE(EncodingRoundTripCase)
+{
+    Histogram h{1, 3600'000'000, 3};
+    for (int64_t v{0}; v < 1000000; v += 37) {
+        h.record_value(v);
+    }
+    // Large counts use the full nine bytes.
+    h.record_values(3000'000'000, int64_t{1} << 62);
+
+    string out;
+    encode_histogram(h, out);
+    const auto h2 = decode_histogram(out);
+    BOOST_TEST(h2.lowest_trackable_value() == 1);
+    BOOST_TEST(h2.highest_trackable_value() == 3600'000'000);
+    BOOST_TEST(h2.significant_figures() == 3);
+    BOOST_TEST(equal_counts(h, h2));
+
+    out.clear();
+    encode_compressed_histogram(h, out);
+    BOOST_TEST(out.substr(0, 4) == "\x1c\x84\x93\x14"sv);
+    BOOST_TEST(equal_counts(h, decode_histogram(out)));
+
+    // Empty histograms are encoded without counts.
+    const Histogram empty{1, 1000, 3};
+    out.clear();
+    encode_histogram(empty, out);
+    BOOST_TEST(out.size() == 40U);
+    BOOST_TEST(decode_histogram(out).total_count() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(EncodingLogFormCase)
+{
+    Histogram h{1, 3600'000'000, 3};
+    h.record_value(1000);
+    string out;
+    encode_compressed_histogram(h, out);
+    // Every compressed V2 histogram in an interval log starts with this prefix.
+    BOOST_TEST(base64_encode(out).starts_with("HISTFAAA"));
+}
+
+BOOST_AUTO_TEST_CASE(EncodingInvalidCase)
+{
+    BOOST_CHECK_THROW(decode_histogram(""sv), invalid_argument);
+    BOOST_CHECK_THROW(decode_histogram("not a histogram encoding at all, nope!!"sv),
+                      invalid_argument);
+
+    Histogram h{1, 100000, 2};
+    h.record_values(1000, 1000000);
+    string out;
+    encode_histogram(h, out);
+    // Truncated payload.
+    BOOST_CHECK_THROW(decode_histogram(string_view{out}.substr(0, out.size() - 1)),
+                      invalid_argument);
+
+    out.clear();
+    encode_compressed_histogram(h, out);
+    out[20] ^= 0x55;
+    BOOST_CHECK_THROW(decode_histogram(out), invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -15,7 +15,10 @@
 
 #include "Histogram.hpp"
 
+#include <toolbox/hdr/Iterator.hpp>
+
 #include <cmath>
+#include <new>
 #include <stdexcept>
 
 namespace toolbox {
@@ -23,12 +26,6 @@ inline namespace hdr {
 using namespace std;
 namespace {
 
-// Smallest power of 2 containing value.
-int32_t count_leading_zeros_64(int64_t value) noexcept
-{
-    return __builtin_clzll(value);
-}
-
 int32_t get_sub_bucket_index(int64_t value, int32_t bucket_index, int32_t unit_magnitude) noexcept
 {
     return value >> (bucket_index + unit_magnitude);
@@ -93,7 +90,7 @@ BucketConfig::BucketConfig(int64_t lowest_trackable_value, int64_t highest_track
     }
 }
 
-Histogram::Histogram(const BucketConfig& config)
+Histogram::Histogram(const BucketConfig& config, CountsStorage storage)
 : lowest_trackable_value_{config.lowest_trackable_value}
 , highest_trackable_value_{config.highest_trackable_value}
 , significant_figures_{config.significant_figures}
@@ -103,17 +100,28 @@ Histogram::Histogram(const BucketConfig& config)
 , sub_bucket_half_count_{config.sub_bucket_half_count}
 , sub_bucket_mask_{config.sub_bucket_mask}
 , bucket_count_{config.bucket_count}
+, counts_len_{config.counts_len}
+, storage_{storage}
+, leading_zero_count_base_{64 - unit_magnitude_ - (sub_bucket_half_count_magnitude_ + 1)}
+, max_recordable_value_{0}
+, direct_{storage == CountsStorage::Dense}
 , normalizing_index_offset_{0}
 , min_value_{numeric_limits<int64_t>::max()}
 , max_value_{0}
 , total_count_{0}
 {
-    counts_.resize(config.counts_len);
+    if (storage == CountsStorage::Dense) {
+        counts_.resize(config.counts_len);
+    } else {
+        packed_counts_ = PackedCounts{config.counts_len};
+    }
+    max_recordable_value_ = highest_equivalent_value(value_at_index(counts_len_ - 1));
 }
 
 Histogram::Histogram(int64_t lowest_trackable_value, int64_t highest_trackable_value,
-                     int significant_figures)
-: Histogram{BucketConfig{lowest_trackable_value, highest_trackable_value, significant_figures}}
+                     int significant_figures, CountsStorage storage)
+: Histogram{BucketConfig{lowest_trackable_value, highest_trackable_value, significant_figures},
+            storage}
 {
 }
 
@@ -133,6 +141,14 @@ int64_t Histogram::max() const noexcept
     return highest_equivalent_value(max_value_);
 }
 
+size_t Histogram::memory_size() const noexcept
+{
+    if (storage_ == CountsStorage::Dense) {
+        return counts_.capacity() * sizeof(int64_t);
+    }
+    return packed_counts_.memory_size();
+}
+
 bool Histogram::values_are_equivalent(int64_t a, int64_t b) const noexcept
 {
     return lowest_equivalent_value(a) == lowest_equivalent_value(b);
@@ -193,7 +209,7 @@ int64_t Histogram::median_equivalent_value(int64_t value) const noexcept
 
 int64_t Histogram::counts_get_normalised(int32_t index) const noexcept
 {
-    return counts_[normalize_index(index)];
+    return counts_get(normalize_index(index));
 }
 
 void Histogram::reset() noexcept
@@ -201,28 +217,271 @@ void Histogram::reset() noexcept
     min_value_ = numeric_limits<int64_t>::max();
     max_value_ = 0;
     total_count_ = 0;
+    normalizing_index_offset_ = 0;
+    update_direct();
     fill(counts_.begin(), counts_.end(), 0);
+    packed_counts_.reset();
+}
+
+int64_t Histogram::record_values_batch(span<const int64_t> values) noexcept
+{
+    if (!direct_) {
+        int64_t dropped{0};
+        for (const auto value : values) {
+            dropped += record_value(value) ? 0 : 1;
+        }
+        return dropped;
+    }
+    // Stores to the counts may alias the histogram's members, so copy them to locals that the
+    // compiler can keep in registers.
+    int64_t* const counts{counts_.data()};
+    const auto max_recordable_value = static_cast<uint64_t>(max_recordable_value_);
+    const int64_t sub_bucket_mask{sub_bucket_mask_};
+    const int32_t leading_zero_count_base{leading_zero_count_base_};
+    const int32_t sub_bucket_half_count_magnitude{sub_bucket_half_count_magnitude_};
+    const int32_t unit_magnitude{unit_magnitude_};
+    int64_t min_value{min_value_}, max_value{max_value_}, recorded{0};
+    for (const auto value : values) {
+        if (static_cast<uint64_t>(value) > max_recordable_value) [[unlikely]] {
+            continue;
+        }
+        const int32_t bucket_index{leading_zero_count_base
+                                   - __builtin_clzll(value | sub_bucket_mask)};
+        ++counts[(bucket_index << sub_bucket_half_count_magnitude)
+                 + static_cast<int32_t>(value >> (bucket_index + unit_magnitude))];
+        min_value = std::min(min_value, value != 0 ? value : numeric_limits<int64_t>::max());
+        max_value = std::max(max_value, value);
+        ++recorded;
+    }
+    min_value_ = min_value;
+    max_value_ = max_value;
+    total_count_ += recorded;
+    return static_cast<int64_t>(values.size()) - recorded;
 }
 
-bool Histogram::record_value(int64_t value) noexcept
+int64_t Histogram::add(const Histogram& other) noexcept
 {
-    return record_values(value, 1);
+    if (same_layout(other)) {
+        // Same bucket layout, so counts can be added index by index.
+        int64_t dropped{0};
+        const int32_t len{counts_len()};
+        for (int32_t i{0}; i < len; ++i) {
+            const int64_t count{other.count_at_index(i)};
+            if (count != 0 && !counts_inc_normalised(i, count)) {
+                dropped += count;
+            }
+        }
+        if (dropped > 0) {
+            reset_min_max();
+        } else if (other.total_count_ > 0) {
+            min_value_ = std::min(min_value_, other.min_value_);
+            max_value_ = std::max(max_value_, other.max_value_);
+        }
+        return dropped;
+    }
+    int64_t dropped{0};
+    RecordedIterator it{other};
+    while (it.next()) {
+        if (!record_values(it.value(), it.count())) {
+            dropped += it.count();
+        }
+    }
+    return dropped;
+}
+
+bool Histogram::subtract(const Histogram& other)
+{
+    if (same_layout(other)) {
+        const int32_t len{counts_len()};
+        // Validate before modifying, so that a failed subtraction leaves the histogram unchanged.
+        for (int32_t i{0}; i < len; ++i) {
+            if (count_at_index(i) < other.count_at_index(i)) {
+                return false;
+            }
+        }
+        for (int32_t i{0}; i < len; ++i) {
+            const int64_t count{other.count_at_index(i)};
+            if (count != 0) {
+                // Decrements never allocate.
+                counts_inc_normalised(i, -count);
+            }
+        }
+        reset_min_max();
+        return true;
+    }
+    // Multiple buckets in the other histogram may map to a single bucket in this one, so subtract
+    // from a copy and only commit the result if every count was available.
+    Histogram h{*this};
+    RecordedIterator it{other};
+    while (it.next()) {
+        const int64_t value{it.value()};
+        const int32_t index{h.counts_index_for(value)};
+        if (index < 0 || h.counts_len() <= index || h.count_at_index(index) < it.count()) {
+            return false;
+        }
+        h.counts_inc_normalised(index, -it.count());
+    }
+    h.reset_min_max();
+    *this = move(h);
+    return true;
+}
+
+template <typename FnT>
+bool Histogram::move_counts(FnT fn) noexcept
+{
+    if (storage_ == CountsStorage::Dense) {
+        return fn(*this);
+    }
+    try {
+        Histogram h{*this};
+        if (!fn(h)) {
+            return false;
+        }
+        *this = std::move(h);
+        return true;
+    } catch (const std::bad_alloc&) {
+        return false;
+    }
+}
+
+bool Histogram::shift_values_left(int32_t n) noexcept
+{
+    if (n < 0 || n > bucket_count_) {
+        return false;
+    }
+    if (n == 0 || total_count_ == count_at_index(0)) {
+        return true;
+    }
+    const int32_t len{counts_len()};
+    const int32_t shift{n << sub_bucket_half_count_magnitude_};
+    if (counts_index_for(max_value_) >= len - shift) {
+        return false;
+    }
+    const bool lowest_half_bucket_populated{min_value_
+                                            < (int64_t{sub_bucket_half_count_} << unit_magnitude_)};
+    if (lowest_half_bucket_populated && shift + sub_bucket_half_count_ > len) {
+        return false;
+    }
+
+    return move_counts([n, len, shift, lowest_half_bucket_populated](Histogram& h) noexcept {
+        bool ok{true};
+        const int64_t zero_count{h.count_at_index(0)};
+        h.counts_set(h.normalize_index(0), 0);
+        // Every half bucket above the lowest moves up by the shift, so only the offset needs
+        // adjusting.
+        h.normalizing_index_offset_ = (h.normalizing_index_offset_ + shift) % len;
+        h.update_direct();
+        if (lowest_half_bucket_populated) {
+            // The lowest half bucket has a finer resolution than the others, so each of its counts
+            // must be re-recorded at the new scale. Having moved with the offset, these counts now
+            // sit at shift + i, and each destination index is below its source, so ascending order
+            // never overwrites a count that has yet to be moved.
+            for (int32_t i{1}; i < h.sub_bucket_half_count_; ++i) {
+                const int32_t from{h.normalize_index(shift + i)};
+                const int64_t count{h.counts_get(from)};
+                if (count != 0) {
+                    h.counts_set(from, 0);
+                    const int32_t to{
+                        h.normalize_index(h.counts_index_for(h.value_at_index(i) << n))};
+                    ok = h.counts_set(to, h.counts_get(to) + count) && ok;
+                }
+            }
+        }
+        ok = h.counts_set(h.normalize_index(0), zero_count) && ok;
+
+        h.max_value_ <<= n;
+        if (h.min_value_ != numeric_limits<int64_t>::max()) {
+            h.min_value_ <<= n;
+        }
+        return ok;
+    });
 }
 
-bool Histogram::record_values(int64_t value, int64_t count) noexcept
+bool Histogram::shift_values_right(int32_t n) noexcept
 {
-    if (value < 0) {
+    if (n < 0 || n > bucket_count_) {
         return false;
     }
-    const int32_t counts_index{counts_index_for(value)};
-    if (counts_index < 0 || counts_len() <= counts_index) {
+    if (n == 0 || total_count_ == count_at_index(0)) {
+        return true;
+    }
+    const int32_t len{counts_len()};
+    const int32_t shift{n << sub_bucket_half_count_magnitude_};
+    // Values that would fall into the lowest half bucket cannot be shifted without losing
+    // precision.
+    if (counts_index_for(min_value_) < shift + sub_bucket_half_count_) {
         return false;
     }
-    counts_inc_normalised(counts_index, count);
-    update_min_max(value);
+
+    return move_counts([n, len, shift](Histogram& h) noexcept {
+        const int64_t zero_count{h.count_at_index(0)};
+        h.counts_set(h.normalize_index(0), 0);
+        h.normalizing_index_offset_ = (h.normalizing_index_offset_ - shift + len) % len;
+        h.update_direct();
+        const bool ok{h.counts_set(h.normalize_index(0), zero_count)};
+
+        h.max_value_ >>= n;
+        h.min_value_ >>= n;
+        return ok;
+    });
+}
+
+bool Histogram::record_corrected_value(int64_t value, int64_t expected_interval) noexcept
+{
+    return record_corrected_values(value, 1, expected_interval);
+}
+
+bool Histogram::record_corrected_values(int64_t value, int64_t count,
+                                        int64_t expected_interval) noexcept
+{
+    if (!record_values(value, count)) {
+        return false;
+    }
+    if (expected_interval <= 0) {
+        return true;
+    }
+    for (int64_t missing{value - expected_interval}; missing >= expected_interval;
+         missing -= expected_interval) {
+        if (!record_values(missing, count)) {
+            return false;
+        }
+    }
     return true;
 }
 
+int64_t Histogram::add_corrected(const Histogram& other, int64_t expected_interval) noexcept
+{
+    int64_t dropped{0};
+    RecordedIterator it{other};
+    while (it.next()) {
+        if (!record_corrected_values(it.value(), it.count(), expected_interval)) {
+            dropped += it.count();
+        }
+    }
+    return dropped;
+}
+
+Histogram Histogram::copy_corrected(int64_t expected_interval) const
+{
+    Histogram h{lowest_trackable_value_, highest_trackable_value_, significant_figures_,
+                storage_};
+    h.add_corrected(*this, expected_interval);
+    return h;
+}
+
+int64_t Histogram::add_scaled(const Histogram& other, double ratio) noexcept
+{
+    int64_t dropped{0};
+    RecordedIterator it{other};
+    while (it.next()) {
+        const auto value = llround(other.median_equivalent_value(it.value()) * ratio);
+        if (!record_values(value, it.count())) {
+            dropped += it.count();
+        }
+    }
+    return dropped;
+}
+
 int32_t Histogram::normalize_index(int32_t index) const noexcept
 {
     if (normalizing_index_offset_ == 0) {
@@ -240,53 +499,72 @@ int32_t Histogram::normalize_index(int32_t index) const noexcept
     return normalized_index + adjustment;
 }
 
-int32_t Histogram::get_bucket_index(int64_t value) const noexcept
+int64_t Histogram::non_zero_min() const noexcept
 {
-    // Smallest power of 2 containing value.
-    const int32_t pow2ceiling{64 - count_leading_zeros_64(value | sub_bucket_mask_)};
-    return pow2ceiling - unit_magnitude_ - (sub_bucket_half_count_magnitude_ + 1);
+    if (min_value_ == numeric_limits<int64_t>::max()) {
+        return min_value_;
+    }
+    return lowest_equivalent_value(min_value_);
 }
 
-int32_t Histogram::counts_index(int32_t bucket_index, int32_t sub_bucket_index) const noexcept
+bool Histogram::same_layout(const Histogram& other) const noexcept
 {
-    // Calculate the index for the first entry in the bucket.
-    // The following is the equivalent of ((bucket_index + 1) * subBucketHalfCount)).
-    const int32_t bucket_base_index{(bucket_index + 1) << sub_bucket_half_count_magnitude_};
-    // Calculate the offset in the bucket.
-    const int32_t offset_in_bucket{sub_bucket_index - sub_bucket_half_count_};
-    // The following is the equivalent of
-    //  (sub_bucket_index  - subBucketHalfCount) + bucketBaseIndex).
-    return bucket_base_index + offset_in_bucket;
+    return unit_magnitude_ == other.unit_magnitude_
+        && sub_bucket_half_count_magnitude_ == other.sub_bucket_half_count_magnitude_
+        && counts_len() == other.counts_len();
 }
 
-int32_t Histogram::counts_index_for(int64_t value) const noexcept
+int64_t Histogram::counts_get(int32_t normalised_index) const noexcept
 {
-    const int32_t bucket_index{get_bucket_index(value)};
-    const int32_t sub_bucket_index{get_sub_bucket_index(value, bucket_index, unit_magnitude_)};
-    return counts_index(bucket_index, sub_bucket_index);
+    if (storage_ == CountsStorage::Dense) {
+        return counts_[normalised_index];
+    }
+    return packed_counts_.get(normalised_index);
 }
 
-int64_t Histogram::non_zero_min() const noexcept
+bool Histogram::counts_set(int32_t normalised_index, int64_t value) noexcept
 {
-    if (min_value_ == numeric_limits<int64_t>::max()) {
-        return min_value_;
+    if (storage_ == CountsStorage::Dense) {
+        counts_[normalised_index] = value;
+        return true;
     }
-    return lowest_equivalent_value(min_value_);
+    return packed_counts_.set(normalised_index, value);
 }
 
-void Histogram::counts_inc_normalised(int32_t index, int64_t value) noexcept
+void Histogram::reset_min_max() noexcept
+{
+    min_value_ = numeric_limits<int64_t>::max();
+    max_value_ = 0;
+    const int32_t len{counts_len()};
+    for (int32_t i{1}; i < len; ++i) {
+        if (count_at_index(i) != 0) {
+            min_value_ = value_at_index(i);
+            break;
+        }
+    }
+    for (int32_t i{len - 1}; i > 0; --i) {
+        if (count_at_index(i) != 0) {
+            max_value_ = value_at_index(i);
+            break;
+        }
+    }
+}
+
+bool Histogram::counts_inc_normalised(int32_t index, int64_t value) noexcept
 {
     const int32_t normalised_index{normalize_index(index)};
-    counts_[normalised_index] += value;
+    if (storage_ == CountsStorage::Dense) {
+        counts_[normalised_index] += value;
+    } else if (!packed_counts_.add(normalised_index, value)) {
+        return false;
+    }
     total_count_ += value;
+    return true;
 }
 
-void Histogram::update_min_max(int64_t value) noexcept
+void Histogram::update_direct() noexcept
 {
-    if (value != 0) {
-        min_value_ = std::min(min_value_, value);
-    }
-    max_value_ = std::max(max_value_, value);
+    direct_ = storage_ == CountsStorage::Dense && normalizing_index_offset_ == 0;
 }
 
 } // namespace hdr
@@ -15,9 +15,12 @@
 #ifndef TOOLBOX_HDR_HISTOGRAM
 #define TOOLBOX_HDR_HISTOGRAM
 
-#include <toolbox/Config.h>
+#include <toolbox/hdr/PackedCounts.hpp>
 
+#include <algorithm>
 #include <cstdint>
+#include <limits>
+#include <span>
 #include <vector>
 
 namespace toolbox {
@@ -60,12 +63,22 @@ struct TOOLBOX_API BucketConfig {
     std::int32_t counts_len;
 };
 
+/// Storage for a histogram's counts.
+enum class CountsStorage : std::uint8_t {
+    /// A dense array of 64-bit counters, which is the fastest to record into.
+    Dense,
+    /// Sparse pages of variable-width counters, which are allocated on demand. Recording is
+    /// slightly slower, but a histogram with a wide range and high precision needs only a fraction
+    /// of the memory. See PackedCounts.
+    Packed
+};
+
 /// A High Dynamic Range (HDR) Histogram.
 class TOOLBOX_API Histogram {
   public:
-    explicit Histogram(const BucketConfig& config);
+    explicit Histogram(const BucketConfig& config, CountsStorage storage = CountsStorage::Dense);
     Histogram(std::int64_t lowest_trackable_value, std::int64_t highest_trackable_value,
-              std::int32_t significant_figures);
+              std::int32_t significant_figures, CountsStorage storage = CountsStorage::Dense);
     ~Histogram() noexcept = default;
 
     // Copy.
@@ -83,7 +96,11 @@ class TOOLBOX_API Histogram {
     std::int32_t sub_bucket_count() const noexcept { return sub_bucket_count_; }
     std::int32_t bucket_count() const noexcept { return bucket_count_; }
     std::int64_t total_count() const noexcept { return total_count_; }
-    std::int32_t counts_len() const noexcept { return static_cast<std::int32_t>(counts_.size()); }
+    std::int32_t counts_len() const noexcept { return counts_len_; }
+    CountsStorage storage() const noexcept { return storage_; }
+
+    /// Returns the number of bytes allocated for the counts.
+    std::size_t memory_size() const noexcept;
 
     /// Get minimum value from the histogram. Will return 2^63-1 if the histogram is empty.
     std::int64_t min() const noexcept;
@@ -133,29 +150,156 @@ class TOOLBOX_API Histogram {
     /// the significant_figure specified at construction time.
     ///
     /// \param value Value to add to the histogram.
-    /// \return false if the value is larger than the highest_trackable_value and can't be recorded,
-    /// true otherwise.
-    bool record_value(std::int64_t value) noexcept;
+    /// \return false if the value is larger than the highest_trackable_value, or if packed counts
+    /// could not be allocated, and can't be recorded, true otherwise.
+    bool record_value(std::int64_t value) noexcept { return record_values(value, 1); }
 
     /// Records count values in the histogram, will round this value of to a precision at or better
     /// than the significant_figure specified at construction time.
     ///
     /// \param value Value to add to the histogram.
     /// \param count Number of values to add to the histogram.
+    /// \return false if any value is larger than the highest_trackable_value, or if packed counts
+    /// could not be allocated, and can't be recorded, true otherwise.
+    bool record_values(std::int64_t value, std::int64_t count) noexcept
+    {
+        // A single unsigned comparison also rejects negative values.
+        if (static_cast<std::uint64_t>(value) > static_cast<std::uint64_t>(max_recordable_value_))
+            [[unlikely]] {
+            return false;
+        }
+        const std::int32_t index{counts_index_for(value)};
+        if (direct_) [[likely]] {
+            counts_[index] += count;
+            total_count_ += count;
+        } else if (!counts_inc_normalised(index, count)) [[unlikely]] {
+            return false;
+        }
+        update_min_max(value);
+        return true;
+    }
+
+    /// Records each value in the histogram once. This is equivalent to calling record_value() for
+    /// each value, but keeps the histogram's state in registers for the duration of the batch.
+    ///
+    /// \param values Values to add to the histogram.
+    /// \return the number of values that were dropped because they could not be recorded.
+    std::int64_t record_values_batch(std::span<const std::int64_t> values) noexcept;
+
+    /// Adds all of the values from another histogram. Counts are added directly when both
+    /// histograms have the same bucket layout; otherwise, each recorded value is re-recorded.
+    ///
+    /// \param other The histogram to add.
+    /// \return the number of values that were dropped because they could not be recorded.
+    std::int64_t add(const Histogram& other) noexcept;
+
+    /// Subtracts all of the values of another histogram. Counts are subtracted directly when both
+    /// histograms have the same bucket layout; otherwise, each recorded value is subtracted at its
+    /// equivalent value in this histogram.
+    ///
+    /// \param other The histogram to subtract.
+    /// \return false, leaving this histogram unchanged, if the other histogram has a count that is
+    /// larger than the corresponding count in this histogram, true otherwise.
+    bool subtract(const Histogram& other);
+
+    /// Shifts all recorded values left by a number of binary orders of magnitude, i.e. multiplies
+    /// each value by 2^n. Only the lowest half bucket is re-recorded; all other counts are moved by
+    /// adjusting the normalising index offset.
+    ///
+    /// \param n The number of binary orders of magnitude to shift by.
+    /// \return false, leaving this histogram unchanged, if n is negative, if the shifted maximum
+    /// value would overflow the histogram, or if packed counts could not be allocated, true
+    /// otherwise.
+    bool shift_values_left(std::int32_t n) noexcept;
+
+    /// Shifts all recorded values right by a number of binary orders of magnitude, i.e. divides
+    /// each value by 2^n.
+    ///
+    /// \param n The number of binary orders of magnitude to shift by.
+    /// \return false, leaving this histogram unchanged, if n is negative, if the shift would lose
+    /// precision of the minimum non-zero value, or if packed counts could not be allocated, true
+    /// otherwise.
+    bool shift_values_right(std::int32_t n) noexcept;
+
+    /// Records a value in the histogram and backfills the samples that would have been recorded
+    /// had the recording been taken at the expected interval. This compensates for coordinated
+    /// omission, where a stalled system also stalls its own measurement.
+    ///
+    /// \param value Value to add to the histogram.
+    /// \param expected_interval The expected interval between value samples. No correction is
+    /// made if this is less than or equal to zero.
+    /// \return false if any value is larger than the highest_trackable_value and can't be recorded,
+    /// true otherwise.
+    bool record_corrected_value(std::int64_t value, std::int64_t expected_interval) noexcept;
+
+    /// Records count values in the histogram with correction for coordinated omission.
+    ///
+    /// \param value Value to add to the histogram.
+    /// \param count Number of values to add to the histogram.
+    /// \param expected_interval The expected interval between value samples.
     /// \return false if any value is larger than the highest_trackable_value and can't be recorded,
     /// true otherwise.
-    bool record_values(std::int64_t value, std::int64_t count) noexcept;
+    bool record_corrected_values(std::int64_t value, std::int64_t count,
+                                 std::int64_t expected_interval) noexcept;
+
+    /// Adds all of the values from another histogram, correcting each for coordinated omission.
+    ///
+    /// \param other The histogram to add.
+    /// \param expected_interval The expected interval between value samples.
+    /// \return the number of values that were dropped because they could not be recorded.
+    std::int64_t add_corrected(const Histogram& other, std::int64_t expected_interval) noexcept;
+
+    /// Returns a copy of this histogram with each value corrected for coordinated omission.
+    ///
+    /// \param expected_interval The expected interval between value samples.
+    Histogram copy_corrected(std::int64_t expected_interval) const;
+
+    /// Adds all of the values from another histogram, multiplying each by a ratio. This is used to
+    /// convert between units, e.g. a ratio of 0.001 converts nanoseconds to microseconds. Each
+    /// value is taken at the median equivalent value of its bucket before scaling.
+    ///
+    /// \param other The histogram to add.
+    /// \param ratio The ratio to multiply each value by.
+    /// \return the number of values that were dropped because they could not be recorded.
+    std::int64_t add_scaled(const Histogram& other, double ratio) noexcept;
 
   private:
     std::int32_t normalize_index(std::int32_t index) const noexcept;
-    std::int32_t get_bucket_index(std::int64_t value) const noexcept;
-    std::int32_t counts_index(std::int32_t bucket_index,
-                              std::int32_t sub_bucket_index) const noexcept;
-    std::int32_t counts_index_for(std::int64_t value) const noexcept;
+    std::int32_t get_bucket_index(std::int64_t value) const noexcept
+    {
+        // Position of the highest set bit above the sub-bucket range.
+        return leading_zero_count_base_ - __builtin_clzll(value | sub_bucket_mask_);
+    }
+    std::int32_t counts_index_for(std::int64_t value) const noexcept
+    {
+        const std::int32_t bucket_index{get_bucket_index(value)};
+        // The bucket's base index is (bucket_index + 1) * sub_bucket_half_count, and the offset of
+        // the sub-bucket within it is sub_bucket_index - sub_bucket_half_count, so the half counts
+        // cancel.
+        return (bucket_index << sub_bucket_half_count_magnitude_)
+            + static_cast<std::int32_t>(value >> (bucket_index + unit_magnitude_));
+    }
     std::int64_t non_zero_min() const noexcept;
+    bool same_layout(const Histogram& other) const noexcept;
+
+    std::int64_t counts_get(std::int32_t normalised_index) const noexcept;
+    /// Returns false if packed counts could not be allocated.
+    bool counts_set(std::int32_t normalised_index, std::int64_t value) noexcept;
 
-    void counts_inc_normalised(std::int32_t index, std::int64_t value) noexcept;
-    void update_min_max(std::int64_t value) noexcept;
+    void reset_min_max() noexcept;
+    /// Returns false, leaving the histogram unchanged, if packed counts could not be allocated.
+    bool counts_inc_normalised(std::int32_t index, std::int64_t value) noexcept;
+    /// Apply a function that moves counts, and returns false if any could not be stored. Moving
+    /// packed counts may allocate, so a copy is modified, and only committed on success.
+    template <typename FnT>
+    bool move_counts(FnT fn) noexcept;
+    void update_min_max(std::int64_t value) noexcept
+    {
+        // Zero is excluded from the minimum, which is the lowest non-zero value.
+        min_value_ = std::min(min_value_, value != 0 ? value : std::numeric_limits<int64_t>::max());
+        max_value_ = std::max(max_value_, value);
+    }
+    void update_direct() noexcept;
 
     std::int64_t lowest_trackable_value_;
     std::int64_t highest_trackable_value_;
@@ -166,12 +310,19 @@ class TOOLBOX_API Histogram {
     std::int32_t sub_bucket_half_count_;
     std::int64_t sub_bucket_mask_;
     std::int32_t bucket_count_;
+    std::int32_t counts_len_;
+    CountsStorage storage_;
+    std::int32_t leading_zero_count_base_;
+    std::int64_t max_recordable_value_;
+    /// True if counts are dense and not shifted, so that they can be indexed without normalising.
+    bool direct_;
 
     std::int32_t normalizing_index_offset_;
     std::int64_t min_value_;
     std::int64_t max_value_;
     std::int64_t total_count_;
     std::vector<std::int64_t> counts_;
+    PackedCounts packed_counts_;
 };
 
 } // namespace hdr
@@ -16,6 +16,9 @@
 
 #include "Histogram.hpp"
 
+#include <toolbox/hdr/Iterator.hpp>
+#include <toolbox/hdr/Utility.hpp>
+
 #include <boost/test/unit_test.hpp>
 
 using namespace std;
@@ -109,4 +112,222 @@ BOOST_AUTO_TEST_CASE(HistogramRecordEquivalentValueCase)
     BOOST_TEST(10015 * 1024 + 1023 == h.highest_equivalent_value(10008 * 1024));
 }
 
+BOOST_AUTO_TEST_CASE(HistogramAddCase)
+{
+    Histogram h1{1, 10000000, 3}, h2{1, 10000000, 3};
+    h1.record_values(100, 2);
+    h2.record_value(1000);
+    h2.record_value(0);
+    BOOST_TEST(h1.add(h2) == 0);
+    BOOST_TEST(h1.total_count() == 4);
+    BOOST_TEST(h1.count_at_value(100) == 2);
+    BOOST_TEST(h1.count_at_value(1000) == 1);
+    BOOST_TEST(h1.count_at_value(0) == 1);
+    BOOST_TEST(h1.min() == 0);
+    BOOST_TEST(h1.max() == h1.highest_equivalent_value(1000));
+
+    // Values are re-recorded when the layouts differ, and dropped if out of range.
+    Histogram h3{1, 1000, 2};
+    BOOST_TEST(h3.add(h1) == 0);
+    BOOST_TEST(h3.total_count() == 4);
+    BOOST_TEST(h3.count_at_value(100) == 2);
+    Histogram h4{1, 10000000, 2};
+    h4.record_value(5000000);
+    BOOST_TEST(h3.add(h4) == 1);
+    BOOST_TEST(h3.total_count() == 4);
+}
+
+BOOST_AUTO_TEST_CASE(HistogramSubtractCase)
+{
+    Histogram h1{1, 10000000, 3}, h2{1, 10000000, 3};
+    h1.record_values(100, 2);
+    h1.record_value(1000);
+    h1.record_value(0);
+    h2.record_value(100);
+    h2.record_value(1000);
+    BOOST_TEST(h1.subtract(h2));
+    BOOST_TEST(h1.total_count() == 2);
+    BOOST_TEST(h1.count_at_value(100) == 1);
+    BOOST_TEST(h1.count_at_value(1000) == 0);
+    BOOST_TEST(h1.min() == 0);
+    BOOST_TEST(h1.max() == 100);
+
+    // Unavailable counts leave the histogram unchanged.
+    BOOST_TEST(!h1.subtract(h2));
+    BOOST_TEST(h1.total_count() == 2);
+    BOOST_TEST(h1.count_at_value(100) == 1);
+
+    // Different layouts are subtracted by value.
+    Histogram h3{1, 1000, 2};
+    h3.record_value(0);
+    BOOST_TEST(h1.subtract(h3));
+    BOOST_TEST(h1.total_count() == 1);
+    BOOST_TEST(h1.min() == 100);
+    BOOST_TEST(!h1.subtract(h3));
+}
+
+BOOST_AUTO_TEST_CASE(HistogramShiftCase)
+{
+    Histogram h{1, 3600ULL * 1000 * 1000, 3};
+    // Values in the lowest half bucket, the upper half of bucket 0, and higher buckets.
+    const int64_t values[]{0, 1, 3, 500, 1023, 1500, 2047, 3000, 1000000, 10000000};
+    for (const auto value : values) {
+        h.record_value(value);
+    }
+    for (int32_t n{1}; n <= 8; ++n) {
+        Histogram s{h};
+        BOOST_TEST(s.shift_values_left(n));
+        BOOST_TEST(s.total_count() == h.total_count());
+        for (const auto value : values) {
+            BOOST_TEST(s.count_at_value(value << n) == h.count_at_value(value));
+        }
+        BOOST_TEST(s.min() == 0);
+        BOOST_TEST(s.max() == s.highest_equivalent_value(h.max() << n));
+
+        BOOST_TEST(s.shift_values_right(n) == (n <= 0));
+    }
+
+    // Shifting right is only possible once all values are clear of the lowest buckets.
+    Histogram r{1, 3600ULL * 1000 * 1000, 3};
+    r.record_value(0);
+    r.record_value(1 << 20);
+    r.record_value(1 << 25);
+    BOOST_TEST(r.shift_values_left(3));
+    BOOST_TEST(r.shift_values_right(5));
+    BOOST_TEST(r.total_count() == 3);
+    BOOST_TEST(r.count_at_value(0) == 1);
+    BOOST_TEST(r.count_at_value(1 << 18) == 1);
+    BOOST_TEST(r.count_at_value(1 << 23) == 1);
+    BOOST_TEST(r.min() == 0);
+    BOOST_TEST(r.max() == r.highest_equivalent_value(1 << 23));
+    BOOST_TEST(!r.shift_values_right(9));
+
+    // Overflow leaves the histogram unchanged.
+    BOOST_TEST(!r.shift_values_left(20));
+    BOOST_TEST(r.count_at_value(1 << 23) == 1);
+    BOOST_TEST(!r.shift_values_left(-1));
+}
+
+BOOST_AUTO_TEST_CASE(HistogramCorrectedCase)
+{
+    Histogram h{1, 10000000, 3};
+    BOOST_TEST(h.record_corrected_value(1000, 100));
+    // 1000, 900, 800, ..., 100.
+    BOOST_TEST(h.total_count() == 10);
+    BOOST_TEST(h.count_at_value(100) == 1);
+    BOOST_TEST(h.count_at_value(50) == 0);
+    BOOST_TEST(h.min() == 100);
+
+    BOOST_TEST(h.record_corrected_values(50, 3, 100));
+    BOOST_TEST(h.total_count() == 13);
+    BOOST_TEST(h.record_corrected_value(10, 0));
+    BOOST_TEST(h.total_count() == 14);
+
+    Histogram u{1, 10000000, 3};
+    u.record_values(1000, 2);
+    u.record_value(10);
+    const auto c = u.copy_corrected(100);
+    BOOST_TEST(c.total_count() == 21);
+    BOOST_TEST(c.count_at_value(500) == 2);
+    BOOST_TEST(c.count_at_value(10) == 1);
+    BOOST_TEST(u.total_count() == 3);
+}
+
+BOOST_AUTO_TEST_CASE(HistogramScaledCase)
+{
+    Histogram ns{1, 3600ULL * 1000 * 1000 * 1000, 3};
+    ns.record_value(1500);
+    ns.record_values(2000000, 2);
+    Histogram us{1, 3600ULL * 1000 * 1000, 3};
+    BOOST_TEST(us.add_scaled(ns, 1e-3) == 0);
+    BOOST_TEST(us.total_count() == 3);
+    BOOST_TEST(us.count_at_value(2) == 1);
+    BOOST_TEST(us.values_are_equivalent(us.max(), 2000));
+    BOOST_TEST(us.count_at_value(2000) == 2);
+
+    Histogram small{1, 1000, 2};
+    BOOST_TEST(small.add_scaled(ns, 1e-3) == 2);
+}
+
+BOOST_AUTO_TEST_CASE(HistogramRecordBatchCase)
+{
+    const int64_t values[]{0, 1, 100, 2047, 2048, 5000, -1, 32767, 32768, 1000, 0};
+    for (const auto storage : {CountsStorage::Dense, CountsStorage::Packed}) {
+        Histogram h1{1, 1000, 4, storage}, h2{1, 1000, 4, storage};
+        int64_t dropped{0};
+        for (const auto value : values) {
+            dropped += h1.record_value(value) ? 0 : 1;
+        }
+        BOOST_TEST(dropped == 2);
+        BOOST_TEST(h2.record_values_batch(values) == dropped);
+        BOOST_TEST(h2.total_count() == h1.total_count());
+        BOOST_TEST(h2.min() == h1.min());
+        BOOST_TEST(h2.max() == h1.max());
+        BOOST_TEST(h2.count_at_value(0) == 2);
+        BOOST_TEST(h2.count_at_value(32767) == 1);
+        BOOST_TEST(h2.subtract(h1));
+        BOOST_TEST(h2.total_count() == 0);
+    }
+
+    // Batches work with shifted counts.
+    Histogram h{1, 3600ULL * 1000 * 1000, 3};
+    h.record_value(4096);
+    BOOST_TEST(h.shift_values_left(2));
+    BOOST_TEST(h.record_values_batch(values) == 1);
+    BOOST_TEST(h.count_at_value(4096 << 2) == 1);
+    BOOST_TEST(h.count_at_value(32768) == 1);
+    BOOST_TEST(h.min() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(HistogramRecordLimitCase)
+{
+    Histogram h{1, numeric_limits<int64_t>::max(), 3};
+    BOOST_TEST(h.record_value(numeric_limits<int64_t>::max()));
+    BOOST_TEST(h.count_at_value(numeric_limits<int64_t>::max()) == 1);
+    BOOST_TEST(!h.record_value(numeric_limits<int64_t>::min()));
+}
+
+BOOST_AUTO_TEST_CASE(HistogramPackedCase)
+{
+    Histogram dense{1, 1'000'000'000, 5};
+    Histogram packed{1, 1'000'000'000, 5, CountsStorage::Packed};
+    BOOST_CHECK(packed.storage() == CountsStorage::Packed);
+    BOOST_TEST(packed.counts_len() == dense.counts_len());
+
+    // Latencies between 1us and 10ms.
+    int64_t value{1000};
+    for (int i{0}; i < 10000; ++i) {
+        value = 1000 + (value * 7919 + 104729) % 10'000'000;
+        BOOST_TEST(dense.record_value(value));
+        BOOST_TEST(packed.record_value(value));
+    }
+    packed.record_values(5000, 100000);
+    dense.record_values(5000, 100000);
+    BOOST_TEST(packed.total_count() == dense.total_count());
+    BOOST_TEST(packed.min() == dense.min());
+    BOOST_TEST(packed.max() == dense.max());
+    for (const auto p : {50.0, 90.0, 99.0, 99.9, 100.0}) {
+        BOOST_TEST(value_at_percentile(packed, p) == value_at_percentile(dense, p));
+    }
+    RecordedIterator d{dense}, p{packed};
+    while (d.next()) {
+        BOOST_TEST(p.next());
+        BOOST_TEST(p.value() == d.value());
+        BOOST_TEST(p.count() == d.count());
+    }
+    BOOST_TEST(!p.next());
+
+    // Pages are only allocated for populated ranges.
+    BOOST_TEST(packed.memory_size() * 4 < dense.memory_size());
+
+    // Arithmetic works on packed counts.
+    BOOST_TEST(packed.shift_values_left(1));
+    BOOST_TEST(packed.count_at_value(10000) == dense.count_at_value(5000));
+    BOOST_TEST(dense.shift_values_left(1));
+    BOOST_TEST(packed.subtract(dense));
+    BOOST_TEST(packed.total_count() == 0);
+    packed.reset();
+    BOOST_TEST(packed.count_at_value(5000) == 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,172 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "IntervalLog.hpp"
+
+#include <toolbox/hdr/Encoding.hpp>
+#include <toolbox/util/Base64.hpp>
+
+#include <charconv>
+#include <cstdio>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+
+namespace toolbox {
+inline namespace hdr {
+using namespace std;
+namespace {
+
+constexpr auto StartTimePrefix = "#[StartTime: "sv;
+constexpr auto BaseTimePrefix = "#[BaseTime: "sv;
+constexpr auto TagPrefix = "Tag="sv;
+
+/// Logs whose timestamps are more than a year before the start time are assumed to be relative.
+constexpr double RelativeThreshold{365 * 24 * 3600.0};
+
+double to_seconds(WallTime t) noexcept
+{
+    return static_cast<double>(ns_since_epoch<WallClock>(t)) / 1e9;
+}
+
+double parse_double(string_view sv)
+{
+    double d{0};
+    const auto [end, ec] = from_chars(sv.data(), sv.data() + sv.size(), d);
+    if (ec != errc{} || end != sv.data() + sv.size()) {
+        throw invalid_argument{"invalid number in interval log"};
+    }
+    return d;
+}
+
+/// Returns the number that follows the prefix, which is terminated by a space or bracket.
+double parse_time(string_view line, string_view prefix)
+{
+    line.remove_prefix(prefix.size());
+    return parse_double(line.substr(0, line.find_first_of(" ]")));
+}
+
+/// Removes and returns the next comma-separated field.
+string_view next_field(string_view& line) noexcept
+{
+    const auto pos = line.find(',');
+    const auto field = line.substr(0, pos);
+    line.remove_prefix(pos == string_view::npos ? line.size() : pos + 1);
+    return field;
+}
+
+} // namespace
+
+IntervalLogWriter::IntervalLogWriter(ostream& os, double max_value_unit_ratio)
+: os_{os}
+, max_value_unit_ratio_{max_value_unit_ratio}
+{
+}
+
+IntervalLogWriter::~IntervalLogWriter() = default;
+
+void IntervalLogWriter::write_header(WallTime start_time, WallTime base_time)
+{
+    base_time_ = to_seconds(base_time);
+    char buf[64];
+    os_ << "#[Histogram log format version 1.3]\n";
+    snprintf(buf, sizeof(buf), "%.3f", to_seconds(start_time));
+    os_ << StartTimePrefix << buf << " (seconds since epoch), "
+        << put_time<Millis>(start_time, "%Y-%m-%dT%H:%M:%S") << "Z]\n";
+    snprintf(buf, sizeof(buf), "%.3f", base_time_);
+    os_ << BaseTimePrefix << buf << " (seconds since epoch)]\n";
+    os_ << "\"StartTimestamp\",\"Interval_Length\",\"Interval_Max\","
+           "\"Interval_Compressed_Histogram\"\n";
+}
+
+void IntervalLogWriter::write_comment(string_view comment)
+{
+    os_ << '#' << comment << '\n';
+}
+
+void IntervalLogWriter::write_interval(WallTime start, WallTime end, const Histogram& h,
+                                       string_view tag)
+{
+    buf_.clear();
+    encode_compressed_histogram(h, buf_);
+    line_.clear();
+    if (!tag.empty()) {
+        line_ += TagPrefix;
+        line_ += tag;
+        line_ += ',';
+    }
+    const auto start_secs = to_seconds(start);
+    char nums[128];
+    const auto len = snprintf(nums, sizeof(nums), "%.3f,%.3f,%.3f,", start_secs - base_time_,
+                              to_seconds(end) - start_secs,
+                              static_cast<double>(h.max()) / max_value_unit_ratio_);
+    line_.append(nums, len);
+    base64_encode(buf_, line_);
+    line_ += '\n';
+    os_ << line_;
+}
+
+IntervalLogReader::IntervalLogReader(istream& is)
+: is_{is}
+{
+}
+
+IntervalLogReader::~IntervalLogReader() = default;
+
+optional<IntervalLogEntry> IntervalLogReader::next()
+{
+    while (getline(is_, line_)) {
+        string_view line{line_};
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        if (line.starts_with(StartTimePrefix)) {
+            start_time_ = parse_time(line, StartTimePrefix);
+            continue;
+        }
+        if (line.starts_with(BaseTimePrefix)) {
+            base_time_ = parse_time(line, BaseTimePrefix);
+            has_base_time_ = true;
+            continue;
+        }
+        // Skip comments, the legend and blank lines.
+        if (line.empty() || line.front() == '#' || line.front() == '"') {
+            continue;
+        }
+        string tag;
+        if (line.starts_with(TagPrefix)) {
+            line.remove_prefix(TagPrefix.size());
+            tag = next_field(line);
+        }
+        auto timestamp = parse_double(next_field(line));
+        const auto length = parse_double(next_field(line));
+        const auto max = parse_double(next_field(line));
+        if (!has_base_time_ && timestamp < start_time_ - RelativeThreshold) {
+            // Relative timestamps without an explicit base time are relative to the start time.
+            base_time_ = start_time_;
+            has_base_time_ = true;
+        }
+        timestamp += base_time_;
+        buf_.clear();
+        if (!base64_decode(line, buf_)) {
+            throw invalid_argument{"invalid base64 in interval log"};
+        }
+        return IntervalLogEntry{std::move(tag), timestamp, length, max, decode_histogram(buf_)};
+    }
+    return nullopt;
+}
+
+} // namespace hdr
+} // namespace toolbox
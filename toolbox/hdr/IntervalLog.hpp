@@ -0,0 +1,110 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_HDR_INTERVALLOG
+#define TOOLBOX_HDR_INTERVALLOG
+
+#include <toolbox/hdr/Histogram.hpp>
+#include <toolbox/sys/Time.hpp>
+
+#include <iosfwd>
+#include <optional>
+#include <string>
+
+namespace toolbox {
+/// A C++ port of HdrHistogram_c written Michael Barker and released to the public domain.
+inline namespace hdr {
+
+/// IntervalLogWriter writes histograms in the interval log format (version 1.3) that is read by
+/// HistogramLogProcessor and the other HdrHistogram tools. Each histogram is written on a single
+/// line as the base64 form of its compressed V2 encoding.
+class TOOLBOX_API IntervalLogWriter {
+  public:
+    /// \param os The output stream.
+    /// \param max_value_unit_ratio The divisor applied to the interval maximum, which by
+    /// convention converts nanoseconds to milliseconds.
+    explicit IntervalLogWriter(std::ostream& os, double max_value_unit_ratio = 1'000'000.0);
+    ~IntervalLogWriter();
+
+    // Copy.
+    IntervalLogWriter(const IntervalLogWriter&) = delete;
+    IntervalLogWriter& operator=(const IntervalLogWriter&) = delete;
+
+    // Move.
+    IntervalLogWriter(IntervalLogWriter&&) = delete;
+    IntervalLogWriter& operator=(IntervalLogWriter&&) = delete;
+
+    /// Write the format version, start time, base time and legend. Interval timestamps are
+    /// written relative to the base time.
+    void write_header(WallTime start_time, WallTime base_time);
+    void write_comment(std::string_view comment);
+    /// Write an interval histogram with an optional tag, which must not contain commas or
+    /// whitespace.
+    void write_interval(WallTime start, WallTime end, const Histogram& h,
+                        std::string_view tag = {});
+
+  private:
+    std::ostream& os_;
+    const double max_value_unit_ratio_;
+    double base_time_{0};
+    /// Scratch buffers for the encoded histogram.
+    std::string buf_, line_;
+};
+
+struct IntervalLogEntry {
+    std::string tag;
+    /// Seconds since epoch.
+    double start_timestamp;
+    double interval_length;
+    double interval_max;
+    Histogram histogram;
+};
+
+/// IntervalLogReader reads histograms from an interval log.
+class TOOLBOX_API IntervalLogReader {
+  public:
+    explicit IntervalLogReader(std::istream& is);
+    ~IntervalLogReader();
+
+    // Copy.
+    IntervalLogReader(const IntervalLogReader&) = delete;
+    IntervalLogReader& operator=(const IntervalLogReader&) = delete;
+
+    // Move.
+    IntervalLogReader(IntervalLogReader&&) = delete;
+    IntervalLogReader& operator=(IntervalLogReader&&) = delete;
+
+    /// Returns the start time from the header in seconds since epoch, or zero if there was none.
+    double start_time() const noexcept { return start_time_; }
+    /// Returns the base time in seconds since epoch, or zero if there was none.
+    double base_time() const noexcept { return base_time_; }
+
+    /// Read the next interval histogram. Timestamps are converted to seconds since epoch.
+    ///
+    /// \return the next entry, or nothing at the end of the log.
+    /// \throws std::invalid_argument if a line is malformed.
+    std::optional<IntervalLogEntry> next();
+
+  private:
+    std::istream& is_;
+    double start_time_{0}, base_time_{0};
+    bool has_base_time_{false};
+    std::string line_, buf_;
+};
+
+} // namespace hdr
+} // namespace toolbox
+
+#endif // TOOLBOX_HDR_INTERVALLOG
@@ -0,0 +1,104 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "IntervalLog.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+
+using namespace std;
+using namespace toolbox;
+
+BOOST_AUTO_TEST_SUITE(IntervalLogSuite)
+
+BOOST_AUTO_TEST_CASE(IntervalLogRoundTripCase)
+{
+    const auto base = WallClock::from_time_t(1'600'000'000);
+    Histogram h1{1, 3600'000'000'000, 3}, h2{1, 3600'000'000'000, 3};
+    h1.record_value(1'000'000);
+    h1.record_value(2'500'000);
+    h2.record_values(500'000, 10);
+
+    stringstream ss;
+    IntervalLogWriter w{ss};
+    w.write_header(base, base);
+    w.write_comment("test");
+    w.write_interval(base + 1s, base + 2s, h1);
+    w.write_interval(base + 2s, base + 3500ms, h2, "route");
+
+    string line;
+    BOOST_TEST(!getline(ss, line).fail());
+    BOOST_TEST(line == "#[Histogram log format version 1.3]");
+    BOOST_TEST(!getline(ss, line).fail());
+    BOOST_TEST(line
+               == "#[StartTime: 1600000000.000 (seconds since epoch), 2020-09-13T12:26:40.000Z]");
+    BOOST_TEST(!getline(ss, line).fail());
+    BOOST_TEST(line == "#[BaseTime: 1600000000.000 (seconds since epoch)]");
+    BOOST_TEST(!getline(ss, line).fail());
+    BOOST_TEST(line.starts_with("\"StartTimestamp\""));
+    BOOST_TEST(!getline(ss, line).fail());
+    BOOST_TEST(line == "#test");
+    BOOST_TEST(!getline(ss, line).fail());
+    BOOST_TEST(line.starts_with("1.000,1.000,2.501,HISTFAAA"));
+    BOOST_TEST(!getline(ss, line).fail());
+    BOOST_TEST(line.starts_with("Tag=route,2.000,1.500,0.500,HISTFAAA"));
+
+    ss.clear();
+    ss.seekg(0);
+    IntervalLogReader r{ss};
+    auto e = r.next();
+    BOOST_TEST(e.has_value());
+    BOOST_TEST(r.start_time() == 1'600'000'000.0);
+    BOOST_TEST(r.base_time() == 1'600'000'000.0);
+    BOOST_TEST(e->tag.empty());
+    BOOST_TEST(e->start_timestamp == 1'600'000'001.0);
+    BOOST_TEST(e->interval_length == 1.0);
+    BOOST_TEST(e->interval_max == 2.501);
+    BOOST_TEST(e->histogram.total_count() == 2);
+    BOOST_TEST(e->histogram.count_at_value(1'000'000) == 1);
+
+    e = r.next();
+    BOOST_TEST(e.has_value());
+    BOOST_TEST(e->tag == "route");
+    BOOST_TEST(e->start_timestamp == 1'600'000'002.0);
+    BOOST_TEST(e->histogram.count_at_value(500'000) == 10);
+    BOOST_TEST(!r.next().has_value());
+}
+
+BOOST_AUTO_TEST_CASE(IntervalLogRelativeCase)
+{
+    // Without a base time, timestamps that are well before the start time are relative to it.
+    Histogram h{1, 1000, 3};
+    h.record_value(10);
+    stringstream ss;
+    IntervalLogWriter w{ss};
+    w.write_interval(WallClock::from_time_t(5), WallClock::from_time_t(6), h);
+    const auto data = "#[StartTime: 1000000000.500 (seconds since epoch), ...]\n" + ss.str();
+
+    istringstream is{data};
+    IntervalLogReader r{is};
+    const auto e = r.next();
+    BOOST_TEST(e.has_value());
+    BOOST_TEST(r.base_time() == 1'000'000'000.5);
+    BOOST_TEST(e->start_timestamp == 1'000'000'005.5);
+    BOOST_TEST(e->histogram.count_at_value(10) == 1);
+
+    istringstream bad{"1.0,1.0,1.0,!!!!\n"};
+    IntervalLogReader r2{bad};
+    BOOST_CHECK_THROW(r2.next(), invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
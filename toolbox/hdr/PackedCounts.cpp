@@ -0,0 +1,198 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "PackedCounts.hpp"
+
+#include <cstring>
+#include <new>
+
+namespace toolbox {
+inline namespace hdr {
+using namespace std;
+namespace {
+
+constexpr int32_t PageShift{7};
+static_assert((1 << PageShift) == PackedCounts::PageSize);
+
+/// Returns log2 of the narrowest counter width in bytes that can hold count.
+uint8_t width_for(int64_t count) noexcept
+{
+    // Negative counts are stored at full width.
+    const auto n = static_cast<uint64_t>(count);
+    if (n <= 0xff) {
+        return 0;
+    }
+    if (n <= 0xffff) {
+        return 1;
+    }
+    if (n <= 0xffffffff) {
+        return 2;
+    }
+    return 3;
+}
+
+template <typename T>
+int64_t load(const uint8_t* page, int32_t offset) noexcept
+{
+    T n;
+    memcpy(&n, page + offset * sizeof(T), sizeof(T));
+    return static_cast<int64_t>(n);
+}
+
+template <typename T>
+void store(uint8_t* page, int32_t offset, int64_t count) noexcept
+{
+    const auto n = static_cast<T>(count);
+    memcpy(page + offset * sizeof(T), &n, sizeof(T));
+}
+
+int64_t load(const uint8_t* page, uint8_t width, int32_t offset) noexcept
+{
+    switch (width) {
+    case 0:
+        return page[offset];
+    case 1:
+        return load<uint16_t>(page, offset);
+    case 2:
+        return load<uint32_t>(page, offset);
+    }
+    return load<int64_t>(page, offset);
+}
+
+void store(uint8_t* page, uint8_t width, int32_t offset, int64_t count) noexcept
+{
+    switch (width) {
+    case 0:
+        page[offset] = static_cast<uint8_t>(count);
+        break;
+    case 1:
+        store<uint16_t>(page, offset, count);
+        break;
+    case 2:
+        store<uint32_t>(page, offset, count);
+        break;
+    default:
+        store<int64_t>(page, offset, count);
+        break;
+    }
+}
+
+} // namespace
+
+PackedCounts::PackedCounts(int32_t size)
+: size_{size}
+, widths_((size + PageSize - 1) >> PageShift)
+, pages_(widths_.size())
+{
+}
+
+PackedCounts::~PackedCounts() = default;
+
+PackedCounts::PackedCounts(const PackedCounts& rhs)
+: size_{rhs.size_}
+, widths_{rhs.widths_}
+, pages_(rhs.pages_.size())
+{
+    for (size_t i{0}; i < pages_.size(); ++i) {
+        if (rhs.pages_[i]) {
+            const size_t len{size_t{PageSize} << widths_[i]};
+            pages_[i] = make_unique<uint8_t[]>(len);
+            memcpy(pages_[i].get(), rhs.pages_[i].get(), len);
+        }
+    }
+}
+
+PackedCounts& PackedCounts::operator=(const PackedCounts& rhs)
+{
+    if (&rhs != this) {
+        PackedCounts tmp{rhs};
+        *this = move(tmp);
+    }
+    return *this;
+}
+
+PackedCounts::PackedCounts(PackedCounts&&) noexcept = default;
+
+PackedCounts& PackedCounts::operator=(PackedCounts&&) noexcept = default;
+
+size_t PackedCounts::memory_size() const noexcept
+{
+    size_t n{widths_.capacity() * sizeof(uint8_t) + pages_.capacity() * sizeof(pages_[0])};
+    for (size_t i{0}; i < pages_.size(); ++i) {
+        if (pages_[i]) {
+            n += size_t{PageSize} << widths_[i];
+        }
+    }
+    return n;
+}
+
+int64_t PackedCounts::get(int32_t index) const noexcept
+{
+    const int32_t page{index >> PageShift};
+    const uint8_t* const p{pages_[page].get()};
+    if (!p) {
+        return 0;
+    }
+    return load(p, widths_[page], index & (PageSize - 1));
+}
+
+bool PackedCounts::set(int32_t index, int64_t count) noexcept
+{
+    const int32_t page{index >> PageShift};
+    if (!pages_[page]) {
+        if (count == 0) {
+            return true;
+        }
+        // Allocation failure is reported to the caller, so that recording remains noexcept.
+        pages_[page].reset(new (nothrow) uint8_t[PageSize]{});
+        if (!pages_[page]) {
+            return false;
+        }
+        widths_[page] = 0;
+    }
+    const uint8_t width{width_for(count)};
+    if (width > widths_[page] && !widen(page, width)) {
+        return false;
+    }
+    store(pages_[page].get(), widths_[page], index & (PageSize - 1), count);
+    return true;
+}
+
+void PackedCounts::reset() noexcept
+{
+    for (size_t i{0}; i < pages_.size(); ++i) {
+        if (pages_[i]) {
+            memset(pages_[i].get(), 0, size_t{PageSize} << widths_[i]);
+        }
+    }
+}
+
+bool PackedCounts::widen(int32_t page, uint8_t width) noexcept
+{
+    unique_ptr<uint8_t[]> p{new (nothrow) uint8_t[size_t{PageSize} << width]};
+    if (!p) {
+        return false;
+    }
+    const uint8_t* const from{pages_[page].get()};
+    for (int32_t i{0}; i < PageSize; ++i) {
+        store(p.get(), width, i, load(from, widths_[page], i));
+    }
+    pages_[page] = move(p);
+    widths_[page] = width;
+    return true;
+}
+
+} // namespace hdr
+} // namespace toolbox
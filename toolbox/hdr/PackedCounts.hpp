@@ -0,0 +1,78 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_HDR_PACKEDCOUNTS
+#define TOOLBOX_HDR_PACKEDCOUNTS
+
+#include <toolbox/Config.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace toolbox {
+/// A C++ port of HdrHistogram_c written Michael Barker and released to the public domain.
+inline namespace hdr {
+
+/// A sparse array of counters for histograms that have a wide but thinly populated value range.
+///
+/// The array is divided into fixed-size pages, which are allocated the first time that one of
+/// their counters becomes non-zero. Each page stores its counters at the narrowest width, from one
+/// to eight bytes, that can hold its largest count, and is widened when a count outgrows it.
+class TOOLBOX_API PackedCounts {
+  public:
+    /// Number of counters in each page.
+    static constexpr std::int32_t PageSize{128};
+
+    explicit PackedCounts(std::int32_t size = 0);
+    ~PackedCounts();
+
+    // Copy.
+    PackedCounts(const PackedCounts& rhs);
+    PackedCounts& operator=(const PackedCounts& rhs);
+
+    // Move.
+    PackedCounts(PackedCounts&&) noexcept;
+    PackedCounts& operator=(PackedCounts&&) noexcept;
+
+    std::int32_t size() const noexcept { return size_; }
+
+    /// Returns the number of bytes allocated for the page directory and pages.
+    std::size_t memory_size() const noexcept;
+
+    std::int64_t get(std::int32_t index) const noexcept;
+    /// Returns false, leaving the counter unchanged, if a page could not be allocated or widened.
+    bool set(std::int32_t index, std::int64_t count) noexcept;
+    bool add(std::int32_t index, std::int64_t count) noexcept
+    {
+        return set(index, get(index) + count);
+    }
+
+    /// Zeroes all counters. Allocated pages are retained, at their current width, for reuse.
+    void reset() noexcept;
+
+  private:
+    bool widen(std::int32_t page, std::uint8_t width) noexcept;
+
+    std::int32_t size_;
+    /// Log2 of the counter width in bytes for each page.
+    std::vector<std::uint8_t> widths_;
+    std::vector<std::unique_ptr<std::uint8_t[]>> pages_;
+};
+
+} // namespace hdr
+} // namespace toolbox
+
+#endif // TOOLBOX_HDR_PACKEDCOUNTS
@@ -0,0 +1,95 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "PackedCounts.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace toolbox;
+
+BOOST_AUTO_TEST_SUITE(PackedCountsSuite)
+
+BOOST_AUTO_TEST_CASE(PackedCountsBasicCase)
+{
+    PackedCounts c{1000};
+    BOOST_TEST(c.size() == 1000);
+    const auto empty = c.memory_size();
+    BOOST_TEST(c.get(0) == 0);
+    BOOST_TEST(c.get(999) == 0);
+
+    // Zero counts do not allocate a page.
+    c.set(500, 0);
+    BOOST_TEST(c.memory_size() == empty);
+
+    c.set(999, 1);
+    BOOST_TEST(c.get(999) == 1);
+    BOOST_TEST(c.memory_size() == empty + PackedCounts::PageSize);
+    c.add(999, 2);
+    BOOST_TEST(c.get(999) == 3);
+    c.add(998, -0);
+    BOOST_TEST(c.get(998) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(PackedCountsWidenCase)
+{
+    PackedCounts c{PackedCounts::PageSize};
+    const auto empty = c.memory_size();
+    c.set(0, 7);
+    c.set(1, 0xff);
+    BOOST_TEST(c.memory_size() == empty + PackedCounts::PageSize);
+    c.add(1, 1);
+    BOOST_TEST(c.memory_size() == empty + PackedCounts::PageSize * 2);
+    c.set(2, 0x10000);
+    BOOST_TEST(c.memory_size() == empty + PackedCounts::PageSize * 4);
+    c.set(3, INT64_MAX);
+    c.set(4, -1);
+    BOOST_TEST(c.memory_size() == empty + PackedCounts::PageSize * 8);
+
+    // Existing counts survive each widening.
+    BOOST_TEST(c.get(0) == 7);
+    BOOST_TEST(c.get(1) == 0x100);
+    BOOST_TEST(c.get(2) == 0x10000);
+    BOOST_TEST(c.get(3) == INT64_MAX);
+    BOOST_TEST(c.get(4) == -1);
+    BOOST_TEST(c.get(5) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(PackedCountsCopyCase)
+{
+    PackedCounts c{1000};
+    c.set(10, 1);
+    c.set(900, 100000);
+
+    PackedCounts d{c};
+    c.set(10, 2);
+    BOOST_TEST(d.get(10) == 1);
+    BOOST_TEST(d.get(900) == 100000);
+    BOOST_TEST(d.memory_size() == c.memory_size());
+
+    PackedCounts e;
+    e = d;
+    BOOST_TEST(e.size() == 1000);
+    BOOST_TEST(e.get(900) == 100000);
+
+    // Reset retains pages.
+    const auto used = e.memory_size();
+    e.reset();
+    BOOST_TEST(e.get(10) == 0);
+    BOOST_TEST(e.get(900) == 0);
+    BOOST_TEST(e.memory_size() == used);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
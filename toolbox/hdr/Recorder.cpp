@@ -0,0 +1,84 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Recorder.hpp"
+
+#include <thread>
+
+namespace toolbox {
+inline namespace hdr {
+using namespace std;
+
+void WriterReaderPhaser::flip_phase() noexcept
+{
+    const bool next_phase_is_even{start_epoch_.load() < 0};
+    // Clear the end epoch of the next phase before any writer can enter it.
+    const int64_t initial_start_value{next_phase_is_even ? 0 : INT64_MIN};
+    (next_phase_is_even ? even_end_epoch_ : odd_end_epoch_).store(initial_start_value);
+
+    const int64_t start_value_at_flip{start_epoch_.exchange(initial_start_value)};
+    // Wait for writers that entered the previous phase to exit.
+    const auto& end_epoch = next_phase_is_even ? odd_end_epoch_ : even_end_epoch_;
+    while (end_epoch.load() != start_value_at_flip) {
+        this_thread::yield();
+    }
+}
+
+Recorder::Shard::Shard(const BucketConfig& config)
+: active_{&a_}
+, inactive_{&b_}
+, a_{config}
+, b_{config}
+{
+}
+
+Recorder::Shard::~Shard() = default;
+
+Recorder::Recorder(const BucketConfig& config)
+: config_{config}
+{
+}
+
+Recorder::Recorder(int64_t lowest_trackable_value, int64_t highest_trackable_value,
+                   int32_t significant_figures)
+: Recorder{BucketConfig{lowest_trackable_value, highest_trackable_value, significant_figures}}
+{
+}
+
+Recorder::~Recorder() = default;
+
+Recorder::Shard& Recorder::shard()
+{
+    auto shard = make_unique<Shard>(config_);
+    lock_guard lock{mutex_};
+    shards_.push_back(std::move(shard));
+    return *shards_.back();
+}
+
+void Recorder::interval_histogram(Histogram& h)
+{
+    lock_guard lock{mutex_};
+    h.reset();
+    for (auto& shard : shards_) {
+        // The inactive histogram was merged by the previous call.
+        shard->inactive_->reset();
+        shard->inactive_ = shard->active_.exchange(shard->inactive_);
+        shard->phaser_.flip_phase();
+        h.add(*shard->inactive_);
+    }
+}
+
+} // namespace hdr
+} // namespace toolbox
@@ -0,0 +1,150 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_HDR_RECORDER
+#define TOOLBOX_HDR_RECORDER
+
+#include <toolbox/hdr/Histogram.hpp>
+#include <toolbox/sys/Limits.hpp>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+namespace toolbox {
+/// A C++ port of HdrHistogram_c written Michael Barker and released to the public domain.
+inline namespace hdr {
+
+/// WriterReaderPhaser allows a reader to wait until all writers have left a critical section that
+/// they entered before the phase was flipped. Writers never block or spin. The reader must
+/// serialise calls to flip_phase().
+class TOOLBOX_API WriterReaderPhaser {
+  public:
+    WriterReaderPhaser() noexcept = default;
+    ~WriterReaderPhaser() = default;
+
+    // Copy.
+    WriterReaderPhaser(const WriterReaderPhaser&) = delete;
+    WriterReaderPhaser& operator=(const WriterReaderPhaser&) = delete;
+
+    // Move.
+    WriterReaderPhaser(WriterReaderPhaser&&) = delete;
+    WriterReaderPhaser& operator=(WriterReaderPhaser&&) = delete;
+
+    /// Enter a writer critical section.
+    ///
+    /// \return the value that must be passed to writer_critical_section_exit().
+    std::int64_t writer_critical_section_enter() noexcept { return start_epoch_.fetch_add(1); }
+
+    /// Exit a writer critical section.
+    ///
+    /// \param critical_value_at_enter The value returned by writer_critical_section_enter().
+    void writer_critical_section_exit(std::int64_t critical_value_at_enter) noexcept
+    {
+        (critical_value_at_enter < 0 ? odd_end_epoch_ : even_end_epoch_).fetch_add(1);
+    }
+
+    /// Flip the phase, and wait until all writers that entered before the flip have exited.
+    void flip_phase() noexcept;
+
+  private:
+    /// The sign of the start epoch distinguishes even and odd phases.
+    std::atomic<std::int64_t> start_epoch_{0};
+    std::atomic<std::int64_t> even_end_epoch_{0};
+    std::atomic<std::int64_t> odd_end_epoch_{INT64_MIN};
+};
+
+/// Recorder records values from many threads, and allows a reader to take interval histograms
+/// without stopping the writers.
+///
+/// Each writer thread obtains its own Shard, which holds a pair of histograms and a phaser, so
+/// that writers never share a cache line. The reader swaps each shard's active histogram for an
+/// empty one, flips the shard's phaser to wait for any write in progress, and then merges the
+/// inactive histograms into the interval histogram.
+class TOOLBOX_API Recorder {
+  public:
+    class alignas(CacheLineSize) Shard {
+        friend class Recorder;
+
+      public:
+        explicit Shard(const BucketConfig& config);
+        ~Shard();
+
+        // Copy.
+        Shard(const Shard&) = delete;
+        Shard& operator=(const Shard&) = delete;
+
+        // Move.
+        Shard(Shard&&) = delete;
+        Shard& operator=(Shard&&) = delete;
+
+        /// Records a value in the active histogram. Must only be called from the thread that owns
+        /// the shard.
+        ///
+        /// \param value Value to add to the histogram.
+        /// \return false if the value is out of range, true otherwise.
+        bool record_value(std::int64_t value) noexcept { return record_values(value, 1); }
+        bool record_values(std::int64_t value, std::int64_t count) noexcept
+        {
+            const auto epoch = phaser_.writer_critical_section_enter();
+            const bool ret{active_.load()->record_values(value, count)};
+            phaser_.writer_critical_section_exit(epoch);
+            return ret;
+        }
+
+      private:
+        WriterReaderPhaser phaser_;
+        std::atomic<Histogram*> active_;
+        Histogram* inactive_;
+        Histogram a_, b_;
+    };
+
+    explicit Recorder(const BucketConfig& config);
+    Recorder(std::int64_t lowest_trackable_value, std::int64_t highest_trackable_value,
+             std::int32_t significant_figures);
+    ~Recorder();
+
+    // Copy.
+    Recorder(const Recorder&) = delete;
+    Recorder& operator=(const Recorder&) = delete;
+
+    // Move.
+    Recorder(Recorder&&) = delete;
+    Recorder& operator=(Recorder&&) = delete;
+
+    const BucketConfig& config() const noexcept { return config_; }
+
+    /// Returns a new shard for the calling thread. Shards remain valid for the lifetime of the
+    /// recorder, so each thread should obtain one shard and keep it.
+    Shard& shard();
+
+    /// Replace the histogram with the values that were recorded by all shards since the previous
+    /// interval was taken.
+    ///
+    /// \param h The interval histogram, which is reset first and must have the same bucket
+    /// configuration as the recorder.
+    void interval_histogram(Histogram& h);
+
+  private:
+    const BucketConfig config_;
+    /// Serialises readers, and guards the list of shards.
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+};
+
+} // namespace hdr
+} // namespace toolbox
+
+#endif // TOOLBOX_HDR_RECORDER
@@ -0,0 +1,88 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Recorder.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <thread>
+
+using namespace std;
+using namespace toolbox;
+
+BOOST_AUTO_TEST_SUITE(RecorderSuite)
+
+BOOST_AUTO_TEST_CASE(RecorderIntervalCase)
+{
+    Recorder r{1, 3600'000'000, 3};
+    auto& s1 = r.shard();
+    auto& s2 = r.shard();
+    Histogram h{1, 3600'000'000, 3};
+
+    BOOST_TEST(s1.record_value(100));
+    BOOST_TEST(s1.record_values(1000, 2));
+    BOOST_TEST(s2.record_value(10000));
+    BOOST_TEST(!s2.record_value(-1));
+    r.interval_histogram(h);
+    BOOST_TEST(h.total_count() == 4);
+    BOOST_TEST(h.count_at_value(100) == 1);
+    BOOST_TEST(h.count_at_value(1000) == 2);
+    BOOST_TEST(h.count_at_value(10000) == 1);
+    BOOST_TEST(h.min() == 100);
+    BOOST_TEST(h.max() == h.highest_equivalent_value(10000));
+
+    // Each interval contains only the values recorded since the previous one.
+    BOOST_TEST(s2.record_value(500));
+    r.interval_histogram(h);
+    BOOST_TEST(h.total_count() == 1);
+    BOOST_TEST(h.count_at_value(500) == 1);
+    r.interval_histogram(h);
+    BOOST_TEST(h.total_count() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(RecorderConcurrentCase)
+{
+    constexpr int Threads{4};
+    constexpr int Values{100000};
+    Recorder r{1, 3600'000'000, 3};
+    Histogram h{1, 3600'000'000, 3}, total{1, 3600'000'000, 3};
+
+    atomic<int> done{0};
+    vector<thread> threads;
+    for (int i{0}; i < Threads; ++i) {
+        threads.emplace_back([&r, &done, i]() {
+            auto& s = r.shard();
+            for (int j{0}; j < Values; ++j) {
+                s.record_value(1 + (i * Values + j) % 10000);
+            }
+            ++done;
+        });
+    }
+    // Take intervals while the writers are running.
+    while (done.load() < Threads) {
+        r.interval_histogram(h);
+        total.add(h);
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    r.interval_histogram(h);
+    total.add(h);
+    BOOST_TEST(total.total_count() == Threads * Values);
+    BOOST_TEST(total.min() == 1);
+    BOOST_TEST(total.max() == total.highest_equivalent_value(10000));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
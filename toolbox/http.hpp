@@ -17,15 +17,27 @@
 #ifndef TOOLBOX_HTTP_HPP
 #define TOOLBOX_HTTP_HPP
 
+#include "http/Admission.hpp"
 #include "http/App.hpp"
+#include "http/Clnt.hpp"
+#include "http/ClntConn.hpp"
+#include "http/Compress.hpp"
 #include "http/Conn.hpp"
 #include "http/Error.cpp"
 #include "http/Exception.cpp"
+#include "http/Metrics.hpp"
 #include "http/Parser.hpp"
 #include "http/Request.hpp"
+#include "http/RequestParser.hpp"
+#include "http/Response.hpp"
+#include "http/ResponseCache.hpp"
+#include "http/Router.hpp"
 #include "http/Serv.hpp"
 #include "http/Stream.hpp"
 #include "http/Types.hpp"
 #include "http/Url.hpp"
+#include "http/WebSocket.hpp"
+#include "http/WsApp.hpp"
+#include "http/WsConn.hpp"
 
 #endif // TOOLBOX_HTTP_HPP
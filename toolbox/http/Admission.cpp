@@ -0,0 +1,136 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Admission.hpp"
+
+#include <cstring>
+
+#include <netinet/in.h>
+
+namespace toolbox {
+inline namespace http {
+using namespace std;
+namespace {
+
+/// Returns false if the endpoint has no IP address.
+bool get_addr(const StreamEndpoint& ep, array<unsigned char, 16>& addr) noexcept
+{
+    switch (ep.data()->sa_family) {
+    case AF_INET: {
+        const auto& sin = *reinterpret_cast<const sockaddr_in*>(ep.data());
+        addr.fill(0);
+        addr[10] = addr[11] = 0xff;
+        memcpy(addr.data() + 12, &sin.sin_addr, 4);
+        return true;
+    }
+    case AF_INET6: {
+        const auto& sin6 = *reinterpret_cast<const sockaddr_in6*>(ep.data());
+        memcpy(addr.data(), &sin6.sin6_addr, 16);
+        return true;
+    }
+    }
+    return false;
+}
+
+} // namespace
+
+Admission::Admission(size_t max_conns_per_addr)
+: max_conns_{max_conns_per_addr}
+{
+}
+
+Admission::~Admission() = default;
+
+// Move.
+Admission::Admission(Admission&&) noexcept = default;
+Admission& Admission::operator=(Admission&&) noexcept = default;
+
+size_t Admission::conn_count(const Endpoint& ep) const noexcept
+{
+    Addr addr;
+    if (!get_addr(ep, addr)) {
+        return 0;
+    }
+    const auto it = conns_.find(addr);
+    return it != conns_.end() ? it->second : 0;
+}
+
+void Admission::set_rate_limit(string_view path, RateLimit limit)
+{
+    const auto it = routes_.find(path);
+    if (it != routes_.end()) {
+        it->second = Route{limit, RateWindow{limit.interval()}};
+    } else {
+        routes_.emplace(string{path}, Route{limit, RateWindow{limit.interval()}});
+    }
+}
+
+void Admission::erase_rate_limit(string_view path)
+{
+    const auto it = routes_.find(path);
+    if (it != routes_.end()) {
+        routes_.erase(it);
+    }
+}
+
+bool Admission::on_connect(const Endpoint& ep)
+{
+    Addr addr;
+    if (!get_addr(ep, addr)) {
+        return true;
+    }
+    auto& count = conns_[addr];
+    if (max_conns_ != 0 && count >= max_conns_) {
+        return false;
+    }
+    ++count;
+    return true;
+}
+
+void Admission::on_disconnect(const Endpoint& ep) noexcept
+{
+    Addr addr;
+    if (!get_addr(ep, addr)) {
+        return;
+    }
+    const auto it = conns_.find(addr);
+    if (it != conns_.end() && --it->second == 0) {
+        // Forget addresses without connections, so that the table does not grow without bound.
+        conns_.erase(it);
+    }
+}
+
+bool Admission::on_request(MonoTime now, string_view path) noexcept
+{
+    if (routes_.empty()) {
+        return true;
+    }
+    const auto it = routes_.find(path);
+    if (it == routes_.end()) {
+        return true;
+    }
+    auto& [limit, window] = it->second;
+    // Advance the window without counting the request, so that rejected requests do not prolong
+    // the rejection.
+    window.add(now, 0);
+    if (window.count() >= limit.limit()) {
+        return false;
+    }
+    window.add(now);
+    return true;
+}
+
+} // namespace http
+} // namespace toolbox
@@ -0,0 +1,118 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_HTTP_ADMISSION_HPP
+#define TOOLBOX_HTTP_ADMISSION_HPP
+
+#include <toolbox/net/Endpoint.hpp>
+#include <toolbox/net/RateLimit.hpp>
+#include <toolbox/util/RobinHood.hpp>
+
+#include <array>
+#include <string>
+
+namespace toolbox {
+inline namespace http {
+
+/// Pre-serialised response sent to a connection that is rejected by the per-address cap.
+/// The connection is closed once it has been written.
+constexpr std::string_view ServiceUnavailableResponse{"HTTP/1.1 503 Service Unavailable\r\n"
+                                                      "Connection: close\r\n"
+                                                      "Content-Length: 0\r\n"
+                                                      "Retry-After: 1\r\n"
+                                                      "\r\n"};
+
+/// Pre-serialised response sent to a request that exceeds its route's rate limit.
+constexpr std::string_view TooManyRequestsResponse{"HTTP/1.1 429 Too Many Requests\r\n"
+                                                   "Content-Length: 0\r\n"
+                                                   "Retry-After: 1\r\n"
+                                                   "\r\n"};
+
+/// Admission controls the load that clients may place on a server.
+///
+/// The number of concurrent connections from each source address is capped, so that a single
+/// client cannot exhaust the server's connections, and the request rate on each route is limited
+/// with a sliding RateWindow. Both checks are a single hash lookup. Unix domain sockets have no
+/// source address, and are not subject to the connection cap.
+class TOOLBOX_API Admission {
+    /// IPv4 addresses are stored as IPv4-mapped IPv6 addresses.
+    using Addr = std::array<unsigned char, 16>;
+    struct AddrHash {
+        std::size_t operator()(const Addr& addr) const noexcept
+        {
+            return robin_hood::hash_bytes(addr.data(), addr.size());
+        }
+    };
+    struct Route {
+        RateLimit limit;
+        RateWindow window;
+    };
+    /// Heterogeneous lookup, so that the route check does not allocate.
+    struct PathHash {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view path) const noexcept
+        {
+            return robin_hood::hash_bytes(path.data(), path.size());
+        }
+    };
+    struct PathEqual {
+        using is_transparent = void;
+        bool operator()(std::string_view lhs, std::string_view rhs) const noexcept
+        {
+            return lhs == rhs;
+        }
+    };
+
+  public:
+    using Endpoint = StreamEndpoint;
+
+    /// A zero cap means that the number of connections per address is unlimited.
+    explicit Admission(std::size_t max_conns_per_addr = 0);
+    ~Admission();
+
+    // Copy.
+    Admission(const Admission&) = delete;
+    Admission& operator=(const Admission&) = delete;
+
+    // Move.
+    Admission(Admission&&) noexcept;
+    Admission& operator=(Admission&&) noexcept;
+
+    std::size_t max_conns_per_addr() const noexcept { return max_conns_; }
+    void set_max_conns_per_addr(std::size_t max_conns) noexcept { max_conns_ = max_conns; }
+    /// Returns the number of connections currently admitted from the endpoint's address.
+    std::size_t conn_count(const Endpoint& ep) const noexcept;
+    /// Limit the rate of requests on the route with the given path, across all clients. Requests
+    /// for paths without a limit are always admitted.
+    void set_rate_limit(std::string_view path, RateLimit limit);
+    void erase_rate_limit(std::string_view path);
+
+    /// Returns true and counts the connection if it is admitted.
+    bool on_connect(const Endpoint& ep);
+    /// Release a connection that was admitted.
+    void on_disconnect(const Endpoint& ep) noexcept;
+    /// Returns true and counts the request if it is admitted by the route's rate limit.
+    bool on_request(MonoTime now, std::string_view path) noexcept;
+
+  private:
+    std::size_t max_conns_;
+    RobinFlatMap<Addr, std::size_t, AddrHash> conns_;
+    RobinNodeMap<std::string, Route, PathHash, PathEqual> routes_;
+};
+
+} // namespace http
+} // namespace toolbox
+
+#endif // TOOLBOX_HTTP_ADMISSION_HPP
@@ -0,0 +1,206 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Admission.hpp"
+
+#include <toolbox/http/App.hpp>
+#include <toolbox/http/Serv.hpp>
+#include <toolbox/net/StreamSock.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <unistd.h>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+class TestApp final : public App {
+  public:
+    explicit TestApp(Admission& admission) { set_admission(&admission); }
+    int messages{0};
+    std::string body;
+
+  protected:
+    void do_on_http_connect(CyclTime now, const Endpoint& ep) override {}
+    void do_on_http_disconnect(CyclTime now, const Endpoint& ep) noexcept override {}
+    void do_on_http_error(CyclTime now, const Endpoint& ep, const std::exception& e,
+                          http::OStream& os) noexcept override
+    {
+    }
+    bool do_on_http_headers(CyclTime now, const Endpoint& ep, const Request& req) override
+    {
+        return req.path() == "/upload";
+    }
+    std::size_t do_on_http_body_chunk(CyclTime now, const Endpoint& ep, const Request& req,
+                                      std::string_view data, http::OStream& os) override
+    {
+        body += data;
+        return data.size();
+    }
+    void do_on_http_message(CyclTime now, const Endpoint& ep, const Request& req,
+                            http::OStream& os) override
+    {
+        ++messages;
+        os.reset(Status::Ok, "text/plain");
+        os << "ok";
+        os.commit();
+    }
+    void do_on_http_message_end(CyclTime now, const Endpoint& ep, const Request& req,
+                                http::OStream& os) override
+    {
+        do_on_http_message(now, ep, req, os);
+    }
+    void do_on_http_timeout(CyclTime now, const Endpoint& ep) noexcept override {}
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(AdmissionSuite)
+
+BOOST_AUTO_TEST_CASE(AdmissionConnCase)
+{
+    Admission admission{2};
+    const auto ep1 = parse_stream_endpoint("tcp4://192.168.1.3:1000");
+    const auto ep2 = parse_stream_endpoint("tcp4://192.168.1.3:1001");
+    const auto ep3 = parse_stream_endpoint("tcp4://192.168.1.3:1002");
+    const auto other = parse_stream_endpoint("tcp6://[::1]:1000");
+
+    // The cap applies to the address, regardless of the port.
+    BOOST_TEST(admission.on_connect(ep1));
+    BOOST_TEST(admission.on_connect(ep2));
+    BOOST_TEST(!admission.on_connect(ep3));
+    BOOST_TEST(admission.conn_count(ep3) == 2U);
+    BOOST_TEST(admission.on_connect(other));
+
+    admission.on_disconnect(ep1);
+    BOOST_TEST(admission.conn_count(ep1) == 1U);
+    BOOST_TEST(admission.on_connect(ep3));
+
+    // Unix domain sockets are not capped.
+    const auto local = parse_stream_endpoint("unix:///tmp/admission.sock");
+    for (int i{0}; i < 3; ++i) {
+        BOOST_TEST(admission.on_connect(local));
+    }
+    BOOST_TEST(admission.conn_count(local) == 0U);
+
+    // A zero cap is unlimited.
+    admission.set_max_conns_per_addr(0);
+    BOOST_TEST(admission.on_connect(ep1));
+    BOOST_TEST(admission.conn_count(ep1) == 3U);
+}
+
+BOOST_AUTO_TEST_CASE(AdmissionRateCase)
+{
+    Admission admission;
+    admission.set_rate_limit("/api", RateLimit{2, 1s});
+
+    const auto t = MonoClock::now();
+    BOOST_TEST(admission.on_request(t, "/api"));
+    BOOST_TEST(admission.on_request(t, "/api"));
+    BOOST_TEST(!admission.on_request(t, "/api"));
+    // Rejected requests are not counted.
+    BOOST_TEST(!admission.on_request(t + 500ms, "/api"));
+    // Other routes are not limited.
+    BOOST_TEST(admission.on_request(t, "/other"));
+    // The window has moved on.
+    BOOST_TEST(admission.on_request(t + 1s, "/api"));
+
+    admission.erase_rate_limit("/api");
+    BOOST_TEST(admission.on_request(t + 1s, "/api"));
+    BOOST_TEST(admission.on_request(t + 1s, "/api"));
+}
+
+BOOST_AUTO_TEST_CASE(AdmissionServCase)
+{
+    const string path{"/tmp/tb-http-admission-"s + to_string(getpid()) + ".sock"};
+    unlink(path.c_str());
+    const auto ep = parse_stream_endpoint("unix://" + path);
+
+    Reactor reactor{1024};
+    Admission admission;
+    admission.set_rate_limit("/api", RateLimit{1, 10s});
+    TestApp app{admission};
+    {
+        Serv serv{CyclTime::now(), reactor, ep, app};
+        StreamSockClnt sock{ep.protocol()};
+        sock.connect(ep);
+
+        // Both requests are sent together, so the second is rejected from the same batch.
+        const auto req = "GET /api HTTP/1.1\r\nHost: localhost\r\n\r\n"s;
+        const auto reqs = req + req;
+        sock.send(reqs.data(), reqs.size(), 0);
+
+        string out;
+        const auto end = MonoClock::now() + 1s;
+        while (out.find(TooManyRequestsResponse) == string::npos && MonoClock::now() < end) {
+            reactor.poll(CyclTime::now(), 10ms);
+            char buf[1024];
+            error_code ec;
+            const auto n = sock.recv(buf, sizeof(buf), MSG_DONTWAIT, ec);
+            if (n > 0) {
+                out.append(buf, n);
+            }
+        }
+        BOOST_TEST(out.find("HTTP/1.1 200 OK\r\n") == 0U);
+        BOOST_TEST(out.find(TooManyRequestsResponse) != string::npos);
+        BOOST_TEST(app.messages == 1);
+    }
+    unlink(path.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(AdmissionStreamCase)
+{
+    const string path{"/tmp/tb-http-admission-stream-"s + to_string(getpid()) + ".sock"};
+    unlink(path.c_str());
+    const auto ep = parse_stream_endpoint("unix://" + path);
+
+    Reactor reactor{1024};
+    Admission admission;
+    admission.set_rate_limit("/upload", RateLimit{1, 10s});
+    TestApp app{admission};
+    {
+        Serv serv{CyclTime::now(), reactor, ep, app};
+        StreamSockClnt sock{ep.protocol()};
+        sock.connect(ep);
+
+        // The second upload is rejected before the application can choose to stream its body.
+        const auto reqs = "POST /upload HTTP/1.1\r\nHost: localhost\r\nContent-Length: 5\r\n\r\n"
+                          "first"
+                          "POST /upload HTTP/1.1\r\nHost: localhost\r\nContent-Length: 6\r\n\r\n"
+                          "second"s;
+        sock.send(reqs.data(), reqs.size(), 0);
+
+        string out;
+        const auto end = MonoClock::now() + 1s;
+        while (out.find(TooManyRequestsResponse) == string::npos && MonoClock::now() < end) {
+            reactor.poll(CyclTime::now(), 10ms);
+            char buf[1024];
+            error_code ec;
+            const auto n = sock.recv(buf, sizeof(buf), MSG_DONTWAIT, ec);
+            if (n > 0) {
+                out.append(buf, n);
+            }
+        }
+        BOOST_TEST(out.find("HTTP/1.1 200 OK\r\n") == 0U);
+        BOOST_TEST(out.find(TooManyRequestsResponse) != string::npos);
+        BOOST_TEST(app.messages == 1);
+        BOOST_TEST(app.body == "first");
+    }
+    unlink(path.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -21,5 +21,22 @@ inline namespace http {
 
 App::~App() = default;
 
+bool App::do_on_http_headers(CyclTime now, const Endpoint& ep, const Request& req)
+{
+    return false;
+}
+
+std::size_t App::do_on_http_body_chunk(CyclTime now, const Endpoint& ep, const Request& req,
+                                       std::string_view data, OStream& os)
+{
+    return data.size();
+}
+
+void App::do_on_http_message_end(CyclTime now, const Endpoint& ep, const Request& req,
+                                 OStream& os)
+{
+    do_on_http_message(now, ep, req, os);
+}
+
 } // namespace http
 } // namespace toolbox
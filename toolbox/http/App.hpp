@@ -22,8 +22,11 @@
 namespace toolbox {
 inline namespace http {
 
+class Admission;
 class OStream;
 class Request;
+class ResponseCache;
+class WsApp;
 
 class TOOLBOX_API App {
   public:
@@ -51,21 +54,75 @@ class TOOLBOX_API App {
     {
         do_on_http_error(now, ep, e, os);
     }
+    /// Called when the request head has been received. Returns true if the body should be
+    /// streamed to on_http_body_chunk() instead of being buffered in the request.
+    bool on_http_headers(CyclTime now, const Endpoint& ep, const Request& req)
+    {
+        return do_on_http_headers(now, ep, req);
+    }
+    /// Called with each fragment of a streamed body, as it is received. Chunked bodies are not
+    /// reassembled. Returns the number of bytes consumed, which may be less than the fragment size
+    /// if the application is behind. The connection then stops reading from the socket until the
+    /// application calls OStream::resume(), and then offers the remainder again.
+    std::size_t on_http_body_chunk(CyclTime now, const Endpoint& ep, const Request& req,
+                                   std::string_view data, OStream& os)
+    {
+        return do_on_http_body_chunk(now, ep, req, data, os);
+    }
     void on_http_message(CyclTime now, const Endpoint& ep, const Request& req, OStream& os)
     {
         do_on_http_message(now, ep, req, os);
     }
+    /// Called instead of on_http_message() when a streamed message is complete. The request body
+    /// is empty.
+    void on_http_message_end(CyclTime now, const Endpoint& ep, const Request& req, OStream& os)
+    {
+        do_on_http_message_end(now, ep, req, os);
+    }
     void on_http_timeout(CyclTime now, const Endpoint& ep) noexcept { do_on_http_timeout(now, ep); }
 
+    /// Returns the application's cache of pre-serialised responses, or null if it has none.
+    /// Requests that hit the cache are answered by the connection without calling
+    /// on_http_message().
+    ResponseCache* response_cache() const noexcept { return response_cache_; }
+    /// Returns the application's admission control, or null if all connections and requests are
+    /// admitted.
+    Admission* admission() const noexcept { return admission_; }
+    /// Returns the options for compressing response bodies, which is disabled by default.
+    const CompressOptions& compression() const noexcept { return copts_; }
+    /// Returns the application that accepts WebSocket upgrades, or null if upgrades are not
+    /// supported.
+    WsApp* ws_app() const noexcept { return ws_app_; }
+
   protected:
+    /// The cache is owned by the derived class and must outlive the connections.
+    void set_response_cache(ResponseCache* cache) noexcept { response_cache_ = cache; }
+    /// The admission control is owned by the derived class and must outlive the connections.
+    void set_admission(Admission* admission) noexcept { admission_ = admission; }
+    void set_compression(const CompressOptions& opts) noexcept { copts_ = opts; }
+    /// The WebSocket application must outlive the connections.
+    void set_ws_app(WsApp* ws_app) noexcept { ws_app_ = ws_app; }
+
     virtual void do_on_http_connect(CyclTime now, const Endpoint& ep) = 0;
     virtual void do_on_http_disconnect(CyclTime now, const Endpoint& ep) noexcept = 0;
     virtual void do_on_http_error(CyclTime now, const Endpoint& ep, const std::exception& e,
                                   OStream& os) noexcept = 0;
+    virtual bool do_on_http_headers(CyclTime now, const Endpoint& ep, const Request& req);
+    virtual std::size_t do_on_http_body_chunk(CyclTime now, const Endpoint& ep,
+                                              const Request& req, std::string_view data,
+                                              OStream& os);
     virtual void do_on_http_message(CyclTime now, const Endpoint& ep, const Request& req,
                                     OStream& os)
         = 0;
+    virtual void do_on_http_message_end(CyclTime now, const Endpoint& ep, const Request& req,
+                                        OStream& os);
     virtual void do_on_http_timeout(CyclTime now, const Endpoint& ep) noexcept = 0;
+
+  private:
+    ResponseCache* response_cache_{nullptr};
+    Admission* admission_{nullptr};
+    CompressOptions copts_;
+    WsApp* ws_app_{nullptr};
 };
 
 } // namespace http
@@ -0,0 +1,237 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Clnt.hpp"
+
+#include <toolbox/sys/Log.hpp>
+
+#include <charconv>
+
+namespace toolbox {
+inline namespace http {
+using namespace std;
+namespace {
+
+bool has_body(Method method, string_view body) noexcept
+{
+    return !body.empty() || method == Method::Post || method == Method::Put
+        || method == Method::Patch;
+}
+
+void put_request(string& buf, Method method, string_view target, string_view host,
+                 string_view headers, string_view body)
+{
+    buf.clear();
+    buf += enum_string(method);
+    buf += ' ';
+    buf += target;
+    buf += " HTTP/1.1\r\nHost: ";
+    buf += host;
+    buf += "\r\n";
+    buf += headers;
+    if (has_body(method, body)) {
+        char len[20];
+        const auto [end, ec] = to_chars(len, len + sizeof(len), body.size());
+        buf += "Content-Length: ";
+        buf.append(len, end);
+        buf += "\r\n";
+    }
+    buf += "\r\n";
+    buf += body;
+}
+
+} // namespace
+
+Clnt::Clnt(CyclTime now, Reactor& r, const Endpoint& ep, string host, ClntOptions opts)
+: reactor_{r}
+, ep_{ep}
+, host_{std::move(host)}
+, opts_{opts}
+{
+}
+
+Clnt::~Clnt()
+{
+    const auto now = CyclTime::current();
+    closed_ = true;
+    conn_list_.clear_and_dispose([now](auto* conn) {
+        conn->detach();
+        conn->dispose(now);
+    });
+    Response resp;
+    for (const auto& req : queue_) {
+        try {
+            req.handler(now, make_error_code(errc::operation_canceled), resp);
+        } catch (const std::exception& e) {
+            TOOLBOX_ERROR << "exception in http response handler: " << e.what();
+        }
+    }
+}
+
+size_t Clnt::conn_count() const noexcept
+{
+    return distance(conn_list_.begin(), conn_list_.end());
+}
+
+void Clnt::request(CyclTime now, Method method, string_view target, string_view headers,
+                   string_view body, Handler handler)
+{
+    put_request(buf_, method, target, host_, headers, body);
+    const auto deadline = now.mono_time() + opts_.timeout;
+    if (queue_.empty()) {
+        if (auto* const conn = select(); conn) {
+            conn->send(now, buf_, method, handler, deadline);
+            return;
+        }
+    }
+    queue_.push_back({buf_, handler, deadline, method});
+    if (queue_.size() == 1) {
+        schedule_timer(now);
+    }
+    open_conn(now);
+}
+
+void Clnt::on_sock_connect(CyclTime now, IoSock&& sock, const Endpoint& ep)
+{
+    connecting_ = false;
+    auto* const conn = new ClntConn{now, reactor_, std::move(sock), ep, *this, opts_.idle_timeout};
+    conn_list_.push_back(*conn);
+    drain(now);
+}
+
+void Clnt::on_sock_connect_error(CyclTime now, const std::exception& e)
+{
+    connecting_ = false;
+    if (!conn_list_.empty()) {
+        // The queued requests will be sent on the existing connections.
+        return;
+    }
+    error_code ec{make_error_code(errc::connection_refused)};
+    if (const auto* se = dynamic_cast<const system_error*>(&e)) {
+        ec = se->code();
+    }
+    // Fail the requests that were waiting for the connection.
+    Response resp;
+    auto queue = std::move(queue_);
+    queue_.clear();
+    tmr_.reset();
+    for (const auto& req : queue) {
+        try {
+            req.handler(now, ec, resp);
+        } catch (const std::exception& ex) {
+            TOOLBOX_ERROR << "exception in http response handler: " << ex.what();
+        }
+    }
+}
+
+void Clnt::on_conn_ready(CyclTime now)
+{
+    if (!closed_ && !queue_.empty()) {
+        drain(now);
+    }
+}
+
+void Clnt::on_timer(CyclTime now, Timer& tmr)
+{
+    Response resp;
+    while (!queue_.empty() && queue_.front().deadline <= now.mono_time()) {
+        const auto handler = queue_.front().handler;
+        queue_.pop_front();
+        try {
+            handler(now, make_error_code(errc::timed_out), resp);
+        } catch (const std::exception& e) {
+            TOOLBOX_ERROR << "exception in http response handler: " << e.what();
+        }
+    }
+    schedule_timer(now);
+}
+
+ClntConn* Clnt::select() noexcept
+{
+    ClntConn* best{nullptr};
+    size_t count{0};
+    for (auto& conn : conn_list_) {
+        if (!conn.is_open()) {
+            continue;
+        }
+        ++count;
+        if (conn.in_flight() == 0) {
+            return &conn;
+        }
+        if (conn.in_flight() < opts_.max_pipeline
+            && (!best || conn.in_flight() < best->in_flight())) {
+            best = &conn;
+        }
+    }
+    // Prefer a new connection to pipelining.
+    if (count + (connecting_ ? 1 : 0) < opts_.max_conns) {
+        return nullptr;
+    }
+    return best;
+}
+
+void Clnt::open_conn(CyclTime now)
+{
+    if (connecting_ || closed_) {
+        return;
+    }
+    size_t count{0};
+    for (const auto& conn : conn_list_) {
+        if (conn.is_open()) {
+            ++count;
+        }
+    }
+    if (count >= opts_.max_conns) {
+        return;
+    }
+    // The connection may be established synchronously, in which case on_sock_connect() is called
+    // before connect() returns.
+    connecting_ = true;
+    try {
+        connect(now, reactor_, ep_);
+    } catch (const std::exception& e) {
+        on_sock_connect_error(now, e);
+    }
+}
+
+void Clnt::drain(CyclTime now)
+{
+    const auto size = queue_.size();
+    while (!queue_.empty()) {
+        auto* const conn = select();
+        if (!conn) {
+            open_conn(now);
+            break;
+        }
+        auto req = std::move(queue_.front());
+        queue_.pop_front();
+        conn->send(now, req.data, req.method, req.handler, req.deadline);
+    }
+    if (queue_.size() != size) {
+        schedule_timer(now);
+    }
+}
+
+void Clnt::schedule_timer(CyclTime now)
+{
+    if (queue_.empty()) {
+        tmr_.reset();
+        return;
+    }
+    tmr_ = reactor_.timer(queue_.front().deadline, Priority::Low, bind<&Clnt::on_timer>(this));
+}
+
+} // namespace http
+} // namespace toolbox
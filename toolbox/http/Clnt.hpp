@@ -0,0 +1,122 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_HTTP_CLNT_HPP
+#define TOOLBOX_HTTP_CLNT_HPP
+
+#include <toolbox/http/ClntConn.hpp>
+#include <toolbox/net/StreamConnector.hpp>
+
+namespace toolbox {
+inline namespace http {
+
+struct ClntOptions {
+    /// Maximum number of connections to the host.
+    std::size_t max_conns{4};
+    /// Maximum number of requests in flight on each connection. Note that pipelining is only
+    /// safe for idempotent requests, so set this to one if that cannot be guaranteed.
+    std::size_t max_pipeline{8};
+    /// Time allowed for a request to complete, including any time spent queued.
+    Duration timeout{std::chrono::seconds{5}};
+    /// Time after which an idle connection is closed.
+    Duration idle_timeout{std::chrono::seconds{30}};
+};
+
+/// Clnt is a non-blocking HTTP/1.1 client with a keep-alive connection pool for a single host.
+///
+/// Requests are assigned to an idle connection if there is one. Otherwise, a new connection is
+/// opened until the pool is full, after which requests are pipelined on the least loaded
+/// connection. Requests are queued when all connections are at their pipeline limit. All
+/// completion handlers are called on the reactor thread.
+class TOOLBOX_API Clnt : public StreamConnector<Clnt> {
+
+    friend StreamConnector<Clnt>;
+    friend class ClntConn;
+
+    using ConstantTimeSizeOption = boost::intrusive::constant_time_size<false>;
+    using MemberHookOption
+        = boost::intrusive::member_hook<ClntConn, decltype(ClntConn::list_hook),
+                                        &ClntConn::list_hook>;
+    using ConnList = boost::intrusive::list<ClntConn, ConstantTimeSizeOption, MemberHookOption>;
+
+  public:
+    using Handler = ClntConn::Handler;
+
+    /// The host is sent in the Host header of each request.
+    Clnt(CyclTime now, Reactor& r, const Endpoint& ep, std::string host, ClntOptions opts = {});
+    ~Clnt();
+
+    // Copy.
+    Clnt(const Clnt&) = delete;
+    Clnt& operator=(const Clnt&) = delete;
+
+    // Move.
+    Clnt(Clnt&&) = delete;
+    Clnt& operator=(Clnt&&) = delete;
+
+    const Endpoint& endpoint() const noexcept { return ep_; }
+    /// Returns the number of open connections.
+    std::size_t conn_count() const noexcept;
+    /// Returns the number of requests waiting for a connection.
+    std::size_t queued() const noexcept { return queue_.size(); }
+
+    /// Send a request. The headers are serialised header fields, each terminated by CRLF. The Host
+    /// header is added, as is a Content-Length header for requests with a body.
+    void request(CyclTime now, Method method, std::string_view target, std::string_view headers,
+                 std::string_view body, Handler handler);
+    void get(CyclTime now, std::string_view target, Handler handler)
+    {
+        request(now, Method::Get, target, {}, {}, handler);
+    }
+
+  private:
+    struct Queued {
+        std::string data;
+        Handler handler;
+        MonoTime deadline;
+        Method method;
+    };
+
+    void on_sock_prepare(CyclTime now, IoSock& sock) {}
+    void on_sock_connect(CyclTime now, IoSock&& sock, const Endpoint& ep);
+    void on_sock_connect_error(CyclTime now, const std::exception& e);
+    /// Called by a connection when it has completed a request, or has been closed.
+    void on_conn_ready(CyclTime now);
+    void on_timer(CyclTime now, Timer& tmr);
+    /// Returns the connection that the next request should be sent on, or null if the request
+    /// should wait for a new connection.
+    ClntConn* select() noexcept;
+    void open_conn(CyclTime now);
+    /// Send queued requests while connections are available.
+    void drain(CyclTime now);
+    void schedule_timer(CyclTime now);
+
+    Reactor& reactor_;
+    const Endpoint ep_;
+    const std::string host_;
+    const ClntOptions opts_;
+    Timer tmr_;
+    /// Scratch buffer for serialised requests.
+    std::string buf_;
+    std::deque<Queued> queue_;
+    bool connecting_{false}, closed_{false};
+    // List of active connections.
+    ConnList conn_list_;
+};
+
+} // namespace http
+} // namespace toolbox
+
+#endif // TOOLBOX_HTTP_CLNT_HPP
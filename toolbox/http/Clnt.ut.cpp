@@ -0,0 +1,203 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Clnt.hpp"
+
+#include <toolbox/http/App.hpp>
+#include <toolbox/http/Serv.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <unistd.h>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+class TestApp final : public App {
+  protected:
+    void do_on_http_connect(CyclTime now, const Endpoint& ep) override {}
+    void do_on_http_disconnect(CyclTime now, const Endpoint& ep) noexcept override {}
+    void do_on_http_error(CyclTime now, const Endpoint& ep, const std::exception& e,
+                          http::OStream& os) noexcept override
+    {
+    }
+    void do_on_http_message(CyclTime now, const Endpoint& ep, const Request& req,
+                            http::OStream& os) override
+    {
+        // Leave slow requests unanswered.
+        if (req.path() != "/slow") {
+            os.reset(Status::Ok, "text/plain");
+            os << req.method() << ' ' << req.path() << ' ' << req.body();
+            os.commit();
+        }
+    }
+    void do_on_http_timeout(CyclTime now, const Endpoint& ep) noexcept override {}
+};
+
+struct Result {
+    error_code ec;
+    int status{0};
+    string body;
+};
+
+class Handler {
+  public:
+    void on_response(CyclTime now, error_code ec, const Response& resp)
+    {
+        results.push_back({ec, resp.status(), string{resp.body()}});
+    }
+    vector<Result> results;
+};
+
+struct Fixture {
+    Fixture()
+    {
+        unlink(path.c_str());
+    }
+    ~Fixture() { unlink(path.c_str()); }
+    /// Poll the reactor until the predicate is satisfied or a second has elapsed.
+    template <typename FnT>
+    bool poll_until(FnT fn)
+    {
+        const auto end = MonoClock::now() + 1s;
+        while (!fn()) {
+            if (MonoClock::now() > end) {
+                return false;
+            }
+            reactor.poll(CyclTime::now(), 10ms);
+        }
+        return true;
+    }
+    const string path{"/tmp/tb-http-clnt-"s + to_string(getpid()) + ".sock"};
+    const StreamEndpoint ep{parse_stream_endpoint("unix://" + path)};
+    Reactor reactor{1024};
+    TestApp app;
+};
+
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(ClntSuite, Fixture)
+
+BOOST_AUTO_TEST_CASE(ClntRequestCase)
+{
+    const auto now = CyclTime::now();
+    Serv serv{now, reactor, ep, app};
+    Clnt clnt{now, reactor, ep, "localhost"};
+    Handler h;
+
+    clnt.get(now, "/foo", bind<&Handler::on_response>(&h));
+    clnt.request(now, Method::Post, "/bar", "Content-Type: text/plain\r\n", "baz",
+                 bind<&Handler::on_response>(&h));
+    BOOST_TEST(poll_until([&h]() { return h.results.size() == 2; }));
+    BOOST_TEST(!h.results[0].ec);
+    BOOST_TEST(h.results[0].status == 200);
+    BOOST_TEST(h.results[0].body == "GET /foo "s);
+    BOOST_TEST(!h.results[1].ec);
+    BOOST_TEST(h.results[1].body == "POST /bar baz"s);
+    BOOST_TEST(clnt.conn_count() == 2U);
+
+    // Idle connections are reused.
+    clnt.get(CyclTime::now(), "/qux", bind<&Handler::on_response>(&h));
+    BOOST_TEST(poll_until([&h]() { return h.results.size() == 3; }));
+    BOOST_TEST(h.results[2].body == "GET /qux "s);
+    BOOST_TEST(clnt.conn_count() == 2U);
+}
+
+BOOST_AUTO_TEST_CASE(ClntPipelineCase)
+{
+    const auto now = CyclTime::now();
+    Serv serv{now, reactor, ep, app};
+    Clnt clnt{now, reactor, ep, "localhost", {.max_conns = 1, .max_pipeline = 4}};
+    Handler h;
+
+    for (int i{0}; i < 10; ++i) {
+        string path{"/"};
+        path += to_string(i);
+        clnt.get(now, path, bind<&Handler::on_response>(&h));
+    }
+    // One request is waiting for the connection, or four are in flight if it was established
+    // synchronously.
+    BOOST_TEST(clnt.queued() >= 6U);
+    BOOST_TEST(poll_until([&h]() { return h.results.size() == 10; }));
+    for (int i{0}; i < 10; ++i) {
+        BOOST_TEST(!h.results[i].ec);
+        string body{"GET /"};
+        body += to_string(i);
+        body += ' ';
+        BOOST_TEST(h.results[i].body == body);
+    }
+    BOOST_TEST(clnt.conn_count() == 1U);
+    BOOST_TEST(clnt.queued() == 0U);
+}
+
+BOOST_AUTO_TEST_CASE(ClntTimeoutCase)
+{
+    const auto now = CyclTime::now();
+    Serv serv{now, reactor, ep, app};
+    Clnt clnt{now, reactor, ep, "localhost", {.timeout = 50ms}};
+    Handler h;
+
+    clnt.get(now, "/slow", bind<&Handler::on_response>(&h));
+    BOOST_TEST(poll_until([&h]() { return h.results.size() == 1; }));
+    BOOST_TEST((h.results[0].ec == errc::timed_out));
+    BOOST_TEST(clnt.conn_count() == 0U);
+
+    // A new connection is opened for the next request.
+    clnt.get(CyclTime::now(), "/foo", bind<&Handler::on_response>(&h));
+    BOOST_TEST(poll_until([&h]() { return h.results.size() == 2; }));
+    BOOST_TEST(!h.results[1].ec);
+}
+
+BOOST_AUTO_TEST_CASE(ClntDestroyInHandlerCase)
+{
+    const auto now = CyclTime::now();
+    Serv serv{now, reactor, ep, app};
+    auto clnt = make_unique<Clnt>(now, reactor, ep, "localhost");
+
+    struct Handler {
+        void on_response(CyclTime now, error_code ec, const Response& resp)
+        {
+            results.push_back(ec);
+            // Destroy the client from within its own callback.
+            clnt.reset();
+        }
+        unique_ptr<Clnt>& clnt;
+        vector<error_code> results;
+    } h{clnt, {}};
+
+    clnt->get(now, "/foo", bind<&Handler::on_response>(&h));
+    BOOST_TEST(poll_until([&h]() { return !h.results.empty(); }));
+    BOOST_TEST(!h.results[0]);
+    BOOST_TEST(!clnt);
+    // The connection is closed without calling back into the destroyed client.
+    reactor.poll(CyclTime::now(), 0ms);
+    BOOST_TEST(h.results.size() == 1U);
+}
+
+BOOST_AUTO_TEST_CASE(ClntConnectErrorCase)
+{
+    const auto now = CyclTime::now();
+    Clnt clnt{now, reactor, ep, "localhost"};
+    Handler h;
+
+    clnt.get(now, "/foo", bind<&Handler::on_response>(&h));
+    BOOST_TEST(poll_until([&h]() { return h.results.size() == 1; }));
+    BOOST_TEST(h.results[0].ec);
+    BOOST_TEST(h.results[0].status == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
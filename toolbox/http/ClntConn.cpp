@@ -0,0 +1,290 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ClntConn.hpp"
+
+#include <toolbox/http/Clnt.hpp>
+#include <toolbox/sys/Log.hpp>
+
+namespace toolbox {
+inline namespace http {
+using namespace std;
+namespace {
+
+error_code to_error_code(const exception& e) noexcept
+{
+    if (const auto* se = dynamic_cast<const system_error*>(&e)) {
+        return se->code();
+    }
+    if (dynamic_cast<const Exception*>(&e)) {
+        return make_error_code(errc::bad_message);
+    }
+    return make_error_code(errc::io_error);
+}
+
+} // namespace
+
+ClntConn::ClntConn(CyclTime now, Reactor& r, IoSock&& sock, const Endpoint& ep, Clnt& clnt,
+                   Duration idle_timeout)
+: BasicParser<ClntConn>{Type::Response}
+, reactor_{r}
+, sock_{std::move(sock)}
+, ep_{ep}
+, clnt_{&clnt}
+, idle_timeout_{idle_timeout}
+{
+    sub_ = r.subscribe(*sock_, EpollIn, bind<&ClntConn::on_io_event>(this));
+    schedule_timer(now);
+}
+
+ClntConn::~ClntConn() = default;
+
+void ClntConn::send(CyclTime now, string_view data, Method method, Handler handler,
+                    MonoTime deadline)
+{
+    assert(!closing_);
+    const auto buf = out_.prepare(data.size());
+    memcpy(buffer_cast<char*>(buf), data.data(), data.size());
+    out_.commit(data.size());
+    pending_.push_back({handler, deadline, method});
+    if (pending_.size() == 1) {
+        schedule_timer(now);
+    }
+    if (!write_blocked_) {
+        auto lock = lock_this(now);
+        try {
+            flush_output(now);
+        } catch (const std::exception& e) {
+            fail(now, to_error_code(e));
+            dispose(now);
+        }
+    }
+}
+
+void ClntConn::dispose_now(CyclTime now) noexcept
+{
+    fail(now, make_error_code(errc::connection_aborted));
+    // Remove the connection from the pool before the pool is notified, so that it is not
+    // selected for queued requests.
+    if (list_hook.is_linked()) {
+        list_hook.unlink();
+    }
+    if (clnt_) {
+        clnt_->on_conn_ready(now);
+    }
+    delete this;
+}
+
+bool ClntConn::on_http_message_begin(CyclTime now) noexcept
+{
+    resp_.clear();
+    // The server must not send a response before the request.
+    return !pending_.empty();
+}
+
+bool ClntConn::on_http_status(CyclTime now, string_view sv) noexcept
+{
+    bool ret{false};
+    try {
+        resp_.append_reason(sv);
+        ret = true;
+    } catch (const std::exception& e) {
+        TOOLBOX_ERROR << "http client error: " << e.what();
+    }
+    return ret;
+}
+
+bool ClntConn::on_http_header_field(CyclTime now, string_view sv, First first) noexcept
+{
+    bool ret{false};
+    try {
+        resp_.append_header_field(sv, first);
+        ret = true;
+    } catch (const std::exception& e) {
+        TOOLBOX_ERROR << "http client error: " << e.what();
+    }
+    return ret;
+}
+
+bool ClntConn::on_http_header_value(CyclTime now, string_view sv, First first) noexcept
+{
+    bool ret{false};
+    try {
+        resp_.append_header_value(sv, first);
+        ret = true;
+    } catch (const std::exception& e) {
+        TOOLBOX_ERROR << "http client error: " << e.what();
+    }
+    return ret;
+}
+
+bool ClntConn::on_http_headers_end(CyclTime now) noexcept
+{
+    bool ret{false};
+    try {
+        resp_.set_status(status_code(), http_minor());
+        resp_.flush();
+        if (pending_.front().method == Method::Head) {
+            // Responses to HEAD requests describe a body that is not sent.
+            skip_body();
+        }
+        ret = true;
+    } catch (const std::exception& e) {
+        TOOLBOX_ERROR << "http client error: " << e.what();
+    }
+    return ret;
+}
+
+bool ClntConn::on_http_body(CyclTime now, string_view sv) noexcept
+{
+    bool ret{false};
+    try {
+        resp_.append_body(sv);
+        ret = true;
+    } catch (const std::exception& e) {
+        TOOLBOX_ERROR << "http client error: " << e.what();
+    }
+    return ret;
+}
+
+bool ClntConn::on_http_message_end(CyclTime now) noexcept
+{
+    const auto handler = pending_.front().handler;
+    pending_.pop_front();
+    if (!should_keep_alive()) {
+        closing_ = true;
+    }
+    try {
+        handler(now, {}, resp_);
+    } catch (const std::exception& e) {
+        TOOLBOX_ERROR << "exception in http response handler: " << e.what();
+    }
+    schedule_timer(now);
+    // The handler may have destroyed the Clnt, in which case the connection has been detached.
+    if (!closing_ && clnt_) {
+        clnt_->on_conn_ready(now);
+    }
+    return true;
+}
+
+void ClntConn::on_io_event(CyclTime now, int fd, unsigned events)
+{
+    auto lock = lock_this(now);
+    try {
+        if (events & (EpollIn | EpollHup)) {
+            if (!drain_input(now, fd)) {
+                fail(now, make_error_code(errc::connection_reset));
+                dispose(now);
+                return;
+            }
+        }
+        if (write_blocked_ && (events & EpollOut)) {
+            flush_output(now);
+        }
+        if (closing_ && pending_.empty()) {
+            dispose(now);
+        }
+    } catch (const std::exception& e) {
+        fail(now, to_error_code(e));
+        dispose(now);
+    }
+}
+
+void ClntConn::on_timer(CyclTime now, Timer& tmr)
+{
+    auto lock = lock_this(now);
+    // Otherwise, the connection has been idle for too long.
+    if (!pending_.empty()) {
+        fail(now, make_error_code(errc::timed_out));
+    }
+    dispose(now);
+}
+
+bool ClntConn::drain_input(CyclTime now, int fd)
+{
+    // Limit the number of reads to avoid starvation.
+    for (int i{0}; i < 4; ++i) {
+        error_code ec;
+        const auto buf = in_.prepare(16384);
+        const auto size = os::read(fd, buf, ec);
+        if (ec) {
+            // No data available in socket buffer.
+            if (ec == errc::operation_would_block) {
+                break;
+            }
+            throw system_error{ec, "read"};
+        }
+        if (size == 0) {
+            // An empty buffer signals EOF to the parser, which completes a response that is
+            // delimited by the end of the connection.
+            parse(now, in_.data());
+            parse(now, {});
+            return false;
+        }
+        // Commit actual bytes read.
+        in_.commit(size);
+        // Assume that the TCP stream has been drained if we read less than the requested amount.
+        if (static_cast<size_t>(size) < buffer_size(buf)) {
+            break;
+        }
+    }
+    in_.consume(parse(now, in_.data()));
+    return true;
+}
+
+void ClntConn::flush_output(CyclTime now)
+{
+    error_code ec;
+    // Report a closed connection as an error rather than raising SIGPIPE.
+    const auto size = sock_.send(out_.data(), MSG_NOSIGNAL, ec);
+    if (ec) {
+        if (ec != errc::operation_would_block) {
+            throw system_error{ec, "write"};
+        }
+    } else {
+        out_.consume(size);
+    }
+    const bool blocked{!out_.empty()};
+    if (blocked != write_blocked_) {
+        // Poll for writability until the output buffer has been drained.
+        sub_.set_events(blocked ? EpollIn | EpollOut : EpollIn);
+        write_blocked_ = blocked;
+    }
+}
+
+void ClntConn::fail(CyclTime now, error_code ec) noexcept
+{
+    closing_ = true;
+    while (!pending_.empty()) {
+        const auto handler = pending_.front().handler;
+        pending_.pop_front();
+        resp_.clear();
+        try {
+            handler(now, ec, resp_);
+        } catch (const std::exception& e) {
+            TOOLBOX_ERROR << "exception in http response handler: " << e.what();
+        }
+    }
+}
+
+void ClntConn::schedule_timer(CyclTime now)
+{
+    const auto expiry = pending_.empty() ? now.mono_time() + idle_timeout_ //
+                                         : pending_.front().deadline;
+    tmr_ = reactor_.timer(expiry, Priority::Low, bind<&ClntConn::on_timer>(this));
+}
+
+} // namespace http
+} // namespace toolbox
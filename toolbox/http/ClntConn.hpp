@@ -0,0 +1,136 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_HTTP_CLNTCONN_HPP
+#define TOOLBOX_HTTP_CLNTCONN_HPP
+
+#include <toolbox/http/Parser.hpp>
+#include <toolbox/http/Response.hpp>
+#include <toolbox/io/Disposer.hpp>
+#include <toolbox/io/Reactor.hpp>
+#include <toolbox/net/Endpoint.hpp>
+#include <toolbox/net/IoSock.hpp>
+
+#include <boost/intrusive/list.hpp>
+
+#include <deque>
+
+namespace toolbox {
+inline namespace http {
+class Clnt;
+
+/// ClntConn is a client connection owned by Clnt. Requests are written as soon as they are sent,
+/// so that several may be in flight at once, and responses are matched to requests in order.
+class TOOLBOX_API ClntConn
+: public BasicDisposer<ClntConn>
+, BasicParser<ClntConn> {
+
+    friend class BasicDisposer<ClntConn>;
+    friend class BasicParser<ClntConn>;
+
+    // Automatically unlink when object is destroyed.
+    using AutoUnlinkOption = boost::intrusive::link_mode<boost::intrusive::auto_unlink>;
+
+  public:
+    using Endpoint = StreamEndpoint;
+    /// The handler is called once for each request, on the reactor thread. The error code is set
+    /// if the request failed, in which case the response is empty. Handlers must not throw.
+    using Handler = BasicSlot<CyclTime, std::error_code, const Response&>;
+
+    ClntConn(CyclTime now, Reactor& r, IoSock&& sock, const Endpoint& ep, Clnt& clnt,
+             Duration idle_timeout);
+
+    // Copy.
+    ClntConn(const ClntConn&) = delete;
+    ClntConn& operator=(const ClntConn&) = delete;
+
+    // Move.
+    ClntConn(ClntConn&&) = delete;
+    ClntConn& operator=(ClntConn&&) = delete;
+
+    const Endpoint& endpoint() const noexcept { return ep_; }
+    /// Returns the number of requests awaiting a response.
+    std::size_t in_flight() const noexcept { return pending_.size(); }
+    /// Returns false if the connection will not accept further requests, because the server has
+    /// asked for it to be closed or because it has failed.
+    bool is_open() const noexcept { return !closing_; }
+
+    /// Write a serialised request. The request fails with std::errc::timed_out if the response
+    /// has not been received by the deadline, and the connection is then closed, because the
+    /// responses to any pipelined requests can no longer be matched.
+    void send(CyclTime now, std::string_view data, Method method, Handler handler,
+              MonoTime deadline);
+    /// Called by the owning Clnt when it is destroyed, before the connection is disposed. The
+    /// connection may outlive the Clnt if it is disposed from within one of its own callbacks.
+    void detach() noexcept
+    {
+        clnt_ = nullptr;
+        closing_ = true;
+    }
+
+    boost::intrusive::list_member_hook<AutoUnlinkOption> list_hook;
+
+  protected:
+    void dispose_now(CyclTime now) noexcept;
+
+  private:
+    struct Pending {
+        Handler handler;
+        MonoTime deadline;
+        Method method;
+    };
+
+    ~ClntConn();
+    bool on_http_message_begin(CyclTime now) noexcept;
+    bool on_http_url(CyclTime now, std::string_view sv) noexcept
+    {
+        // Only supported for HTTP requests.
+        return false;
+    }
+    bool on_http_status(CyclTime now, std::string_view sv) noexcept;
+    bool on_http_header_field(CyclTime now, std::string_view sv, First first) noexcept;
+    bool on_http_header_value(CyclTime now, std::string_view sv, First first) noexcept;
+    bool on_http_headers_end(CyclTime now) noexcept;
+    bool on_http_body(CyclTime now, std::string_view sv) noexcept;
+    bool on_http_message_end(CyclTime now) noexcept;
+    bool on_http_chunk_header(CyclTime now, std::size_t len) noexcept { return true; }
+    bool on_http_chunk_end(CyclTime now) noexcept { return true; }
+    void on_io_event(CyclTime now, int fd, unsigned events);
+    void on_timer(CyclTime now, Timer& tmr);
+    /// Returns false if the peer has closed the connection.
+    bool drain_input(CyclTime now, int fd);
+    void flush_output(CyclTime now);
+    /// Fail all pending requests with the given error. No further requests are accepted.
+    void fail(CyclTime now, std::error_code ec) noexcept;
+    void schedule_timer(CyclTime now);
+
+    Reactor& reactor_;
+    IoSock sock_;
+    Endpoint ep_;
+    /// Null once the owning Clnt has been destroyed.
+    Clnt* clnt_;
+    const Duration idle_timeout_;
+    Reactor::Handle sub_;
+    Timer tmr_;
+    Buffer in_, out_;
+    std::deque<Pending> pending_;
+    Response resp_;
+    bool closing_{false}, write_blocked_{false};
+};
+
+} // namespace http
+} // namespace toolbox
+
+#endif // TOOLBOX_HTTP_CLNTCONN_HPP
@@ -0,0 +1,180 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Compress.hpp"
+
+#include <toolbox/http/Exception.hpp>
+#include <toolbox/http/Types.hpp>
+
+#include <zlib.h>
+
+#include <algorithm>
+
+namespace toolbox {
+inline namespace http {
+using namespace std;
+namespace {
+
+/// Returns the quality value in thousandths, which avoids floating point.
+int parse_qvalue(string_view params) noexcept
+{
+    // Find the "q" parameter.
+    while (!params.empty()) {
+        const auto pos = params.find(';');
+        const auto param = trim_ows(params.substr(0, pos));
+        if (param.size() >= 2 && to_lower(param[0]) == 'q' && param[1] == '=') {
+            const auto val = param.substr(2);
+            if (val.empty() || val[0] != '1') {
+                // Zero or a fraction.
+                int q{0}, scale{100};
+                for (size_t i{2}; i < val.size() && scale > 0; ++i, scale /= 10) {
+                    if (val[i] < '0' || val[i] > '9') {
+                        break;
+                    }
+                    q += (val[i] - '0') * scale;
+                }
+                return q;
+            }
+            return 1000;
+        }
+        if (pos == string_view::npos) {
+            break;
+        }
+        params.remove_prefix(pos + 1);
+    }
+    return 1000;
+}
+
+/// Deflater retains a zlib stream between responses.
+class Deflater {
+  public:
+    explicit Deflater(int window_bits) noexcept
+    : window_bits_{window_bits}
+    {
+    }
+    ~Deflater()
+    {
+        if (level_ != 0) {
+            deflateEnd(&zs_);
+        }
+    }
+
+    // Copy.
+    Deflater(const Deflater&) = delete;
+    Deflater& operator=(const Deflater&) = delete;
+
+    // Move.
+    Deflater(Deflater&&) = delete;
+    Deflater& operator=(Deflater&&) = delete;
+
+    void compress(int level, string_view in, string& out)
+    {
+        if (level != level_) {
+            if (level_ != 0) {
+                deflateEnd(&zs_);
+                level_ = 0;
+            }
+            zs_ = {};
+            if (deflateInit2(&zs_, level, Z_DEFLATED, window_bits_, 8, Z_DEFAULT_STRATEGY)
+                != Z_OK) {
+                throw Exception{Status::InternalServerError, "deflateInit2 failed"};
+            }
+            level_ = level;
+        } else {
+            deflateReset(&zs_);
+        }
+        const auto pos = out.size();
+        // A single call with Z_FINISH is sufficient when the output is at least deflateBound().
+        out.resize(pos + deflateBound(&zs_, in.size()));
+        zs_.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(in.data()));
+        zs_.avail_in = in.size();
+        zs_.next_out = reinterpret_cast<Bytef*>(out.data() + pos);
+        zs_.avail_out = out.size() - pos;
+        const auto rc = deflate(&zs_, Z_FINISH);
+        out.resize(out.size() - zs_.avail_out);
+        if (rc != Z_STREAM_END) {
+            throw Exception{Status::InternalServerError, "deflate failed"};
+        }
+    }
+
+  private:
+    const int window_bits_;
+    int level_{0};
+    z_stream zs_{};
+};
+
+} // namespace
+
+const char* enum_string(ContentCoding coding) noexcept
+{
+    switch (coding) {
+    case ContentCoding::Identity:
+        return "identity";
+    case ContentCoding::Gzip:
+        return "gzip";
+    case ContentCoding::Deflate:
+        return "deflate";
+    }
+    return "unknown";
+}
+
+ContentCoding accept_coding(string_view accept_encoding) noexcept
+{
+    ContentCoding coding{ContentCoding::Identity};
+    int best{0};
+    while (!accept_encoding.empty()) {
+        const auto pos = accept_encoding.find(',');
+        const auto elem = accept_encoding.substr(0, pos);
+        const auto semi = elem.find(';');
+        const auto name = trim_ows(elem.substr(0, semi));
+        const auto q = semi == string_view::npos ? 1000 : parse_qvalue(elem.substr(semi + 1));
+        if (q > 0) {
+            if ((iequals(name, "gzip") || iequals(name, "x-gzip") || name == "*")
+                && (q > best || (q == best && coding != ContentCoding::Gzip))) {
+                coding = ContentCoding::Gzip;
+                best = q;
+            } else if (iequals(name, "deflate") && q > best) {
+                coding = ContentCoding::Deflate;
+                best = q;
+            }
+        }
+        if (pos == string_view::npos) {
+            break;
+        }
+        accept_encoding.remove_prefix(pos + 1);
+    }
+    return coding;
+}
+
+void compress(ContentCoding coding, int level, string_view in, string& out)
+{
+    // Window bits of 15 plus 16 selects the gzip wrapper, and 15 alone the zlib wrapper, which is
+    // what HTTP calls "deflate".
+    thread_local Deflater gzip{15 + 16}, deflate{15};
+    switch (coding) {
+    case ContentCoding::Identity:
+        out.append(in);
+        break;
+    case ContentCoding::Gzip:
+        gzip.compress(level, in, out);
+        break;
+    case ContentCoding::Deflate:
+        deflate.compress(level, in, out);
+        break;
+    }
+}
+
+} // namespace http
+} // namespace toolbox
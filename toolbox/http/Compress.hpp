@@ -0,0 +1,54 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_HTTP_COMPRESS_HPP
+#define TOOLBOX_HTTP_COMPRESS_HPP
+
+#include <toolbox/Config.h>
+
+#include <string>
+
+namespace toolbox {
+inline namespace http {
+
+/// Content codings that may be applied to a response body.
+enum class ContentCoding : int { Identity, Gzip, Deflate };
+
+/// Number of content codings.
+constexpr std::size_t ContentCodingCount{3};
+
+TOOLBOX_API const char* enum_string(ContentCoding coding) noexcept;
+
+struct CompressOptions {
+    /// Bodies smaller than this are sent uncompressed, because the saving does not justify the CPU
+    /// time.
+    std::size_t threshold{1024};
+    /// The zlib compression level from 1 to 9, or zero to disable compression.
+    int level{0};
+};
+
+/// Returns the preferred coding from an Accept-Encoding header value. Gzip is preferred to
+/// Deflate when the client accepts both with the same quality value.
+TOOLBOX_API ContentCoding accept_coding(std::string_view accept_encoding) noexcept;
+
+/// Compress the input and append the result to the output string. The compressor state is
+/// retained per thread, so that it is not reallocated for each response.
+/// \throws Exception if compression fails.
+TOOLBOX_API void compress(ContentCoding coding, int level, std::string_view in, std::string& out);
+
+} // namespace http
+} // namespace toolbox
+
+#endif // TOOLBOX_HTTP_COMPRESS_HPP
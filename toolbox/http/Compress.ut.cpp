@@ -0,0 +1,84 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Compress.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <zlib.h>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+string decompress(ContentCoding coding, string_view in)
+{
+    z_stream zs{};
+    // Window bits of 15 plus 16 expects the gzip wrapper.
+    inflateInit2(&zs, coding == ContentCoding::Gzip ? 15 + 16 : 15);
+    string out(64 * 1024, '\0');
+    zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(in.data()));
+    zs.avail_in = in.size();
+    zs.next_out = reinterpret_cast<Bytef*>(out.data());
+    zs.avail_out = out.size();
+    const auto rc = inflate(&zs, Z_FINISH);
+    out.resize(out.size() - zs.avail_out);
+    inflateEnd(&zs);
+    return rc == Z_STREAM_END ? out : "error";
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(CompressSuite)
+
+BOOST_AUTO_TEST_CASE(AcceptCodingCase)
+{
+    BOOST_TEST((accept_coding("") == ContentCoding::Identity));
+    BOOST_TEST((accept_coding("identity") == ContentCoding::Identity));
+    BOOST_TEST((accept_coding("gzip") == ContentCoding::Gzip));
+    BOOST_TEST((accept_coding("deflate") == ContentCoding::Deflate));
+    BOOST_TEST((accept_coding("gzip, deflate, br") == ContentCoding::Gzip));
+    BOOST_TEST((accept_coding("deflate, GZIP") == ContentCoding::Gzip));
+    BOOST_TEST((accept_coding("*") == ContentCoding::Gzip));
+    // Quality values.
+    BOOST_TEST((accept_coding("gzip;q=0.5, deflate") == ContentCoding::Deflate));
+    BOOST_TEST((accept_coding("gzip; q=0, deflate;q=0.1") == ContentCoding::Deflate));
+    BOOST_TEST((accept_coding("gzip;q=0") == ContentCoding::Identity));
+    BOOST_TEST((accept_coding("br;q=1.0, gzip;q=0.8") == ContentCoding::Gzip));
+}
+
+BOOST_AUTO_TEST_CASE(CompressCase)
+{
+    string in;
+    for (int i{0}; i < 1000; ++i) {
+        in += "{\"id\":" + to_string(i) + ",\"px\":100.25},";
+    }
+    for (const auto coding : {ContentCoding::Gzip, ContentCoding::Deflate}) {
+        // The compressor is reused, and may change level.
+        for (const auto level : {1, 6, 6, 9}) {
+            string out{"prefix"};
+            compress(coding, level, in, out);
+            BOOST_TEST(out.substr(0, 6) == "prefix");
+            BOOST_TEST(out.size() < in.size() / 4);
+            BOOST_TEST(decompress(coding, string_view{out}.substr(6)) == in);
+        }
+    }
+    string out;
+    compress(ContentCoding::Identity, 6, "abc", out);
+    BOOST_TEST(out == "abc");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -17,49 +17,68 @@
 #ifndef TOOLBOX_HTTP_CONN_HPP
 #define TOOLBOX_HTTP_CONN_HPP
 
+#include <toolbox/http/Admission.hpp>
 #include <toolbox/http/Parser.hpp>
 #include <toolbox/http/Request.hpp>
+#include <toolbox/http/RequestParser.hpp>
+#include <toolbox/http/ResponseCache.hpp>
 #include <toolbox/http/Stream.hpp>
+#include <toolbox/http/WsApp.hpp>
 #include <toolbox/io/Disposer.hpp>
+#include <toolbox/io/Hook.hpp>
 #include <toolbox/io/Reactor.hpp>
 #include <toolbox/net/Endpoint.hpp>
 #include <toolbox/net/IoSock.hpp>
 
+#include <cstring>
+
 namespace toolbox {
 inline namespace http {
 class App;
 
-template <typename RequestT, typename AppT>
+/// The ParserT template parameter selects the HTTP parser, which may be either BasicParser or
+/// BasicRequestParser.
+template <typename RequestT, typename AppT, template <typename> class ParserT = BasicParser>
 class BasicConn
 : public Allocator
-, public BasicDisposer<BasicConn<RequestT, AppT>>
-, BasicParser<BasicConn<RequestT, AppT>> {
+, public BasicDisposer<BasicConn<RequestT, AppT, ParserT>>
+, ParserT<BasicConn<RequestT, AppT, ParserT>> {
 
-    friend class BasicDisposer<BasicConn<RequestT, AppT>>;
-    friend class BasicParser<BasicConn<RequestT, AppT>>;
+    friend class BasicDisposer<BasicConn<RequestT, AppT, ParserT>>;
+    friend class ParserT<BasicConn<RequestT, AppT, ParserT>>;
 
+    using Parser = ParserT<BasicConn<RequestT, AppT, ParserT>>;
     using Request = RequestT;
     using App = AppT;
     // Automatically unlink when object is destroyed.
     using AutoUnlinkOption = boost::intrusive::link_mode<boost::intrusive::auto_unlink>;
 
     static constexpr auto IdleTimeout = 5s;
+    /// Input is not parsed while the output buffer is at or above the high-water mark, and is
+    /// resumed once the output buffer has drained below the low-water mark.
+    static constexpr std::size_t OutHighWater{256 * 1024};
+    static constexpr std::size_t OutLowWater{OutHighWater / 4};
 
-    using BasicParser<BasicConn<RequestT, AppT>>::method;
-    using BasicParser<BasicConn<RequestT, AppT>>::parse;
-    using BasicParser<BasicConn<RequestT, AppT>>::should_keep_alive;
+    using Parser::http_major;
+    using Parser::http_minor;
+    using Parser::is_upgrade;
+    using Parser::method;
+    using Parser::parse;
+    using Parser::should_keep_alive;
 
   public:
     using Protocol = StreamProtocol;
     using Endpoint = StreamEndpoint;
 
     BasicConn(CyclTime now, Reactor& r, IoSock&& sock, const Endpoint& ep, App& app)
-    : BasicParser<BasicConn<RequestT, AppT>>{Type::Request}
+    : Parser{Type::Request}
     , reactor_{r}
     , sock_{std::move(sock)}
     , ep_{ep}
     , app_{app}
+    , resume_hook_{bind<&BasicConn::on_resume_hook>(this)}
     {
+        os_.set_resume(bind<&BasicConn::on_resume>(this));
         sub_ = r.subscribe(*sock_, EpollIn, bind<&BasicConn::on_io_event>(this));
         schedule_timeout(now);
         app.on_http_connect(now, ep_);
@@ -81,6 +100,10 @@ class BasicConn
     void dispose_now(CyclTime now) noexcept
     {
         app_.on_http_disconnect(now, ep_); // noexcept
+        // The admitted connection slot is released by the WebSocket connection once upgraded.
+        if (auto* const admission = app_.admission(); admission && !upgraded_) {
+            admission->on_disconnect(ep_); // noexcept
+        }
         // Best effort to drain any data still pending in the write buffer before the socket is
         // closed.
         if (!out_.empty()) {
@@ -95,6 +118,8 @@ class BasicConn
     bool on_http_message_begin(CyclTime now) noexcept
     {
         in_progress_ = true;
+        streaming_ = false;
+        rejected_ = false;
         req_.clear();
         return true;
     }
@@ -102,7 +127,7 @@ class BasicConn
     {
         bool ret{false};
         try {
-            req_.append_url(sv);
+            req_.append_url(base_, sv);
             ret = true;
         } catch (const std::exception& e) {
             app_.on_http_error(now, ep_, e, os_);
@@ -119,7 +144,7 @@ class BasicConn
     {
         bool ret{false};
         try {
-            req_.append_header_field(sv, first);
+            req_.append_header_field(base_, sv, first);
             ret = true;
         } catch (const std::exception& e) {
             app_.on_http_error(now, ep_, e, os_);
@@ -131,7 +156,7 @@ class BasicConn
     {
         bool ret{false};
         try {
-            req_.append_header_value(sv, first);
+            req_.append_header_value(base_, sv, first);
             ret = true;
         } catch (const std::exception& e) {
             app_.on_http_error(now, ep_, e, os_);
@@ -140,15 +165,25 @@ class BasicConn
         return ret;
     }
     bool on_http_headers_end(CyclTime now) noexcept
-    {
-        req_.set_method(method());
-        return true;
-    }
-    bool on_http_body(CyclTime now, std::string_view sv) noexcept
     {
         bool ret{false};
         try {
-            req_.append_body(sv);
+            req_.set_method(method());
+            req_.flush_head(base_);
+            // Admission is checked before the application can choose to stream the body, so that
+            // streamed uploads are also subject to the rate limit.
+            if (!admit(now)) {
+                rejected_ = true;
+                // The body of a rejected request is discarded as it is parsed.
+                req_.detach(base_);
+            } else {
+                streaming_ = app_.on_http_headers(now, ep_, req_);
+                if (streaming_) {
+                    // The input is released as the body is delivered, so the head can no longer
+                    // reference it.
+                    req_.detach(base_);
+                }
+            }
             ret = true;
         } catch (const std::exception& e) {
             app_.on_http_error(now, ep_, e, os_);
@@ -156,13 +191,23 @@ class BasicConn
         }
         return ret;
     }
-    bool on_http_message_end(CyclTime now) noexcept
+    bool on_http_body(CyclTime now, std::string_view sv) noexcept
     {
         bool ret{false};
         try {
-            in_progress_ = false;
-            req_.flush(); // May throw.
-            app_.on_http_message(now, ep_, req_, os_);
+            if (rejected_) {
+                // Discard.
+            } else if (streaming_) {
+                // Once the application is behind, the rest of the input that has already been read
+                // is retained until the application has caught up.
+                const auto n
+                    = pending_body_.empty() ? app_.on_http_body_chunk(now, ep_, req_, sv, os_) : 0;
+                if (n < sv.size()) {
+                    pending_body_.append(sv.data() + n, sv.size() - n);
+                }
+            } else {
+                req_.append_body(base_, sv);
+            }
             ret = true;
         } catch (const std::exception& e) {
             app_.on_http_error(now, ep_, e, os_);
@@ -170,19 +215,78 @@ class BasicConn
         }
         return ret;
     }
+    bool on_http_message_end(CyclTime now) noexcept
+    {
+        in_progress_ = false;
+        // The request references the input buffer, so pause the parser and dispatch the message
+        // after the parser has returned.
+        msg_end_ = true;
+        this->pause();
+        return true;
+    }
     bool on_http_chunk_header(CyclTime now, std::size_t len) noexcept { return true; }
     bool on_http_chunk_end(CyclTime now) noexcept { return true; }
     void on_timeout_timer(CyclTime now, Timer& tmr)
     {
+        if (os_.producing()) {
+            // Long-lived responses, such as event streams, are not subject to the idle timeout.
+            schedule_timeout(now);
+            return;
+        }
         auto lock = this->lock_this(now);
         app_.on_http_timeout(now, ep_);
         this->dispose(now);
     }
+    void on_resume(CyclTime now)
+    {
+        // Defer to the end of the reactor cycle, because the application may call resume() from
+        // within one of its own callbacks.
+        if (!resume_hook_.is_linked()) {
+            reactor_.add_hook(resume_hook_);
+        }
+    }
+    void on_resume_hook(CyclTime now)
+    {
+        resume_hook_.unlink();
+        auto lock = this->lock_this(now);
+        try {
+            if (!pending_body_.empty()) {
+                if (!flush_body(now)) {
+                    // Still behind, so wait for the next resume().
+                    return;
+                }
+                // Reset timer.
+                schedule_timeout(now);
+                // Resume with the message or input that was held back.
+                if ((msg_end_ || parsed_ < in_.size()) && !flush_input(now)) {
+                    return;
+                }
+            }
+            if ((out_.empty() && !os_.producing()) || write_blocked_) {
+                update_events();
+                return;
+            }
+            flush_output(now);
+        } catch (const Exception&) {
+            // Do not call on_http_error() here, because it will have already been called in one of
+            // the noexcept parser callback functions.
+        } catch (const std::exception& e) {
+            app_.on_http_error(now, ep_, e, os_);
+            this->dispose(now);
+        }
+    }
     void on_io_event(CyclTime now, int fd, unsigned events)
     {
         auto lock = this->lock_this(now);
         try {
-            if (events & (EpollIn | EpollHup)) {
+            if ((events & (EpollHup | EpollRdHup)) && input_blocked()) {
+                // The peer has hung up, or has closed its side of the connection while a response
+                // is being produced, so there is no point holding back input.
+                this->dispose(now);
+                return;
+            }
+            // Input is not read while output is backpressured or the application is behind.
+            if ((events & (EpollIn | EpollHup)) && !input_blocked()) {
                 if (!drain_input(now, fd)) {
                     this->dispose(now);
                     return;
@@ -190,7 +294,9 @@ class BasicConn
             }
             // Do not attempt to flush the output buffer if it is empty or if we are still waiting
             // for the socket to become writable.
-            if (out_.empty() || (write_blocked_ && !(events & EpollOut))) {
+            if ((out_.empty() && !os_.producing()) || (write_blocked_ && !(events & EpollOut))) {
+                // Stop polling for input if it is being held back.
+                update_events();
                 return;
             }
             flush_output(now);
@@ -230,30 +336,207 @@ class BasicConn
                 break;
             }
         }
-        flush_input(now);
+        // Avoid signalling EOF to the parser if there is no new input.
+        if (parsed_ < in_.size() && !flush_input(now)) {
+            return false;
+        }
         // Reset timer.
         schedule_timeout(now);
         return true;
     }
-    void flush_input(CyclTime now) { in_.consume(parse(now, in_.data())); }
+    /// Parse and dispatch each complete request in the input buffer. The responses accumulate in
+    /// the output buffer, which is then flushed once for the whole batch. Returns false if the
+    /// connection was disposed while dispatching a message.
+    bool flush_input(CyclTime now)
+    {
+        // N.B. an empty buffer signals EOF to the parser.
+        do {
+            if (os_.close_delimited()) {
+                // The connection is closed once the response has been written, so any further
+                // requests are ignored.
+                break;
+            }
+            if (out_.size() >= OutHighWater || os_.producing()) {
+                // Stop reading and parsing until the peer has consumed some of the output, and
+                // until the current response is complete.
+                read_blocked_ = true;
+                break;
+            }
+            if (!pending_body_.empty()) {
+                // Wait for the application to consume the pending body.
+                break;
+            }
+            // The message end may have been held back until the pending body was consumed.
+            if (!msg_end_) {
+                base_ = in_.str().data();
+                parsed_ += parse(now, advance(in_.data(), parsed_));
+                if (streaming_ || rejected_) {
+                    // The streamed body has either been delivered, copied or discarded.
+                    in_.consume(parsed_);
+                    parsed_ = 0;
+                }
+                if (!msg_end_ || !pending_body_.empty()) {
+                    // Retain the input referenced by the partial message until it is complete.
+                    break;
+                }
+            }
+            msg_end_ = false;
+            if (!dispatch_message(now)) {
+                return false;
+            }
+            // Release the input once the application has finished with the request.
+            in_.consume(parsed_);
+            parsed_ = 0;
+        } while (parsed_ < in_.size());
+        return true;
+    }
+    bool dispatch_message(CyclTime now) noexcept
+    {
+        bool ret{false};
+        try {
+            req_.flush(base_);
+            // Negotiate the content coding for the response.
+            os_.set_compression(app_.compression());
+            os_.set_coding(accept_coding(req_.header(Header::AcceptEncoding)));
+            // Chunked transfer encoding was introduced in HTTP/1.1.
+            os_.set_chunking(http_major() > 1 || (http_major() == 1 && http_minor() >= 1));
+            if (rejected_) {
+                // The 429 response was written when the headers were parsed.
+                rejected_ = false;
+            } else if (streaming_) {
+                streaming_ = false;
+                app_.on_http_message_end(now, ep_, req_, os_);
+            } else if (is_upgrade() && upgrade(now)) {
+                // The socket now belongs to the WebSocket connection.
+                return false;
+            } else if (!write_cached(now)) {
+                app_.on_http_message(now, ep_, req_, os_);
+            }
+            ret = true;
+        } catch (const std::exception& e) {
+            app_.on_http_error(now, ep_, e, os_);
+            this->dispose(now);
+        }
+        return ret;
+    }
+    /// Returns true if the connection was handed over to the application's WebSocket connection
+    /// type, in which case this connection has been disposed.
+    bool upgrade(CyclTime now)
+    {
+        auto* const ws_app = app_.ws_app();
+        if (!ws_app || !is_ws_upgrade(req_) || !ws_app->on_ws_upgrade(now, ep_, req_)) {
+            return false;
+        }
+        // Responses to pipelined requests that have yet to be written precede the handshake.
+        std::string out{out_.str()};
+        out += "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\n"
+               "Connection: Upgrade\r\nSec-WebSocket-Accept: ";
+        out += ws_accept_key(req_.header(Header::SecWebSocketKey));
+        out += "\r\n\r\n";
+        // Any input that followed the handshake is the start of the WebSocket stream.
+        const auto in = in_.str().substr(parsed_);
+        // Unsubscribe before the socket is handed over.
+        sub_.reset();
+        tmr_.reset();
+        resume_hook_.unlink();
+        new WsConn{now, reactor_, std::move(sock_), ep_, *ws_app, in, out, app_.admission()};
+        upgraded_ = true;
+        out_.clear();
+        this->dispose(now);
+        return true;
+    }
+    /// Returns true if the request is admitted by the application's admission control. Otherwise,
+    /// the pre-serialised 429 response is written.
+    bool admit(CyclTime now)
+    {
+        auto* const admission = app_.admission();
+        if (!admission || admission->on_request(now.mono_time(), req_.path())) {
+            return true;
+        }
+        const auto buf = out_.prepare(TooManyRequestsResponse.size());
+        std::memcpy(buffer_cast<char*>(buf), TooManyRequestsResponse.data(),
+                    TooManyRequestsResponse.size());
+        out_.commit(TooManyRequestsResponse.size());
+        return false;
+    }
+    /// Returns true if the request was answered from the application's response cache.
+    bool write_cached(CyclTime now)
+    {
+        auto* const cache = app_.response_cache();
+        return cache && !cache->empty()
+            && cache->write(now, req_.method(), req_.path(), out_, os_.coding());
+    }
     void flush_output(CyclTime now)
     {
-        // Attempt to flush buffered data.
-        out_.consume(sock_.write(out_.data()));
-        if (out_.empty()) {
-            if (!in_progress_ && !should_keep_alive()) {
-                this->dispose(now);
+        for (;;) {
+            if (!out_.empty()) {
+                // Attempt to flush buffered data.
+                std::error_code ec;
+                const auto size = sock_.write(out_.data(), ec);
+                if (ec) {
+                    if (ec != std::errc::operation_would_block) {
+                        throw std::system_error{ec, "write"};
+                    }
+                } else {
+                    out_.consume(size);
+                }
+            }
+            if (out_.size() >= OutLowWater) {
+                break;
+            }
+            if (os_.producing()) {
+                // Let the producer refill the output buffer now that there is space.
+                const auto size = out_.size();
+                os_.produce(now);
+                if (out_.size() != size) {
+                    continue;
+                }
+                if (os_.producing()) {
+                    // The producer is idle until the application calls resume().
+                    break;
+                }
+            }
+            if (!read_blocked_) {
+                break;
+            }
+            // Resume parsing any pipelined requests that were held back.
+            read_blocked_ = false;
+            if (!flush_input(now)) {
                 return;
             }
-            if (write_blocked_) {
-                // Restore read-only state after the buffer has been drained.
-                sub_.set_events(EpollIn);
-                write_blocked_ = false;
+            if (out_.empty() && !os_.producing()) {
+                break;
             }
-        } else if (!write_blocked_) {
-            // Set the state to read-write if the entire buffer could not be written.
-            sub_.set_events(EpollIn | EpollOut);
-            write_blocked_ = true;
+        }
+        if (out_.empty() && !in_progress_ && !os_.producing()
+            && (!should_keep_alive() || os_.close_delimited())) {
+            this->dispose(now);
+            return;
+        }
+        // Wait for the socket to become writable if the entire buffer could not be written.
+        write_blocked_ = !out_.empty();
+        update_events();
+    }
+    /// Returns false if the application is still behind.
+    bool flush_body(CyclTime now)
+    {
+        const auto n = app_.on_http_body_chunk(now, ep_, req_, pending_body_, os_);
+        pending_body_.erase(0, n);
+        return pending_body_.empty();
+    }
+    bool input_blocked() const noexcept
+    {
+        return read_blocked_ || !pending_body_.empty() || os_.producing() || os_.close_delimited();
+    }
+    void update_events()
+    {
+        // A peer that closes the connection while the producer is idle is still detected, so that
+        // long-lived responses are not kept open for a client that has gone away.
+        const unsigned in{input_blocked() ? (os_.producing() ? EpollRdHup : 0U) : EpollIn};
+        const unsigned events{in | (write_blocked_ ? EpollOut : 0U)};
+        if (events != events_) {
+            sub_.set_events(events);
+            events_ = events;
         }
     }
     void schedule_timeout(CyclTime now)
@@ -268,10 +551,26 @@ class BasicConn
     App& app_;
     Reactor::Handle sub_;
     Timer tmr_;
+    /// Linked at the end of the reactor cycle in which the application called resume().
+    Hook resume_hook_;
     Buffer in_, out_;
+    /// Start of the input buffer passed to the parser.
+    const char* base_{nullptr};
+    /// Number of bytes at the front of the input buffer that have already been parsed.
+    std::size_t parsed_{0};
     Request req_;
+    /// Streamed body data that the application has yet to consume.
+    std::string pending_body_;
     OStream os_{out_};
-    bool in_progress_{false}, write_blocked_{false};
+    /// Events currently subscribed to.
+    unsigned events_{EpollIn};
+    bool in_progress_{false}, msg_end_{false}, read_blocked_{false}, write_blocked_{false};
+    /// True if the body of the current message is being streamed to the application.
+    bool streaming_{false};
+    /// True if the current message was rejected by admission control.
+    bool rejected_{false};
+    /// True once the socket has been handed over to a WebSocket connection.
+    bool upgraded_{false};
 };
 
 using Conn = BasicConn<Request, App>;
@@ -0,0 +1,243 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Metrics.hpp"
+
+#include <toolbox/hdr/Histogram.hpp>
+#include <toolbox/hdr/Recorder.hpp>
+#include <toolbox/hdr/Utility.hpp>
+#include <toolbox/http/Request.hpp>
+#include <toolbox/http/Stream.hpp>
+#include <toolbox/sys/Log.hpp>
+
+#include <cctype>
+#include <charconv>
+#include <stdexcept>
+
+namespace toolbox {
+inline namespace http {
+using namespace std;
+namespace {
+
+/// Quantiles exported for each histogram.
+constexpr double Quantiles[]{0.5, 0.9, 0.99, 0.999, 1.0};
+
+bool is_valid_name(string_view name) noexcept
+{
+    if (name.empty() || isdigit(static_cast<unsigned char>(name[0]))) {
+        return false;
+    }
+    for (const char c : name) {
+        if (!isalnum(static_cast<unsigned char>(c)) && c != '_' && c != ':') {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Write the value in the shortest form that round-trips, without touching the stream state.
+void put_value(ostream& os, double val)
+{
+    char buf[32];
+    const auto [end, ec] = to_chars(buf, buf + sizeof(buf), val);
+    os.write(buf, end - buf);
+}
+
+void put_value(ostream& os, int64_t val)
+{
+    char buf[20];
+    const auto [end, ec] = to_chars(buf, buf + sizeof(buf), val);
+    os.write(buf, end - buf);
+}
+
+/// Help text escapes backslash and newline.
+void put_help(ostream& os, string_view name, string_view help)
+{
+    os << "# HELP " << name << ' ';
+    for (const char c : help) {
+        if (c == '\\') {
+            os << "\\\\";
+        } else if (c == '\n') {
+            os << "\\n";
+        } else {
+            os << c;
+        }
+    }
+    os << '\n';
+}
+
+} // namespace
+
+struct MetricRegistry::Summary {
+    explicit Summary(Recorder& r)
+    : recorder{r}
+    , interval{r.config()}
+    , total{r.config()}
+    {
+    }
+    Recorder& recorder;
+    /// Values recorded since the previous snapshot.
+    Histogram interval;
+    /// Values recorded since registration.
+    Histogram total;
+};
+
+MetricRegistry::MetricRegistry() = default;
+
+MetricRegistry::~MetricRegistry() = default;
+
+Counter& MetricRegistry::counter(string_view name, string_view help)
+{
+    auto& counter = counters_.emplace_back();
+    try {
+        insert(name, help, Type::Counter, &counter);
+    } catch (...) {
+        counters_.pop_back();
+        throw;
+    }
+    return counter;
+}
+
+Gauge& MetricRegistry::gauge(string_view name, string_view help)
+{
+    auto& gauge = gauges_.emplace_back();
+    try {
+        insert(name, help, Type::Gauge, &gauge);
+    } catch (...) {
+        gauges_.pop_back();
+        throw;
+    }
+    return gauge;
+}
+
+void MetricRegistry::histogram(string_view name, string_view help, Recorder& r, double scale)
+{
+    auto& summary = summaries_.emplace_back(make_unique<Summary>(r));
+    try {
+        insert(name, help, Type::Summary, summary.get(), scale);
+    } catch (...) {
+        summaries_.pop_back();
+        throw;
+    }
+}
+
+void MetricRegistry::write(ostream& os)
+{
+    for (const auto& m : metrics_) {
+        put_help(os, m.name, m.help);
+        switch (m.type) {
+        case Type::Counter:
+            os << "# TYPE " << m.name << " counter\n" << m.name << ' ';
+            put_value(os, static_cast<const Counter*>(m.ptr)->value());
+            os << '\n';
+            break;
+        case Type::Gauge:
+            os << "# TYPE " << m.name << " gauge\n" << m.name << ' ';
+            put_value(os, static_cast<const Gauge*>(m.ptr)->value());
+            os << '\n';
+            break;
+        case Type::Summary: {
+            // Take the values recorded since the previous snapshot without stopping the writers.
+            auto& summary = *static_cast<Summary*>(m.ptr);
+            summary.recorder.interval_histogram(summary.interval);
+            summary.total.add(summary.interval);
+            const auto& h = summary.total;
+            os << "# TYPE " << m.name << " summary\n";
+            for (const auto q : Quantiles) {
+                os << m.name << "{quantile=\"";
+                put_value(os, q);
+                os << "\"} ";
+                put_value(os, value_at_percentile(h, q * 100.0) / m.scale);
+                os << '\n';
+            }
+            // The histogram does not retain the exact sum, so it is derived from the mean.
+            os << m.name << "_sum ";
+            put_value(os, mean(h) * h.total_count() / m.scale);
+            os << '\n' << m.name << "_count ";
+            put_value(os, h.total_count());
+            os << '\n';
+        } break;
+        }
+    }
+}
+
+void MetricRegistry::insert(string_view name, string_view help, Type type, void* ptr,
+                            double scale)
+{
+    if (!is_valid_name(name)) {
+        throw invalid_argument{"invalid metric name: "s + string{name}};
+    }
+    for (const auto& m : metrics_) {
+        if (m.name == name) {
+            throw invalid_argument{"duplicate metric name: "s + string{name}};
+        }
+    }
+    metrics_.push_back({string{name}, string{help}, type, ptr, scale});
+}
+
+MetricsApp::MetricsApp(MetricRegistry& registry, string path)
+: registry_{registry}
+, path_{std::move(path)}
+{
+}
+
+MetricsApp::~MetricsApp() = default;
+
+void MetricsApp::mount(Router& router, string_view prefix)
+{
+    string pattern{prefix};
+    pattern += path_;
+    router.add(Method::Get, pattern, bind<&MetricsApp::on_metrics>(this));
+}
+
+void MetricsApp::on_metrics(CyclTime now, const Request& req, const RouteParams& params,
+                            OStream& os)
+{
+    os.reset(Status::Ok, PrometheusText);
+    registry_.write(os);
+    os.commit();
+}
+
+void MetricsApp::do_on_http_connect(CyclTime now, const Endpoint& ep) {}
+
+void MetricsApp::do_on_http_disconnect(CyclTime now, const Endpoint& ep) noexcept {}
+
+void MetricsApp::do_on_http_error(CyclTime now, const Endpoint& ep, const std::exception& e,
+                                  OStream& os) noexcept
+{
+    TOOLBOX_ERROR << "metrics session error: " << ep << ": " << e.what();
+}
+
+void MetricsApp::do_on_http_message(CyclTime now, const Endpoint& ep, const Request& req,
+                                    OStream& os)
+{
+    if (req.path() != path_) {
+        os.reset(Status::NotFound, TextPlain);
+        os << "Error " << Status::NotFound << " - " << enum_string(Status::NotFound);
+        os.commit();
+    } else if (req.method() != Method::Get) {
+        os.reset(Status::MethodNotAllowed, TextPlain);
+        os << "Error " << Status::MethodNotAllowed << " - "
+           << enum_string(Status::MethodNotAllowed);
+        os.commit();
+    } else {
+        on_metrics(now, req, {}, os);
+    }
+}
+
+void MetricsApp::do_on_http_timeout(CyclTime now, const Endpoint& ep) noexcept {}
+
+} // namespace http
+} // namespace toolbox
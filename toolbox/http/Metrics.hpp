@@ -0,0 +1,180 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_HTTP_METRICS_HPP
+#define TOOLBOX_HTTP_METRICS_HPP
+
+#include <toolbox/http/App.hpp>
+#include <toolbox/http/Router.hpp>
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace toolbox {
+inline namespace hdr {
+class Recorder;
+} // namespace hdr
+inline namespace http {
+
+/// Content type of the Prometheus text exposition format.
+constexpr char PrometheusText[]{"text/plain; version=0.0.4"};
+
+/// Counter is a monotonically increasing value that may be incremented from any thread without
+/// blocking.
+class TOOLBOX_API Counter {
+  public:
+    Counter() noexcept = default;
+
+    // Copy.
+    Counter(const Counter&) = delete;
+    Counter& operator=(const Counter&) = delete;
+
+    // Move.
+    Counter(Counter&&) = delete;
+    Counter& operator=(Counter&&) = delete;
+
+    std::int64_t value() const noexcept { return value_.load(std::memory_order_relaxed); }
+    void inc(std::int64_t n = 1) noexcept { value_.fetch_add(n, std::memory_order_relaxed); }
+
+  private:
+    std::atomic<std::int64_t> value_{0};
+};
+
+/// Gauge is a value that may go up and down, and may be set from any thread without blocking.
+class TOOLBOX_API Gauge {
+  public:
+    Gauge() noexcept = default;
+
+    // Copy.
+    Gauge(const Gauge&) = delete;
+    Gauge& operator=(const Gauge&) = delete;
+
+    // Move.
+    Gauge(Gauge&&) = delete;
+    Gauge& operator=(Gauge&&) = delete;
+
+    double value() const noexcept { return value_.load(std::memory_order_relaxed); }
+    void set(double value) noexcept { value_.store(value, std::memory_order_relaxed); }
+    void add(double n) noexcept
+    {
+        auto prev = value_.load(std::memory_order_relaxed);
+        while (!value_.compare_exchange_weak(prev, prev + n, std::memory_order_relaxed)) {
+        }
+    }
+
+  private:
+    std::atomic<double> value_{0.0};
+};
+
+/// MetricRegistry holds named metrics and writes them in the Prometheus text exposition format.
+///
+/// Metrics are registered up-front. Counters and gauges are owned by the registry, and may be
+/// updated from any thread, because a snapshot is a relaxed load of each value. Histograms are
+/// recorded into a Recorder owned by the caller, which may also be written from any thread. Each
+/// snapshot accumulates the recorder's interval histogram, so that the exported summary covers all
+/// values recorded since registration. Snapshots must not be written concurrently.
+class TOOLBOX_API MetricRegistry {
+  public:
+    MetricRegistry();
+    ~MetricRegistry();
+
+    // Copy.
+    MetricRegistry(const MetricRegistry&) = delete;
+    MetricRegistry& operator=(const MetricRegistry&) = delete;
+
+    // Move.
+    MetricRegistry(MetricRegistry&&) = delete;
+    MetricRegistry& operator=(MetricRegistry&&) = delete;
+
+    /// Returns the number of registered metrics.
+    std::size_t size() const noexcept { return metrics_.size(); }
+
+    /// Register a counter. The reference is valid for the lifetime of the registry.
+    /// \throws std::invalid_argument if the name is invalid or already registered.
+    Counter& counter(std::string_view name, std::string_view help);
+    /// Register a gauge. The reference is valid for the lifetime of the registry.
+    /// \throws std::invalid_argument if the name is invalid or already registered.
+    Gauge& gauge(std::string_view name, std::string_view help);
+    /// Register a histogram, which is exported as a summary with percentile quantiles. Values are
+    /// divided by the scale, so that, for example, nanosecond latencies can be exported in seconds.
+    /// The recorder must outlive the registry.
+    /// \throws std::invalid_argument if the name is invalid or already registered.
+    void histogram(std::string_view name, std::string_view help, Recorder& r, double scale = 1.0);
+
+    /// Write a snapshot of all metrics in registration order.
+    void write(std::ostream& os);
+
+  private:
+    enum class Type { Counter, Gauge, Summary };
+    struct Summary;
+    struct Metric {
+        std::string name;
+        std::string help;
+        Type type;
+        void* ptr;
+        double scale;
+    };
+    void insert(std::string_view name, std::string_view help, Type type, void* ptr,
+                double scale = 1.0);
+
+    std::deque<Counter> counters_;
+    std::deque<Gauge> gauges_;
+    std::vector<std::unique_ptr<Summary>> summaries_;
+    std::vector<Metric> metrics_;
+};
+
+/// MetricsApp serves a MetricRegistry over HTTP. It may be used as the App of a dedicated Serv, or
+/// mounted on the Router of an existing App under a path prefix.
+class TOOLBOX_API MetricsApp : public App {
+  public:
+    explicit MetricsApp(MetricRegistry& registry, std::string path = "/metrics");
+    ~MetricsApp() override;
+
+    // Copy.
+    MetricsApp(const MetricsApp&) = delete;
+    MetricsApp& operator=(const MetricsApp&) = delete;
+
+    // Move.
+    MetricsApp(MetricsApp&&) = delete;
+    MetricsApp& operator=(MetricsApp&&) = delete;
+
+    const std::string& path() const noexcept { return path_; }
+
+    /// Add a route for the metrics path under the prefix, for example "/admin".
+    void mount(Router& router, std::string_view prefix = {});
+    /// Router handler that writes the metrics.
+    void on_metrics(CyclTime now, const Request& req, const RouteParams& params, OStream& os);
+
+  protected:
+    void do_on_http_connect(CyclTime now, const Endpoint& ep) override;
+    void do_on_http_disconnect(CyclTime now, const Endpoint& ep) noexcept override;
+    void do_on_http_error(CyclTime now, const Endpoint& ep, const std::exception& e,
+                          OStream& os) noexcept override;
+    void do_on_http_message(CyclTime now, const Endpoint& ep, const Request& req,
+                            OStream& os) override;
+    void do_on_http_timeout(CyclTime now, const Endpoint& ep) noexcept override;
+
+  private:
+    MetricRegistry& registry_;
+    const std::string path_;
+};
+
+} // namespace http
+} // namespace toolbox
+
+#endif // TOOLBOX_HTTP_METRICS_HPP
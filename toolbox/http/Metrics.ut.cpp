@@ -0,0 +1,108 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Metrics.hpp"
+
+#include <toolbox/hdr/Recorder.hpp>
+#include <toolbox/http/Request.hpp>
+#include <toolbox/http/Stream.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+
+using namespace std;
+using namespace toolbox;
+
+BOOST_AUTO_TEST_SUITE(MetricsSuite)
+
+BOOST_AUTO_TEST_CASE(MetricRegistryCase)
+{
+    MetricRegistry reg;
+    auto& requests = reg.counter("http_requests_total", "Total requests.");
+    auto& conns = reg.gauge("http_connections", "Open connections.");
+    Recorder r{1, 1'000'000'000, 3};
+    auto& shard = r.shard();
+    reg.histogram("http_latency_seconds", "Request latency.\nIn seconds.", r, 1e9);
+    BOOST_TEST(reg.size() == 3U);
+
+    requests.inc();
+    requests.inc(2);
+    conns.set(5);
+    conns.add(-1.5);
+    for (int i{1}; i <= 100; ++i) {
+        shard.record_value(i * 1'000'000);
+    }
+
+    stringstream ss;
+    reg.write(ss);
+    BOOST_TEST(ss.str()
+               == "# HELP http_requests_total Total requests.\n"
+                  "# TYPE http_requests_total counter\n"
+                  "http_requests_total 3\n"
+                  "# HELP http_connections Open connections.\n"
+                  "# TYPE http_connections gauge\n"
+                  "http_connections 3.5\n"
+                  "# HELP http_latency_seconds Request latency.\\nIn seconds.\n"
+                  "# TYPE http_latency_seconds summary\n"
+                  "http_latency_seconds{quantile=\"0.5\"} 0.050003967\n"
+                  "http_latency_seconds{quantile=\"0.9\"} 0.090046463\n"
+                  "http_latency_seconds{quantile=\"0.99\"} 0.099024895\n"
+                  "http_latency_seconds{quantile=\"0.999\"} 0.100007935\n"
+                  "http_latency_seconds{quantile=\"1\"} 0.100007935\n"
+                  "http_latency_seconds_sum 5.049919744\n"
+                  "http_latency_seconds_count 100\n"s);
+
+    // The summary accumulates the values recorded since registration.
+    shard.record_value(1'000'000);
+    ss.str({});
+    reg.write(ss);
+    BOOST_TEST(ss.str().ends_with("http_latency_seconds_count 101\n"sv));
+}
+
+BOOST_AUTO_TEST_CASE(MetricRegistryNameCase)
+{
+    MetricRegistry reg;
+    reg.counter("foo", "");
+    BOOST_CHECK_THROW(reg.counter("foo", ""), invalid_argument);
+    BOOST_CHECK_THROW(reg.gauge("foo", ""), invalid_argument);
+    BOOST_CHECK_THROW(reg.gauge("1foo", ""), invalid_argument);
+    BOOST_CHECK_THROW(reg.gauge("foo-bar", ""), invalid_argument);
+    BOOST_CHECK_THROW(reg.gauge("", ""), invalid_argument);
+    reg.gauge("foo:bar_1", "");
+    BOOST_TEST(reg.size() == 2U);
+}
+
+BOOST_AUTO_TEST_CASE(MetricsAppMountCase)
+{
+    MetricRegistry reg;
+    reg.counter("foo", "Foo.").inc();
+    MetricsApp app{reg};
+
+    Router router;
+    app.mount(router, "/admin");
+    RouteParams params;
+    BOOST_TEST(router.match(Method::Get, "/admin/metrics", params));
+    BOOST_TEST(!router.match(Method::Get, "/metrics", params));
+
+    Buffer buf;
+    http::OStream os{buf};
+    app.on_metrics(CyclTime::now(), Request{}, params, os);
+    const auto out = buf.str();
+    BOOST_TEST(out.find("Content-Type: text/plain; version=0.0.4\r\n") != string_view::npos);
+    BOOST_TEST(out.find("\r\n\r\n# HELP foo Foo.\n# TYPE foo counter\nfoo 1\n") != string_view::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -21,6 +21,8 @@
 #include <toolbox/io/Buffer.hpp>
 #include <toolbox/sys/Time.hpp>
 
+#include <utility>
+
 namespace toolbox {
 inline namespace http {
 
@@ -51,8 +53,13 @@ class BasicParser {
     Method method() const noexcept { return static_cast<Method>(parser_.method); }
     bool should_keep_alive() const noexcept { return http_should_keep_alive(&parser_) != 0; }
     bool body_is_final() const noexcept { return http_body_is_final(&parser_) != 0; }
+    /// Returns true if the current message requested a protocol upgrade.
+    bool is_upgrade() const noexcept { return parser_.upgrade != 0; }
 
     void pause() noexcept { http_parser_pause(&parser_, 1); }
+    /// Instruct the parser that the current response has no body, regardless of its headers. This
+    /// must be called from on_http_headers_end(), and is required for responses to HEAD requests.
+    void skip_body() noexcept { skip_body_ = true; }
 
   protected:
     ~BasicParser() = default;
@@ -62,6 +69,7 @@ class BasicParser {
         // The http_parser_init() function preserves "data".
         http_parser_init(&parser_, static_cast<http_parser_type>(type_));
         last_header_elem_ = None;
+        skip_body_ = false;
     }
     std::size_t parse(CyclTime now, ConstBuffer buf)
     {
@@ -145,8 +153,12 @@ class BasicParser {
     }
     static int on_headers_end(http_parser* parser) noexcept
     {
-        return static_cast<DerivedT*>(parser->data)->on_http_headers_end(CyclTime::current()) ? 0
-                                                                                              : -1;
+        auto* const obj = static_cast<DerivedT*>(parser->data);
+        if (!obj->on_http_headers_end(CyclTime::current())) {
+            return -1;
+        }
+        // A return value of one tells the parser that the message has no body.
+        return std::exchange(obj->skip_body_, false) ? 1 : 0;
     }
     static int on_body(http_parser* parser, const char* at, std::size_t length) noexcept
     {
@@ -175,6 +187,7 @@ class BasicParser {
     Type type_;
     http_parser parser_;
     enum { None = 0, Field, Value } last_header_elem_;
+    bool skip_body_{false};
 };
 
 } // namespace http
@@ -16,10 +16,143 @@
 
 #include "Request.hpp"
 
+#include <toolbox/http/Types.hpp>
+
 namespace toolbox {
 inline namespace http {
+using namespace std;
+namespace {
+
+/// Case-insensitive FNV-1a hash.
+size_t ihash(string_view sv) noexcept
+{
+    size_t h{0xcbf29ce484222325};
+    for (const char c : sv) {
+        h = (h ^ static_cast<unsigned char>(to_lower(c))) * 0x100000001b3;
+    }
+    return h;
+}
+
+} // namespace
 
 Request::~Request() = default;
 
+void Request::flush_head(const char* base)
+{
+    url_ = view(base, url_field_);
+    headers_.clear();
+    for (const auto& [name, value] : header_fields_) {
+        headers_.emplace_back(view(base, name), view(base, value));
+    }
+    if (!head_flushed_) {
+        // The index and URL components are offsets, so they remain valid if the base changes.
+        index();
+        parse();
+        head_flushed_ = true;
+    }
+}
+
+void Request::detach(const char* base)
+{
+    auto own = [this, base](Field& field) {
+        if (!field.owned && field.len > 0) {
+            const auto off = buf_.size();
+            buf_.append(base + field.pos, field.len);
+            field.pos = off;
+            field.owned = true;
+        }
+    };
+    own(url_field_);
+    for (auto& [name, value] : header_fields_) {
+        own(name);
+        own(value);
+    }
+    // Resolve the views after copying, because the storage may have been reallocated.
+    flush_head(base);
+}
+
+Request::Index Request::find(string_view name) const noexcept
+{
+    if (const auto header = get_header(name); header != Header::Other) {
+        return slot(header);
+    }
+    if (table_.empty()) {
+        return 0;
+    }
+    const auto mask = table_.size() - 1;
+    for (auto pos = ihash(name) & mask;; pos = (pos + 1) & mask) {
+        const auto i = table_[pos];
+        if (i == 0 || iequals(headers_[i - 1].first, name)) {
+            return i;
+        }
+    }
+}
+
+void Request::index()
+{
+    slots_.fill(0);
+    next_.assign(headers_.size(), 0);
+    table_.clear();
+
+    // Keep the load factor of the hash table below one half.
+    size_t size{16};
+    while (size < headers_.size() * 2) {
+        size *= 2;
+    }
+    const auto mask = size - 1;
+
+    for (Index i{1}; i <= headers_.size(); ++i) {
+        const auto name = headers_[i - 1].first;
+        Index* first;
+        if (const auto header = get_header(name); header != Header::Other) {
+            first = &slots_[static_cast<size_t>(header)];
+        } else {
+            if (table_.empty()) {
+                table_.assign(size, 0);
+            }
+            auto pos = ihash(name) & mask;
+            while (table_[pos] != 0 && !iequals(headers_[table_[pos] - 1].first, name)) {
+                pos = (pos + 1) & mask;
+            }
+            first = &table_[pos];
+        }
+        if (*first == 0) {
+            *first = i;
+        } else {
+            // Append duplicate to the end of the chain.
+            auto j = *first;
+            while (next_[j - 1] != 0) {
+                j = next_[j - 1];
+            }
+            next_[j - 1] = i;
+        }
+    }
+}
+
+void Request::append(Field& field, const char* base, std::string_view sv)
+{
+    if (!field.owned) {
+        const std::size_t pos = sv.data() - base;
+        if (field.len == 0) {
+            field.pos = pos;
+            field.len = sv.size();
+            return;
+        }
+        if (field.pos + field.len == pos) {
+            // Fragment is contiguous with the previous one.
+            field.len += sv.size();
+            return;
+        }
+        // Fall back to copying the field. The field being appended to is always the last one in
+        // the request's own storage.
+        const auto off = buf_.size();
+        buf_.append(base + field.pos, field.len);
+        field.pos = off;
+        field.owned = true;
+    }
+    buf_.append(sv.data(), sv.size());
+    field.len += sv.size();
+}
+
 } // namespace http
 } // namespace toolbox
@@ -19,13 +19,23 @@
 
 #include <toolbox/http/Url.hpp>
 
+#include <array>
 #include <vector>
 
 namespace toolbox {
 inline namespace http {
 
-using Headers = std::vector<std::pair<std::string, std::string>>;
+using Headers = std::vector<std::pair<std::string_view, std::string_view>>;
 
+/// Request is an HTTP request whose URL, headers and body are views into the connection's input
+/// buffer. The views are resolved when the request is flushed, so the input buffer must remain
+/// unchanged until the application has finished with the request. Fragments that are not
+/// contiguous in the input buffer, such as the chunks of a chunked body, are copied into storage
+/// owned by the request.
+///
+/// Header fields are indexed when the request is flushed. Well-known fields are resolved to a slot
+/// by their Header enum, and other fields are entered into a small hash table keyed by their
+/// case-insensitive name. Duplicate fields are chained in order of appearance.
 class TOOLBOX_API Request : public BasicUrl<Request> {
   public:
     Request() = default;
@@ -40,39 +50,121 @@ class TOOLBOX_API Request : public BasicUrl<Request> {
     Request& operator=(Request&&) = delete;
 
     Method method() const noexcept { return method_; }
-    const std::string& url() const noexcept { return url_; }
+    std::string_view url() const noexcept { return url_; }
     const Headers& headers() const noexcept { return headers_; }
-    const std::string& body() const noexcept { return body_; }
+    std::string_view body() const noexcept { return body_; }
+
+    /// Returns the value of the first header field of the given kind, or an empty view if absent.
+    std::string_view header(Header header) const noexcept { return value(slot(header)); }
+    /// Returns the value of the first header field with the given case-insensitive name, or an
+    /// empty view if absent.
+    std::string_view header(std::string_view name) const noexcept { return value(find(name)); }
+    /// Returns true if the request has a header field of the given kind.
+    bool has_header(Header header) const noexcept { return slot(header) != 0; }
+    /// Calls fn with the value of each header field of the given kind, in order of appearance.
+    template <typename FnT>
+    void for_each_header(Header header, FnT fn) const
+    {
+        for (auto i = slot(header); i != 0; i = next_[i - 1]) {
+            fn(headers_[i - 1].second);
+        }
+    }
+    /// Calls fn with the value of each header field with the given case-insensitive name, in
+    /// order of appearance.
+    template <typename FnT>
+    void for_each_header(std::string_view name, FnT fn) const
+    {
+        for (auto i = find(name); i != 0; i = next_[i - 1]) {
+            fn(headers_[i - 1].second);
+        }
+    }
 
     void clear() noexcept
     {
         method_ = Method::Get;
-        url_.clear();
+        url_ = {};
         headers_.clear();
-        body_.clear();
+        body_ = {};
+        url_field_ = {};
+        header_fields_.clear();
+        body_field_ = {};
+        buf_.clear();
+        slots_.fill(0);
+        next_.clear();
+        table_.clear();
+        head_flushed_ = false;
+    }
+    /// Resolve the URL and header views, index the headers and parse the URL. The base argument is
+    /// the start of the input buffer that was passed to the append functions. The head may be
+    /// flushed before the body has been received. Subsequent calls only resolve the views against
+    /// the new base, which may differ if the input buffer has been reallocated.
+    void flush_head(const char* base);
+    /// Flush the head, if necessary, and resolve the body view.
+    void flush(const char* base)
+    {
+        flush_head(base);
+        body_ = view(base, body_field_);
     }
-    void flush() { parse(); }
+    /// Copy the head into storage owned by the request, so that the input buffer can be released
+    /// before the message is complete. This is used when the body is streamed.
+    void detach(const char* base);
     void set_method(Method method) noexcept { method_ = method; }
-    void append_url(std::string_view sv) { url_.append(sv.data(), sv.size()); }
-    void append_header_field(std::string_view sv, First first)
+    void append_url(const char* base, std::string_view sv) { append(url_field_, base, sv); }
+    void append_header_field(const char* base, std::string_view sv, First first)
     {
         if (first == First::Yes) {
-            headers_.emplace_back(std::string{sv.data(), sv.size()}, "");
-        } else {
-            headers_.back().first.append(sv.data(), sv.size());
+            header_fields_.emplace_back();
         }
+        append(header_fields_.back().first, base, sv);
     }
-    void append_header_value(std::string_view sv, First first)
+    void append_header_value(const char* base, std::string_view sv, First first)
     {
-        headers_.back().second.append(sv.data(), sv.size());
+        append(header_fields_.back().second, base, sv);
     }
-    void append_body(std::string_view sv) { body_.append(sv.data(), sv.size()); }
+    void append_body(const char* base, std::string_view sv) { append(body_field_, base, sv); }
 
   private:
+    /// Field is either an offset into the input buffer or into the request's own storage.
+    struct Field {
+        std::size_t pos{0}, len{0};
+        bool owned{false};
+    };
+    std::string_view view(const char* base, Field field) const noexcept
+    {
+        return {(field.owned ? buf_.data() : base) + field.pos, field.len};
+    }
+    void append(Field& field, const char* base, std::string_view sv);
+    /// Index is a one-based position in the header list, where zero denotes the end of a chain.
+    using Index = std::uint32_t;
+    /// Other headers are not indexed, so they have no slot.
+    Index slot(Header header) const noexcept
+    {
+        return header != Header::Other ? slots_[static_cast<std::size_t>(header)] : 0;
+    }
+    std::string_view value(Index i) const noexcept
+    {
+        return i != 0 ? headers_[i - 1].second : std::string_view{};
+    }
+    /// Returns the first header field with the given name.
+    Index find(std::string_view name) const noexcept;
+    void index();
+
     Method method_{Method::Get};
-    std::string url_;
+    std::string_view url_;
     Headers headers_;
-    std::string body_;
+    std::string_view body_;
+    Field url_field_;
+    std::vector<std::pair<Field, Field>> header_fields_;
+    Field body_field_;
+    bool head_flushed_{false};
+    /// Storage for fields that could not be referenced in the input buffer.
+    std::string buf_;
+    /// First header field for each well-known header.
+    std::array<Index, HeaderCount> slots_{};
+    /// Next header field with the same name.
+    std::vector<Index> next_;
+    /// Open-addressed table of the first header field for other names.
+    std::vector<Index> table_;
 };
 
 } // namespace http
@@ -0,0 +1,148 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Request.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace toolbox;
+
+BOOST_AUTO_TEST_SUITE(RequestSuite)
+
+BOOST_AUTO_TEST_CASE(RequestViewCase)
+{
+    const string in{"/foo?bar=1Host:localhost"};
+    const auto* const base = in.data();
+
+    Request req;
+    req.set_method(Method::Get);
+    req.append_url(base, {base, 4});
+    // Contiguous fragment.
+    req.append_url(base, {base + 4, 6});
+    req.append_header_field(base, {base + 10, 4}, First::Yes);
+    req.append_header_value(base, {base + 15, 9}, First::Yes);
+    req.flush(base);
+
+    BOOST_TEST(req.method() == Method::Get);
+    BOOST_TEST(req.url() == "/foo?bar=1"sv);
+    BOOST_TEST(req.url().data() == base);
+    BOOST_TEST(req.path() == "/foo"sv);
+    BOOST_TEST(req.query() == "bar=1"sv);
+    BOOST_TEST(req.headers().size() == 1U);
+    BOOST_TEST(req.headers()[0].first == "Host"sv);
+    BOOST_TEST(req.headers()[0].second == "localhost"sv);
+    BOOST_TEST(req.headers()[0].second.data() == base + 15);
+    BOOST_TEST(req.body().empty());
+}
+
+BOOST_AUTO_TEST_CASE(RequestCopyCase)
+{
+    const string in{"/foo3\r\nabc\r\n3\r\ndef\r\n"};
+    const auto* const base = in.data();
+
+    Request req;
+    req.append_url(base, {base, 4});
+    // Chunks are not contiguous in the input buffer.
+    req.append_body(base, {base + 7, 3});
+    req.append_body(base, {base + 15, 3});
+    req.flush(base);
+
+    BOOST_TEST(req.url() == "/foo"sv);
+    BOOST_TEST(req.url().data() == base);
+    BOOST_TEST(req.body() == "abcdef"sv);
+
+    req.clear();
+    BOOST_TEST(req.url().empty());
+    BOOST_TEST(req.headers().empty());
+    BOOST_TEST(req.body().empty());
+}
+
+BOOST_AUTO_TEST_CASE(RequestDetachCase)
+{
+    string in{"/foo?bar=1Host:localhost"};
+    const auto* const base = in.data();
+
+    Request req;
+    req.append_url(base, {base, 10});
+    req.append_header_field(base, {base + 10, 4}, First::Yes);
+    req.append_header_value(base, {base + 15, 9}, First::Yes);
+    req.flush_head(base);
+    BOOST_TEST(req.path() == "/foo"sv);
+    BOOST_TEST(req.header(Header::Host).data() == base + 15);
+
+    req.detach(base);
+    // Overwrite the input buffer.
+    in.assign(in.size(), '.');
+    BOOST_TEST(req.url() == "/foo?bar=1"sv);
+    BOOST_TEST(req.path() == "/foo"sv);
+    BOOST_TEST(req.query() == "bar=1"sv);
+    BOOST_TEST(req.header(Header::Host) == "localhost"sv);
+
+    req.flush(base);
+    BOOST_TEST(req.url() == "/foo?bar=1"sv);
+    BOOST_TEST(req.headers()[0].first == "Host"sv);
+}
+
+BOOST_AUTO_TEST_CASE(RequestHeaderCase)
+{
+    const string in{"/"
+                    "Content-Type: text/plain\r\n"
+                    "x-trace: abc\r\n"
+                    "Accept: text/html\r\n"
+                    "X-Trace: def\r\n"
+                    "accept: */*\r\n"};
+    const auto* const base = in.data();
+
+    Request req;
+    req.append_url(base, {base, 1});
+    for (size_t pos{1}; pos < in.size();) {
+        const auto colon = in.find(':', pos);
+        const auto eol = in.find('\r', colon);
+        req.append_header_field(base, {base + pos, colon - pos}, First::Yes);
+        req.append_header_value(base, {base + colon + 2, eol - colon - 2}, First::Yes);
+        pos = eol + 2;
+    }
+    req.flush(base);
+
+    BOOST_TEST(req.header(Header::ContentType) == "text/plain"sv);
+    BOOST_TEST(req.header("CONTENT-TYPE"sv) == "text/plain"sv);
+    BOOST_TEST(req.has_header(Header::Accept));
+    BOOST_TEST(!req.has_header(Header::Host));
+    BOOST_TEST(req.header(Header::Host).empty());
+    BOOST_TEST(req.header("X-Trace"sv) == "abc"sv);
+    BOOST_TEST(req.header("X-Missing"sv).empty());
+    // Other headers are only found by name.
+    BOOST_TEST(!req.has_header(Header::Other));
+    BOOST_TEST(req.header(Header::Other).empty());
+
+    vector<string_view> values;
+    req.for_each_header(Header::Accept, [&values](string_view sv) { values.push_back(sv); });
+    BOOST_TEST(values.size() == 2U);
+    BOOST_TEST(values[0] == "text/html"sv);
+    BOOST_TEST(values[1] == "*/*"sv);
+
+    values.clear();
+    req.for_each_header("x-TRACE"sv, [&values](string_view sv) { values.push_back(sv); });
+    BOOST_TEST(values.size() == 2U);
+    BOOST_TEST(values[0] == "abc"sv);
+    BOOST_TEST(values[1] == "def"sv);
+
+    req.clear();
+    BOOST_TEST(!req.has_header(Header::ContentType));
+    BOOST_TEST(req.header("X-Trace"sv).empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,281 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "RequestParser.hpp"
+
+#include <toolbox/http/Types.hpp>
+
+#include <cstring>
+
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#endif
+
+namespace toolbox {
+inline namespace http {
+using namespace std;
+namespace {
+
+/// Ranges are pairs of inclusive byte bounds, padded to 16 bytes for the SSE4.2 loads.
+struct Ranges {
+    alignas(16) char data[16];
+    int size;
+    constexpr bool contains(unsigned char c) const noexcept
+    {
+        for (int i{0}; i < size; i += 2) {
+            if (c >= static_cast<unsigned char>(data[i])
+                && c <= static_cast<unsigned char>(data[i + 1])) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+/// Characters that terminate the request-target: controls, space and DEL.
+constexpr Ranges UrlDelims{{'\0', ' ', '\x7f', '\x7f'}, 4};
+/// Characters that terminate a header name: controls, space, colon and DEL.
+constexpr Ranges NameDelims{{'\0', ' ', ':', ':', '\x7f', '\x7f'}, 6};
+/// Characters that terminate a header value: controls other than tab, and DEL.
+constexpr Ranges ValueDelims{{'\0', '\x08', '\x0a', '\x1f', '\x7f', '\x7f'}, 6};
+
+/// Returns a pointer to the first character in the given ranges or last if none is found.
+const char* find_range(const char* first, const char* last, const Ranges& ranges) noexcept
+{
+#if defined(__SSE4_2__)
+    const auto r16 = _mm_load_si128(reinterpret_cast<const __m128i*>(ranges.data));
+    while (last - first >= 16) {
+        const auto b16 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+        const int i{_mm_cmpestri(r16, ranges.size, b16, 16,
+                                 _SIDD_LEAST_SIGNIFICANT | _SIDD_CMP_RANGES | _SIDD_UBYTE_OPS)};
+        if (i != 16) {
+            return first + i;
+        }
+        first += 16;
+    }
+#endif
+    for (; first != last; ++first) {
+        if (ranges.contains(*first)) {
+            break;
+        }
+    }
+    return first;
+}
+
+Method parse_method(string_view sv)
+{
+    switch (sv.size()) {
+    case 3:
+        if (sv == "GET") {
+            return Method::Get;
+        }
+        if (sv == "PUT") {
+            return Method::Put;
+        }
+        break;
+    case 4:
+        if (sv == "POST") {
+            return Method::Post;
+        }
+        if (sv == "HEAD") {
+            return Method::Head;
+        }
+        break;
+    case 5:
+        if (sv == "PATCH") {
+            return Method::Patch;
+        }
+        if (sv == "TRACE") {
+            return Method::Trace;
+        }
+        break;
+    case 6:
+        if (sv == "DELETE") {
+            return Method::Delete;
+        }
+        break;
+    case 7:
+        if (sv == "OPTIONS") {
+            return Method::Options;
+        }
+        if (sv == "CONNECT") {
+            return Method::Connect;
+        }
+        break;
+    }
+    throw Exception{Status::BadRequest, err_msg() << "unsupported method: " << sv};
+}
+
+/// Advance past the end of line, which may be either CRLF or LF.
+const char* skip_eol(const char* first, const char* last)
+{
+    if (first != last && *first == '\r') {
+        ++first;
+    }
+    if (first == last || *first != '\n') {
+        throw Exception{Status::BadRequest, "invalid line ending"};
+    }
+    return first + 1;
+}
+
+int64_t parse_content_length(string_view sv)
+{
+    if (sv.empty() || sv.size() > 18) {
+        throw Exception{Status::BadRequest, "invalid content length"};
+    }
+    int64_t n{0};
+    for (const char c : sv) {
+        if (c < '0' || c > '9') {
+            throw Exception{Status::BadRequest, "invalid content length"};
+        }
+        n = n * 10 + (c - '0');
+    }
+    return n;
+}
+
+} // namespace
+
+size_t find_head_end(string_view buf, size_t pos) noexcept
+{
+    const auto* const first = buf.data();
+    const auto* const last = first + buf.size();
+    const auto* it = first + min(pos, buf.size());
+    while (it != last) {
+        it = static_cast<const char*>(memchr(it, '\n', last - it));
+        if (!it) {
+            break;
+        }
+        ++it;
+        if (it != last && *it == '\n') {
+            return it + 1 - first;
+        }
+        if (last - it >= 2 && it[0] == '\r' && it[1] == '\n') {
+            return it + 2 - first;
+        }
+    }
+    return 0;
+}
+
+void parse_request_head(string_view buf, RequestHead& head)
+{
+    const auto* it = buf.data();
+    const auto* const last = it + buf.size();
+
+    // Ignore empty lines preceding the request-line.
+    while (it != last && (*it == '\r' || *it == '\n')) {
+        ++it;
+    }
+    // Method.
+    const auto* const method_end = static_cast<const char*>(memchr(it, ' ', last - it));
+    if (!method_end) {
+        throw Exception{Status::BadRequest, "invalid request line"};
+    }
+    head.method = parse_method({it, static_cast<size_t>(method_end - it)});
+    it = method_end + 1;
+
+    // Request-target.
+    const auto* const url_end = find_range(it, last, UrlDelims);
+    if (url_end == it || url_end == last || *url_end != ' ') {
+        throw Exception{Status::BadRequest, "invalid request target"};
+    }
+    head.url = {it, static_cast<size_t>(url_end - it)};
+    it = url_end + 1;
+
+    // HTTP-version.
+    if (last - it < 8 || memcmp(it, "HTTP/1.", 7) != 0 || (it[7] != '0' && it[7] != '1')) {
+        throw Exception{Status::BadRequest, "invalid http version"};
+    }
+    head.http_minor = it[7] - '0';
+    it = skip_eol(it + 8, last);
+
+    head.header_count = 0;
+    head.content_length = -1;
+    head.chunked = false;
+    head.keep_alive = head.http_minor == 1;
+    head.upgrade = false;
+
+    // Header fields.
+    while (it != last && *it != '\r' && *it != '\n') {
+        if (head.header_count == MaxHeaders) {
+            throw Exception{Status::BadRequest, "too many headers"};
+        }
+        const auto* const name_end = find_range(it, last, NameDelims);
+        if (name_end == it || name_end == last || *name_end != ':') {
+            throw Exception{Status::BadRequest, "invalid header name"};
+        }
+        const string_view name{it, static_cast<size_t>(name_end - it)};
+        it = name_end + 1;
+        while (it != last && (*it == ' ' || *it == '\t')) {
+            ++it;
+        }
+        const auto* value_end = find_range(it, last, ValueDelims);
+        if (value_end == last || (*value_end != '\r' && *value_end != '\n')) {
+            throw Exception{Status::BadRequest, "invalid header value"};
+        }
+        const auto* const eol = value_end;
+        while (value_end != it && (value_end[-1] == ' ' || value_end[-1] == '\t')) {
+            --value_end;
+        }
+        const string_view value{it, static_cast<size_t>(value_end - it)};
+        it = skip_eol(eol, last);
+        head.headers[head.header_count++] = {name, value};
+
+        switch (name.size()) {
+        case 7:
+            if (iequals(name, "upgrade")) {
+                head.upgrade = true;
+            }
+            break;
+        case 10:
+            if (iequals(name, "connection")) {
+                for_each_token(value, [&head](string_view tok) {
+                    if (iequals(tok, "close")) {
+                        head.keep_alive = false;
+                    } else if (iequals(tok, "keep-alive")) {
+                        head.keep_alive = true;
+                    }
+                });
+            }
+            break;
+        case 14:
+            if (iequals(name, "content-length")) {
+                const auto len = parse_content_length(value);
+                if (head.content_length >= 0 && head.content_length != len) {
+                    throw Exception{Status::BadRequest, "conflicting content length"};
+                }
+                head.content_length = len;
+            }
+            break;
+        case 17:
+            if (iequals(name, "transfer-encoding")) {
+                bool chunked{false};
+                for_each_token(value,
+                               [&chunked](string_view tok) { chunked = iequals(tok, "chunked"); });
+                if (!chunked) {
+                    throw Exception{Status::BadRequest, "unsupported transfer encoding"};
+                }
+                head.chunked = true;
+            }
+            break;
+        }
+    }
+    skip_eol(it, last);
+    if (head.chunked && head.content_length >= 0) {
+        throw Exception{Status::BadRequest, "unexpected content length"};
+    }
+}
+
+} // namespace http
+} // namespace toolbox
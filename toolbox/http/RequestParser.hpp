@@ -0,0 +1,287 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_HTTP_REQUESTPARSER_HPP
+#define TOOLBOX_HTTP_REQUESTPARSER_HPP
+
+#include <toolbox/http/Exception.hpp>
+#include <toolbox/io/Buffer.hpp>
+#include <toolbox/sys/Time.hpp>
+
+#include <array>
+#include <cassert>
+
+namespace toolbox {
+inline namespace http {
+
+/// Maximum number of headers accepted in a request head.
+constexpr std::size_t MaxHeaders{64};
+/// Maximum size of a request head, including the request-line.
+constexpr std::size_t MaxHeadSize{64 * 1024};
+
+/// RequestHead is the request-line and header section of an HTTP/1.x request. The fields are
+/// views into the input buffer.
+struct RequestHead {
+    Method method{Method::Get};
+    int http_minor{1};
+    std::string_view url;
+    std::size_t header_count{0};
+    std::array<std::pair<std::string_view, std::string_view>, MaxHeaders> headers;
+    /// Content length or -1 if absent.
+    std::int64_t content_length{-1};
+    bool chunked{false};
+    bool keep_alive{true};
+    bool upgrade{false};
+};
+
+/// Returns the offset one past the blank line that terminates the request head, or zero if the
+/// head is incomplete. The search starts at the specified position.
+TOOLBOX_API std::size_t find_head_end(std::string_view buf, std::size_t pos) noexcept;
+
+/// Parse a complete request head in a single pass.
+/// \throws Exception if the head is malformed.
+TOOLBOX_API void parse_request_head(std::string_view buf, RequestHead& head);
+
+/// BasicRequestParser is a drop-in replacement for BasicParser that only supports requests.
+///
+/// Unlike the bundled http_parser, which is a byte-at-a-time state machine, the request head is
+/// parsed in one pass once it has been fully received, using SSE4.2 to scan for delimiters where
+/// available. The same on_http_* events are then emitted to the derived class. Bytes that could
+/// not be consumed, such as a partial head, must be passed to the next call to parse().
+template <typename DerivedT>
+class BasicRequestParser {
+  public:
+    explicit BasicRequestParser(Type type = Type::Request) noexcept
+    {
+        assert(type == Type::Request);
+    }
+
+    // Copy.
+    BasicRequestParser(const BasicRequestParser&) noexcept = default;
+    BasicRequestParser& operator=(const BasicRequestParser&) noexcept = default;
+
+    // Move.
+    BasicRequestParser(BasicRequestParser&&) noexcept = default;
+    BasicRequestParser& operator=(BasicRequestParser&&) noexcept = default;
+
+    int http_major() const noexcept { return 1; }
+    int http_minor() const noexcept { return head_.http_minor; }
+    Method method() const noexcept { return head_.method; }
+    bool should_keep_alive() const noexcept { return head_.keep_alive; }
+    /// Returns the Content-Length of the current request or -1 if absent.
+    std::int64_t content_length() const noexcept { return head_.content_length; }
+    bool is_upgrade() const noexcept { return head_.upgrade; }
+
+    void pause() noexcept { paused_ = true; }
+
+  protected:
+    ~BasicRequestParser() = default;
+
+    void reset() noexcept
+    {
+        state_ = State::Head;
+        scanned_ = 0;
+        paused_ = false;
+    }
+    std::size_t parse(CyclTime now, ConstBuffer buf)
+    {
+        const std::string_view in{buffer_cast<const char*>(buf), buffer_size(buf)};
+        std::size_t pos{0};
+        paused_ = false;
+        while (!paused_ && step(now, in, pos)) {
+        }
+        paused_ = false;
+        return pos;
+    }
+
+  private:
+    enum class State { Head, Body, ChunkSize, ChunkData, ChunkEnd, Trailer, End };
+
+    static void check(bool ok)
+    {
+        if (!ok) {
+            throw Exception{Status::BadRequest, "callback failed"};
+        }
+    }
+    DerivedT* derived() noexcept { return static_cast<DerivedT*>(this); }
+    /// Returns false if more input is required.
+    bool step(CyclTime now, std::string_view in, std::size_t& pos)
+    {
+        switch (state_) {
+        case State::Head:
+            return parse_head(now, in.substr(pos), pos);
+        case State::Body:
+            return parse_body(now, in.substr(pos), pos);
+        case State::ChunkSize:
+            return parse_chunk_size(now, in.substr(pos), pos);
+        case State::ChunkData:
+            return parse_chunk_data(now, in.substr(pos), pos);
+        case State::ChunkEnd:
+            return parse_chunk_end(now, in.substr(pos), pos);
+        case State::Trailer:
+            return parse_trailer(now, in.substr(pos), pos);
+        case State::End:
+            state_ = State::Head;
+            check(derived()->on_http_message_end(now));
+            return true;
+        }
+        return false;
+    }
+    bool parse_head(CyclTime now, std::string_view in, std::size_t& pos)
+    {
+        const auto end = find_head_end(in, scanned_);
+        if (end == 0) {
+            if (in.size() > MaxHeadSize) {
+                throw Exception{Status::BadRequest, "request head too large"};
+            }
+            // The terminating blank line may start in the last two bytes.
+            scanned_ = in.size() > 2 ? in.size() - 2 : 0;
+            return false;
+        }
+        scanned_ = 0;
+        parse_request_head(in.substr(0, end), head_);
+        pos += end;
+
+        auto* const obj = derived();
+        check(obj->on_http_message_begin(now));
+        check(obj->on_http_url(now, head_.url));
+        for (std::size_t i{0}; i < head_.header_count; ++i) {
+            const auto& [name, value] = head_.headers[i];
+            check(obj->on_http_header_field(now, name, First::Yes));
+            check(obj->on_http_header_value(now, value, First::Yes));
+        }
+        check(obj->on_http_headers_end(now));
+        if (head_.chunked) {
+            state_ = State::ChunkSize;
+        } else if (head_.content_length > 0) {
+            remain_ = head_.content_length;
+            state_ = State::Body;
+        } else {
+            state_ = State::End;
+        }
+        return true;
+    }
+    bool parse_body(CyclTime now, std::string_view in, std::size_t& pos)
+    {
+        if (in.empty()) {
+            return false;
+        }
+        const auto n = std::min<std::size_t>(in.size(), remain_);
+        remain_ -= n;
+        pos += n;
+        if (remain_ == 0) {
+            state_ = State::End;
+        }
+        check(derived()->on_http_body(now, in.substr(0, n)));
+        return true;
+    }
+    bool parse_chunk_size(CyclTime now, std::string_view in, std::size_t& pos)
+    {
+        const auto eol = in.find('\n');
+        if (eol == std::string_view::npos) {
+            if (in.size() > 1024) {
+                throw Exception{Status::BadRequest, "chunk size line too long"};
+            }
+            return false;
+        }
+        std::uint64_t len{0};
+        std::size_t i{0};
+        for (; i < eol; ++i) {
+            const char c{in[i]};
+            int digit;
+            if (c >= '0' && c <= '9') {
+                digit = c - '0';
+            } else if (c >= 'a' && c <= 'f') {
+                digit = c - 'a' + 10;
+            } else if (c >= 'A' && c <= 'F') {
+                digit = c - 'A' + 10;
+            } else {
+                break;
+            }
+            if (i >= 15) {
+                throw Exception{Status::BadRequest, "invalid chunk size"};
+            }
+            len = (len << 4) | digit;
+        }
+        // Ignore chunk extensions.
+        if (i == 0 || (i < eol && in[i] != ';' && in[i] != '\r' && in[i] != ' ')) {
+            throw Exception{Status::BadRequest, "invalid chunk size"};
+        }
+        pos += eol + 1;
+        remain_ = len;
+        state_ = len > 0 ? State::ChunkData : State::Trailer;
+        check(derived()->on_http_chunk_header(now, len));
+        return true;
+    }
+    bool parse_chunk_data(CyclTime now, std::string_view in, std::size_t& pos)
+    {
+        if (in.empty()) {
+            return false;
+        }
+        const auto n = std::min<std::size_t>(in.size(), remain_);
+        remain_ -= n;
+        pos += n;
+        if (remain_ == 0) {
+            state_ = State::ChunkEnd;
+        }
+        check(derived()->on_http_body(now, in.substr(0, n)));
+        return true;
+    }
+    bool parse_chunk_end(CyclTime now, std::string_view in, std::size_t& pos)
+    {
+        std::size_t n;
+        if (!in.empty() && in[0] == '\n') {
+            n = 1;
+        } else if (in.size() >= 2 && in[0] == '\r' && in[1] == '\n') {
+            n = 2;
+        } else if (in.size() < 2 && (in.empty() || in[0] == '\r')) {
+            return false;
+        } else {
+            throw Exception{Status::BadRequest, "invalid chunk terminator"};
+        }
+        pos += n;
+        state_ = State::ChunkSize;
+        check(derived()->on_http_chunk_end(now));
+        return true;
+    }
+    bool parse_trailer(CyclTime now, std::string_view in, std::size_t& pos)
+    {
+        const auto eol = in.find('\n');
+        if (eol == std::string_view::npos) {
+            if (in.size() > MaxHeadSize) {
+                throw Exception{Status::BadRequest, "trailer too large"};
+            }
+            return false;
+        }
+        pos += eol + 1;
+        // Trailer fields are discarded.
+        if (eol == 0 || (eol == 1 && in[0] == '\r')) {
+            state_ = State::End;
+            check(derived()->on_http_chunk_end(now));
+        }
+        return true;
+    }
+
+    State state_{State::Head};
+    std::size_t scanned_{0};
+    std::uint64_t remain_{0};
+    bool paused_{false};
+    RequestHead head_;
+};
+
+} // namespace http
+} // namespace toolbox
+
+#endif // TOOLBOX_HTTP_REQUESTPARSER_HPP
@@ -0,0 +1,191 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "RequestParser.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+class Parser : public BasicRequestParser<Parser> {
+    friend class BasicRequestParser<Parser>;
+
+  public:
+    using BasicRequestParser<Parser>::BasicRequestParser;
+    using BasicRequestParser<Parser>::parse;
+
+    const auto& url() const noexcept { return url_; }
+    const auto& headers() const noexcept { return headers_; }
+    const auto& body() const noexcept { return body_; }
+    int chunks() const noexcept { return chunks_; }
+    int messages() const noexcept { return messages_; }
+
+    /// Parse input, retaining unconsumed bytes in the same way as BasicConn.
+    void put(string_view sv)
+    {
+        in_.append(sv.data(), sv.size());
+        in_.erase(0, parse(CyclTime::current(), {in_.data(), in_.size()}));
+    }
+    size_t pending() const noexcept { return in_.size(); }
+
+  private:
+    bool on_http_message_begin(CyclTime now) noexcept
+    {
+        url_.clear();
+        headers_.clear();
+        body_.clear();
+        chunks_ = 0;
+        return true;
+    }
+    bool on_http_url(CyclTime now, string_view sv) noexcept
+    {
+        url_.append(sv.data(), sv.size());
+        return true;
+    }
+    bool on_http_header_field(CyclTime now, string_view sv, First first) noexcept
+    {
+        headers_.emplace_back(string{sv}, "");
+        return true;
+    }
+    bool on_http_header_value(CyclTime now, string_view sv, First first) noexcept
+    {
+        headers_.back().second.append(sv.data(), sv.size());
+        return true;
+    }
+    bool on_http_headers_end(CyclTime now) noexcept { return true; }
+    bool on_http_body(CyclTime now, string_view sv) noexcept
+    {
+        body_.append(sv.data(), sv.size());
+        return true;
+    }
+    bool on_http_message_end(CyclTime now) noexcept
+    {
+        ++messages_;
+        return true;
+    }
+    bool on_http_chunk_header(CyclTime now, size_t len) noexcept
+    {
+        ++chunks_;
+        return true;
+    }
+    bool on_http_chunk_end(CyclTime now) noexcept { return true; }
+
+    string in_;
+    string url_;
+    vector<pair<string, string>> headers_;
+    string body_;
+    int chunks_{0}, messages_{0};
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(RequestParserSuite)
+
+BOOST_AUTO_TEST_CASE(RequestParserFindHeadEndCase)
+{
+    BOOST_TEST(find_head_end("GET / HTTP/1.1\r\n"sv, 0) == 0U);
+    BOOST_TEST(find_head_end("GET / HTTP/1.1\r\n\r"sv, 0) == 0U);
+    BOOST_TEST(find_head_end("GET / HTTP/1.1\r\n\r\n"sv, 0) == 18U);
+    BOOST_TEST(find_head_end("GET / HTTP/1.1\n\nX"sv, 0) == 16U);
+    BOOST_TEST(find_head_end("GET / HTTP/1.1\r\n\r\n"sv, 16) == 0U);
+}
+
+BOOST_AUTO_TEST_CASE(RequestParserHeadCase)
+{
+    // Long enough to exercise the vectorised scan.
+    constexpr auto Message =                                             //
+        "GET /path/to/file/index.html?foo=bar HTTP/1.1\r\n"              //
+        "Host: www.example.com\r\n"                                      //
+        "User-Agent: Mozilla/5.0 (X11; Linux x86_64; rv:91.0)  \r\n"     //
+        "Accept: text/html,application/xhtml+xml,application/xml\r\n"    //
+        "Connection: close\r\n"                                          //
+        "\r\n"sv;
+
+    RequestHead head;
+    parse_request_head(Message, head);
+    BOOST_TEST(head.method == Method::Get);
+    BOOST_TEST(head.http_minor == 1);
+    BOOST_TEST(head.url == "/path/to/file/index.html?foo=bar"sv);
+    BOOST_TEST(head.header_count == 4U);
+    BOOST_TEST(head.headers[0].first == "Host"sv);
+    BOOST_TEST(head.headers[0].second == "www.example.com"sv);
+    BOOST_TEST(head.headers[1].second == "Mozilla/5.0 (X11; Linux x86_64; rv:91.0)"sv);
+    BOOST_TEST(head.content_length == -1);
+    BOOST_TEST(!head.chunked);
+    BOOST_TEST(!head.keep_alive);
+}
+
+BOOST_AUTO_TEST_CASE(RequestParserInvalidCase)
+{
+    RequestHead head;
+    BOOST_CHECK_THROW(parse_request_head("FOO / HTTP/1.1\r\n\r\n"sv, head), http::Exception);
+    BOOST_CHECK_THROW(parse_request_head("GET / HTTP/2.0\r\n\r\n"sv, head), http::Exception);
+    BOOST_CHECK_THROW(parse_request_head("GET / HTTP/1.1\r\nHost\r\n\r\n"sv, head), http::Exception);
+    BOOST_CHECK_THROW(parse_request_head("GET / HTTP/1.1\r\nBad Name: x\r\n\r\n"sv, head),
+                      http::Exception);
+    BOOST_CHECK_THROW(parse_request_head("POST / HTTP/1.1\r\nContent-Length: x\r\n\r\n"sv, head),
+                      http::Exception);
+    BOOST_CHECK_THROW(
+        parse_request_head(
+            "POST / HTTP/1.1\r\nContent-Length: 1\r\nTransfer-Encoding: chunked\r\n\r\n"sv, head),
+        http::Exception);
+}
+
+BOOST_AUTO_TEST_CASE(RequestParserBodyCase)
+{
+    Parser p;
+    p.put("POST /foo HTTP/1.0\r\nContent-Length: 6\r\n"sv);
+    BOOST_TEST(p.messages() == 0);
+    BOOST_TEST(p.pending() > 0U);
+    p.put("\r\nfoo"sv);
+    BOOST_TEST(p.messages() == 0);
+    BOOST_TEST(p.pending() == 0U);
+    p.put("bar"sv);
+    BOOST_TEST(p.messages() == 1);
+    BOOST_TEST(p.method() == Method::Post);
+    BOOST_TEST(!p.should_keep_alive());
+    BOOST_TEST(p.url() == "/foo"s);
+    BOOST_TEST(p.body() == "foobar"s);
+}
+
+BOOST_AUTO_TEST_CASE(RequestParserChunkedCase)
+{
+    Parser p;
+    p.put("POST /foo HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n"
+          "3\r\nfoo\r\n3;ext=1\r\nba"sv);
+    BOOST_TEST(p.messages() == 0);
+    p.put("r\r\n0\r\nTrailer: x\r\n\r\n"sv);
+    BOOST_TEST(p.messages() == 1);
+    BOOST_TEST(p.should_keep_alive());
+    BOOST_TEST(p.body() == "foobar"s);
+    BOOST_TEST(p.chunks() == 3);
+}
+
+BOOST_AUTO_TEST_CASE(RequestParserPipelineCase)
+{
+    Parser p;
+    p.put("GET /foo HTTP/1.1\r\nHost: a\r\n\r\nGET /bar HTTP/1.1\r\nHost: b\r\n\r\n"sv);
+    BOOST_TEST(p.messages() == 2);
+    BOOST_TEST(p.url() == "/bar"s);
+    BOOST_TEST(p.headers().size() == 1U);
+    BOOST_TEST(p.headers()[0].second == "b"s);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
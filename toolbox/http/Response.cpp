@@ -0,0 +1,56 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Response.hpp"
+
+#include <toolbox/http/Types.hpp>
+
+namespace toolbox {
+inline namespace http {
+using namespace std;
+
+Response::~Response() = default;
+
+string_view Response::header(string_view name) const noexcept
+{
+    for (const auto& [key, value] : headers_) {
+        if (iequals(key, name)) {
+            return value;
+        }
+    }
+    return {};
+}
+
+void Response::flush()
+{
+    headers_.clear();
+    for (const auto& [name, value] : header_fields_) {
+        headers_.emplace_back(view(name), view(value));
+    }
+}
+
+void Response::append(Field& field, string_view sv)
+{
+    // Fragments arrive in order, so the field being appended to is always the last one in the
+    // storage.
+    if (field.len == 0) {
+        field.pos = buf_.size();
+    }
+    buf_.append(sv.data(), sv.size());
+    field.len += sv.size();
+}
+
+} // namespace http
+} // namespace toolbox
@@ -0,0 +1,103 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_HTTP_RESPONSE_HPP
+#define TOOLBOX_HTTP_RESPONSE_HPP
+
+#include <toolbox/http/Request.hpp>
+
+namespace toolbox {
+inline namespace http {
+
+/// Response is an HTTP response received by the client. Unlike Request, the response owns its
+/// data, because pipelined responses may be interleaved with reads. The storage is retained
+/// between responses, so that a keep-alive connection does not allocate in the steady state.
+class TOOLBOX_API Response {
+  public:
+    Response() = default;
+    ~Response();
+
+    // Copy.
+    Response(const Response&) = delete;
+    Response& operator=(const Response&) = delete;
+
+    // Move.
+    Response(Response&&) = delete;
+    Response& operator=(Response&&) = delete;
+
+    int status() const noexcept { return status_; }
+    int http_minor() const noexcept { return http_minor_; }
+    std::string_view reason() const noexcept { return view(reason_); }
+    const Headers& headers() const noexcept { return headers_; }
+    std::string_view body() const noexcept { return body_; }
+
+    /// Returns the value of the first header field of the given kind, or an empty view if absent.
+    std::string_view header(Header header) const noexcept { return this->header(enum_string(header)); }
+    /// Returns the value of the first header field with the given case-insensitive name, or an
+    /// empty view if absent.
+    std::string_view header(std::string_view name) const noexcept;
+
+    void clear() noexcept
+    {
+        status_ = 0;
+        http_minor_ = 1;
+        reason_ = {};
+        headers_.clear();
+        body_.clear();
+        header_fields_.clear();
+        buf_.clear();
+    }
+    void set_status(int status, int http_minor) noexcept
+    {
+        status_ = status;
+        http_minor_ = http_minor;
+    }
+    void append_reason(std::string_view sv) { append(reason_, sv); }
+    void append_header_field(std::string_view sv, First first)
+    {
+        if (first == First::Yes) {
+            header_fields_.emplace_back();
+        }
+        append(header_fields_.back().first, sv);
+    }
+    void append_header_value(std::string_view sv, First first)
+    {
+        append(header_fields_.back().second, sv);
+    }
+    void append_body(std::string_view sv) { body_.append(sv.data(), sv.size()); }
+    /// Resolve the header views once the head is complete.
+    void flush();
+
+  private:
+    /// Field is an offset into the head storage, which may be reallocated while the head is
+    /// received.
+    struct Field {
+        std::size_t pos{0}, len{0};
+    };
+    std::string_view view(Field field) const noexcept { return {buf_.data() + field.pos, field.len}; }
+    void append(Field& field, std::string_view sv);
+
+    int status_{0}, http_minor_{1};
+    Field reason_;
+    Headers headers_;
+    std::string body_;
+    std::vector<std::pair<Field, Field>> header_fields_;
+    std::string buf_;
+};
+
+} // namespace http
+} // namespace toolbox
+
+#endif // TOOLBOX_HTTP_RESPONSE_HPP
@@ -0,0 +1,175 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ResponseCache.hpp"
+
+#include <cstring>
+
+namespace toolbox {
+inline namespace http {
+using namespace std;
+namespace {
+
+// Day and month names are fixed by RFC 7231, so the locale-dependent strftime() is not used.
+constexpr char DayNames[][4] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+constexpr char MonthNames[][4]
+    = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+
+/// Placeholder overwritten with the current date when the response is written.
+constexpr auto DatePlaceholder = "Sun, 06 Nov 1994 08:49:37 GMT"sv;
+static_assert(DatePlaceholder.size() == HttpDateSize);
+
+inline char* put_2digits(char* it, int val) noexcept
+{
+    *it++ = '0' + val / 10;
+    *it++ = '0' + val % 10;
+    return it;
+}
+
+} // namespace
+
+void format_http_date(time_t t, char* buf) noexcept
+{
+    tm tm;
+    gmtime_r(&t, &tm);
+    auto* it = buf;
+    it = copy_n(DayNames[tm.tm_wday], 3, it);
+    *it++ = ',';
+    *it++ = ' ';
+    it = put_2digits(it, tm.tm_mday);
+    *it++ = ' ';
+    it = copy_n(MonthNames[tm.tm_mon], 3, it);
+    *it++ = ' ';
+    const int year{tm.tm_year + 1900};
+    it = put_2digits(it, year / 100);
+    it = put_2digits(it, year % 100);
+    *it++ = ' ';
+    it = put_2digits(it, tm.tm_hour);
+    *it++ = ':';
+    it = put_2digits(it, tm.tm_min);
+    *it++ = ':';
+    it = put_2digits(it, tm.tm_sec);
+    memcpy(it, " GMT", 4);
+}
+
+ResponseCache::ResponseCache() = default;
+
+ResponseCache::~ResponseCache() = default;
+
+// Move.
+ResponseCache::ResponseCache(ResponseCache&&) noexcept = default;
+ResponseCache& ResponseCache::operator=(ResponseCache&&) noexcept = default;
+
+void ResponseCache::insert(Method method, string_view path, Status status,
+                           const char* content_type, string_view body, NoCache no_cache)
+{
+    const bool compressed{copts_.level > 0};
+    // The layout matches the responses formatted by OStream, with the addition of a Date header.
+    const auto serialise = [&](ContentCoding coding, string_view body) {
+        Variant v{};
+        auto& data = v.data;
+        data.reserve(160 + body.size());
+        data += "HTTP/1.1 ";
+        data += to_string(static_cast<int>(status));
+        data += ' ';
+        data += enum_string(status);
+        if (no_cache == NoCache::Yes) {
+            data += "\r\nCache-Control: no-cache";
+        }
+        if (content_type) {
+            data += "\r\nContent-Type: ";
+            data += content_type;
+        }
+        if (compressed) {
+            data += "\r\nVary: Accept-Encoding";
+        }
+        data += "\r\nContent-Length: ";
+        data += to_string(body.size());
+        if (coding != ContentCoding::Identity) {
+            data += "\r\nContent-Encoding: ";
+            data += enum_string(coding);
+        }
+        data += "\r\nDate: ";
+        v.date_pos = data.size();
+        data += DatePlaceholder;
+        data += "\r\n\r\n";
+        data += body;
+        return v;
+    };
+    Entry entry{};
+    entry[0] = serialise(ContentCoding::Identity, body);
+    if (compressed && body.size() >= copts_.threshold) {
+        string zbody;
+        for (const auto coding : {ContentCoding::Gzip, ContentCoding::Deflate}) {
+            zbody.clear();
+            compress(coding, copts_.level, body, zbody);
+            // Incompressible bodies are only stored once.
+            if (zbody.size() < body.size()) {
+                entry[static_cast<size_t>(coding)] = serialise(coding, zbody);
+            }
+        }
+    }
+
+    auto it = entries_.find(KeyView{method, path});
+    if (it != entries_.end()) {
+        it->second = move(entry);
+    } else {
+        entries_.emplace(Key{method, string{path}}, move(entry));
+    }
+}
+
+void ResponseCache::erase(Method method, string_view path)
+{
+    const auto it = entries_.find(KeyView{method, path});
+    if (it != entries_.end()) {
+        entries_.erase(it);
+    }
+}
+
+void ResponseCache::clear() noexcept
+{
+    entries_.clear();
+}
+
+bool ResponseCache::write(CyclTime now, Method method, string_view path, Buffer& buf,
+                          ContentCoding coding)
+{
+    const auto it = entries_.find(KeyView{method, path});
+    if (it == entries_.end()) {
+        return false;
+    }
+    update_date(WallClock::to_time_t(now.wall_time()));
+    const auto* v = &it->second[static_cast<size_t>(coding)];
+    if (v->data.empty()) {
+        v = &it->second[0];
+    }
+    const auto& [data, date_pos] = *v;
+    auto* const out = buffer_cast<char*>(buf.prepare(data.size()));
+    memcpy(out, data.data(), data.size());
+    memcpy(out + date_pos, date_, HttpDateSize);
+    buf.commit(data.size());
+    return true;
+}
+
+void ResponseCache::update_date(time_t t) noexcept
+{
+    if (t != date_time_) {
+        format_http_date(t, date_);
+        date_time_ = t;
+    }
+}
+
+} // namespace http
+} // namespace toolbox
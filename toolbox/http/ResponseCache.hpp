@@ -0,0 +1,133 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_HTTP_RESPONSECACHE_HPP
+#define TOOLBOX_HTTP_RESPONSECACHE_HPP
+
+#include <toolbox/http/Compress.hpp>
+#include <toolbox/http/Types.hpp>
+#include <toolbox/io/Buffer.hpp>
+#include <toolbox/sys/Time.hpp>
+#include <toolbox/util/RobinHood.hpp>
+
+#include <array>
+#include <string>
+
+namespace toolbox {
+inline namespace http {
+
+/// Length of an IMF-fixdate, for example "Sun, 06 Nov 1994 08:49:37 GMT".
+constexpr std::size_t HttpDateSize{29};
+
+/// Format an IMF-fixdate from the given time, which is truncated to seconds.
+/// The buffer must be at least HttpDateSize characters.
+TOOLBOX_API void format_http_date(std::time_t t, char* buf) noexcept;
+
+/// ResponseCache holds complete, pre-serialised responses keyed by method and path.
+///
+/// Each response is serialised once when it is inserted, so a cache hit is a single copy into
+/// the output buffer. The only per-request work is patching the Date header, which is formatted
+/// at most once per second and shared by all entries.
+///
+/// When compression is enabled, gzip and deflate variants of each sufficiently large body are
+/// also compressed once on insert, so that compressed responses cost no CPU.
+class TOOLBOX_API ResponseCache {
+    struct Key {
+        Method method;
+        std::string path;
+    };
+    struct KeyView {
+        Method method;
+        std::string_view path;
+    };
+    /// Hash and equality support heterogeneous lookup, so that find() does not allocate.
+    struct KeyHash {
+        using is_transparent = void;
+        std::size_t operator()(KeyView key) const noexcept
+        {
+            return robin_hood::hash_bytes(key.path.data(), key.path.size())
+                ^ static_cast<std::size_t>(key.method);
+        }
+        std::size_t operator()(const Key& key) const noexcept
+        {
+            return (*this)(KeyView{key.method, key.path});
+        }
+    };
+    struct KeyEqual {
+        using is_transparent = void;
+        template <typename LhsT, typename RhsT>
+        bool operator()(const LhsT& lhs, const RhsT& rhs) const noexcept
+        {
+            return lhs.method == rhs.method && lhs.path == rhs.path;
+        }
+    };
+    struct Variant {
+        std::string data;
+        /// Offset of the Date header value.
+        std::size_t date_pos;
+    };
+    /// Variants indexed by ContentCoding. Only the identity variant is guaranteed to exist.
+    using Entry = std::array<Variant, ContentCodingCount>;
+
+  public:
+    ResponseCache();
+    ~ResponseCache();
+
+    // Copy.
+    ResponseCache(const ResponseCache&) = delete;
+    ResponseCache& operator=(const ResponseCache&) = delete;
+
+    // Move.
+    ResponseCache(ResponseCache&&) noexcept;
+    ResponseCache& operator=(ResponseCache&&) noexcept;
+
+    const CompressOptions& compression() const noexcept { return copts_; }
+    /// Set the compression options that apply to subsequent inserts.
+    void set_compression(const CompressOptions& opts) noexcept { copts_ = opts; }
+
+    bool empty() const noexcept { return entries_.empty(); }
+    std::size_t size() const noexcept { return entries_.size(); }
+    bool contains(Method method, std::string_view path) const
+    {
+        return entries_.find(KeyView{method, path}) != entries_.end();
+    }
+
+    /// Serialise and insert a response, replacing any existing entry for the same method and
+    /// path. Entries may be inserted up-front, or lazily from on_http_message() the first time a
+    /// resource is requested.
+    void insert(Method method, std::string_view path, Status status, const char* content_type,
+                std::string_view body, NoCache no_cache = NoCache::No);
+    void erase(Method method, std::string_view path);
+    void clear() noexcept;
+
+    /// Append the cached response for the given method and path to the buffer, using the variant
+    /// for the coding accepted by the client if there is one. Returns false if there is no such
+    /// entry.
+    bool write(CyclTime now, Method method, std::string_view path, Buffer& buf,
+               ContentCoding coding = ContentCoding::Identity);
+
+  private:
+    void update_date(std::time_t t) noexcept;
+
+    RobinMap<Key, Entry, KeyHash, KeyEqual> entries_;
+    CompressOptions copts_;
+    std::time_t date_time_{-1};
+    char date_[HttpDateSize];
+};
+
+} // namespace http
+} // namespace toolbox
+
+#endif // TOOLBOX_HTTP_RESPONSECACHE_HPP
@@ -0,0 +1,117 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ResponseCache.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+string_view to_string_view(const Buffer& buf)
+{
+    return {buffer_cast<const char*>(buf.data()), buffer_size(buf.data())};
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(ResponseCacheSuite)
+
+BOOST_AUTO_TEST_CASE(FormatHttpDateCase)
+{
+    char buf[HttpDateSize];
+    format_http_date(784111777, buf);
+    BOOST_TEST(string_view(buf, sizeof(buf)) == "Sun, 06 Nov 1994 08:49:37 GMT"sv);
+    format_http_date(946684799, buf);
+    BOOST_TEST(string_view(buf, sizeof(buf)) == "Fri, 31 Dec 1999 23:59:59 GMT"sv);
+}
+
+BOOST_AUTO_TEST_CASE(ResponseCacheWriteCase)
+{
+    ResponseCache cache;
+    BOOST_TEST(cache.empty());
+    cache.insert(Method::Get, "/foo", Status::Ok, "text/plain", "Hello", NoCache::Yes);
+    BOOST_TEST(cache.size() == 1U);
+    BOOST_TEST(cache.contains(Method::Get, "/foo"));
+    BOOST_TEST(!cache.contains(Method::Post, "/foo"));
+    BOOST_TEST(!cache.contains(Method::Get, "/bar"));
+
+    const auto now = CyclTime::now(WallClock::from_time_t(784111777));
+    Buffer buf;
+    BOOST_TEST(!cache.write(now, Method::Get, "/bar", buf));
+    BOOST_TEST(buf.empty());
+    BOOST_TEST(cache.write(now, Method::Get, "/foo", buf));
+    BOOST_TEST(to_string_view(buf)
+               == "HTTP/1.1 200 OK\r\n"
+                  "Cache-Control: no-cache\r\n"
+                  "Content-Type: text/plain\r\n"
+                  "Content-Length: 5\r\n"
+                  "Date: Sun, 06 Nov 1994 08:49:37 GMT\r\n"
+                  "\r\n"
+                  "Hello"sv);
+
+    // The date is patched on each write.
+    buf.clear();
+    BOOST_TEST(
+        cache.write(CyclTime::now(WallClock::from_time_t(946684799)), Method::Get, "/foo", buf));
+    BOOST_TEST(to_string_view(buf).find("Date: Fri, 31 Dec 1999 23:59:59 GMT\r\n") != string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(ResponseCacheCompressCase)
+{
+    ResponseCache cache;
+    cache.set_compression({.threshold = 64, .level = 9});
+    cache.insert(Method::Get, "/small", Status::Ok, "text/plain", "Hello");
+    cache.insert(Method::Get, "/large", Status::Ok, "text/plain", string(1000, 'x'));
+
+    const auto now = CyclTime::now(WallClock::from_time_t(784111777));
+    Buffer buf;
+    // There is no compressed variant below the threshold.
+    BOOST_TEST(cache.write(now, Method::Get, "/small", buf, ContentCoding::Gzip));
+    BOOST_TEST(to_string_view(buf).find("Content-Encoding") == string::npos);
+    BOOST_TEST(to_string_view(buf).find("Vary: Accept-Encoding\r\n") != string::npos);
+
+    buf.clear();
+    BOOST_TEST(cache.write(now, Method::Get, "/large", buf, ContentCoding::Deflate));
+    BOOST_TEST(to_string_view(buf).find("Content-Encoding: deflate\r\n") != string::npos);
+    BOOST_TEST(buf.size() < 200U);
+
+    buf.clear();
+    BOOST_TEST(cache.write(now, Method::Get, "/large", buf));
+    BOOST_TEST(to_string_view(buf).find("Content-Encoding") == string::npos);
+    BOOST_TEST(buf.size() > 1000U);
+}
+
+BOOST_AUTO_TEST_CASE(ResponseCacheReplaceCase)
+{
+    ResponseCache cache;
+    cache.insert(Method::Get, "/foo", Status::Ok, "text/plain", "Hello");
+    cache.insert(Method::Get, "/foo", Status::NotFound, nullptr, "");
+    BOOST_TEST(cache.size() == 1U);
+
+    Buffer buf;
+    BOOST_TEST(cache.write(CyclTime::now(WallClock::from_time_t(784111777)), Method::Get, "/foo",
+                           buf));
+    BOOST_TEST(to_string_view(buf)
+               == "HTTP/1.1 404 Not Found\r\n"
+                  "Content-Length: 0\r\n"
+                  "Date: Sun, 06 Nov 1994 08:49:37 GMT\r\n"
+                  "\r\n"sv);
+
+    cache.erase(Method::Get, "/foo");
+    BOOST_TEST(cache.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,195 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Router.hpp"
+
+#include <toolbox/http/Request.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace toolbox {
+inline namespace http {
+using namespace std;
+namespace {
+
+/// Split the first segment from a path that is either empty or begins with a slash.
+/// Returns the segment and leaves the remainder in path.
+inline string_view next_segment(string_view& path) noexcept
+{
+    const auto pos = path.find('/', 1);
+    const auto seg = path.substr(1, pos == string_view::npos ? string_view::npos : pos - 1);
+    path.remove_prefix(1 + seg.size());
+    return seg;
+}
+
+} // namespace
+
+Router::Router()
+: nodes_(1)
+{
+}
+
+Router::~Router() = default;
+
+// Copy.
+Router::Router(const Router&) = default;
+Router& Router::operator=(const Router&) = default;
+
+// Move.
+Router::Router(Router&&) noexcept = default;
+Router& Router::operator=(Router&&) noexcept = default;
+
+void Router::add(Method method, string_view pattern, Handler handler)
+{
+    if (pattern.empty() || pattern.front() != '/') {
+        throw invalid_argument{"invalid route pattern: "s + string{pattern}};
+    }
+    if (pattern == "/") {
+        pattern = {};
+    }
+    // Validate the pattern before the trie is modified.
+    size_t nparams{0};
+    for (auto rest = pattern; !rest.empty();) {
+        const auto seg = next_segment(rest);
+        if (!seg.empty() && (seg.front() == ':' || seg.front() == '*')) {
+            if (seg.size() == 1 || (seg.front() == '*' && !rest.empty())
+                || ++nparams > MaxRouteParams) {
+                throw invalid_argument{"invalid route pattern: "s + string{pattern}};
+            }
+        }
+    }
+    uint32_t node{0};
+    while (!pattern.empty()) {
+        const auto seg = next_segment(pattern);
+        if (!seg.empty() && (seg.front() == ':' || seg.front() == '*')) {
+            const auto name = seg.substr(1);
+            auto child = seg.front() == ':' ? nodes_[node].param : nodes_[node].wildcard;
+            if (child == 0) {
+                child = nodes_.size();
+                nodes_.emplace_back().name = name;
+                if (seg.front() == ':') {
+                    nodes_[node].param = child;
+                } else {
+                    nodes_[node].wildcard = child;
+                }
+            } else if (nodes_[child].name != name) {
+                throw invalid_argument{"conflicting route parameter: "s + string{seg}};
+            }
+            node = child;
+        } else {
+            auto& children = nodes_[node].children;
+            const auto it = find_if(children.begin(), children.end(),
+                                    [seg](const auto& child) { return child.first == seg; });
+            if (it != children.end()) {
+                node = it->second;
+            } else {
+                const uint32_t child = nodes_.size();
+                nodes_[node].children.emplace_back(seg, child);
+                nodes_.emplace_back();
+                node = child;
+            }
+        }
+    }
+    auto& handlers = nodes_[node].handlers;
+    const auto it = find_if(handlers.begin(), handlers.end(),
+                            [method](const auto& h) { return h.first == method; });
+    if (it != handlers.end()) {
+        it->second = handler;
+    } else {
+        handlers.emplace_back(method, handler);
+        ++size_;
+    }
+}
+
+const Router::Handler* Router::match(Method method, string_view path, RouteParams& params,
+                                     bool* path_found) const noexcept
+{
+    if (path_found) {
+        *path_found = false;
+    }
+    params.clear();
+    if (path.empty() || path.front() != '/') {
+        return nullptr;
+    }
+    if (path == "/") {
+        path = {};
+    }
+    return match(0, method, path, params, path_found);
+}
+
+Status Router::dispatch(CyclTime now, const Request& req, OStream& os) const
+{
+    RouteParams params;
+    bool path_found;
+    const auto* const handler = match(req.method(), req.path(), params, &path_found);
+    if (!handler) {
+        return path_found ? Status::MethodNotAllowed : Status::NotFound;
+    }
+    (*handler)(now, req, params, os);
+    return Status::Ok;
+}
+
+const Router::Handler* Router::find_handler(uint32_t node, Method method,
+                                            bool* path_found) const noexcept
+{
+    const auto& handlers = nodes_[node].handlers;
+    for (const auto& [m, handler] : handlers) {
+        if (m == method) {
+            return &handler;
+        }
+    }
+    if (path_found && !handlers.empty()) {
+        *path_found = true;
+    }
+    return nullptr;
+}
+
+const Router::Handler* Router::match(uint32_t node, Method method, string_view path,
+                                     RouteParams& params, bool* path_found) const noexcept
+{
+    if (path.empty()) {
+        return find_handler(node, method, path_found);
+    }
+    const auto& n = nodes_[node];
+    auto rest = path;
+    const auto seg = next_segment(rest);
+    for (const auto& [literal, child] : n.children) {
+        if (literal == seg) {
+            if (const auto* handler = match(child, method, rest, params, path_found)) {
+                return handler;
+            }
+            break;
+        }
+    }
+    if (n.param != 0 && !seg.empty()) {
+        params.push_back(nodes_[n.param].name, seg);
+        if (const auto* handler = match(n.param, method, rest, params, path_found)) {
+            return handler;
+        }
+        params.pop_back();
+    }
+    if (n.wildcard != 0) {
+        params.push_back(nodes_[n.wildcard].name, path.substr(1));
+        if (const auto* handler = find_handler(n.wildcard, method, path_found)) {
+            return handler;
+        }
+        params.pop_back();
+    }
+    return nullptr;
+}
+
+} // namespace http
+} // namespace toolbox
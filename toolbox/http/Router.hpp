@@ -0,0 +1,149 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_HTTP_ROUTER_HPP
+#define TOOLBOX_HTTP_ROUTER_HPP
+
+#include <toolbox/http/Types.hpp>
+#include <toolbox/sys/Time.hpp>
+#include <toolbox/util/Slot.hpp>
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace toolbox {
+inline namespace http {
+class OStream;
+class Request;
+
+/// Maximum number of parameters in a route pattern.
+constexpr std::size_t MaxRouteParams{8};
+
+/// RouteParams holds the parameters extracted from the request path by Router. The names are
+/// views into the router and the values are views into the request path, so neither may outlive
+/// the dispatch. Values are not percent-decoded.
+class RouteParams {
+  public:
+    using value_type = std::pair<std::string_view, std::string_view>;
+    using const_iterator = const value_type*;
+
+    RouteParams() noexcept = default;
+    ~RouteParams() = default;
+
+    // Copy.
+    RouteParams(const RouteParams&) noexcept = default;
+    RouteParams& operator=(const RouteParams&) noexcept = default;
+
+    // Move.
+    RouteParams(RouteParams&&) noexcept = default;
+    RouteParams& operator=(RouteParams&&) noexcept = default;
+
+    const_iterator begin() const noexcept { return params_.data(); }
+    const_iterator end() const noexcept { return params_.data() + size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    std::size_t size() const noexcept { return size_; }
+    const value_type& operator[](std::size_t i) const noexcept { return params_[i]; }
+    /// Returns the value of the named parameter, or an empty view if absent.
+    std::string_view operator[](std::string_view name) const noexcept
+    {
+        for (std::size_t i{0}; i < size_; ++i) {
+            if (params_[i].first == name) {
+                return params_[i].second;
+            }
+        }
+        return {};
+    }
+
+    void clear() noexcept { size_ = 0; }
+    void push_back(std::string_view name, std::string_view value) noexcept
+    {
+        params_[size_++] = {name, value};
+    }
+    void pop_back() noexcept { --size_; }
+
+  private:
+    std::array<value_type, MaxRouteParams> params_;
+    std::size_t size_{0};
+};
+
+/// Router dispatches requests to handlers by method and path.
+///
+/// Route patterns are compiled into a trie of path segments. A segment may be a literal, a named
+/// parameter such as ":id", which matches any non-empty segment, or a trailing wildcard such as
+/// "*path", which matches the remainder of the path including slashes. Literal segments take
+/// precedence over parameters, which take precedence over wildcards. For example:
+///
+///   router.add(Method::Get, "/users/:id", bind<&MyApp::on_get_user>(this));
+///   router.add(Method::Get, "/static/*path", bind<&MyApp::on_static>(this));
+///
+/// Matching does not allocate, so routes should be added before the router is used.
+class TOOLBOX_API Router {
+  public:
+    using Handler = BasicSlot<CyclTime, const Request&, const RouteParams&, OStream&>;
+
+    Router();
+    ~Router();
+
+    // Copy.
+    Router(const Router&);
+    Router& operator=(const Router&);
+
+    // Move.
+    Router(Router&&) noexcept;
+    Router& operator=(Router&&) noexcept;
+
+    bool empty() const noexcept { return size_ == 0; }
+    /// Returns the number of routes.
+    std::size_t size() const noexcept { return size_; }
+
+    /// Add a route, replacing any existing handler for the same method and pattern.
+    /// \throws std::invalid_argument if the pattern is malformed.
+    void add(Method method, std::string_view pattern, Handler handler);
+
+    /// Returns the handler for the given method and path, or null if there is no match, in which
+    /// case the parameters are unspecified. If path_found is not null, it is set to true if the
+    /// path matched a route for a different method.
+    const Handler* match(Method method, std::string_view path, RouteParams& params,
+                         bool* path_found = nullptr) const noexcept;
+
+    /// Dispatch the request to the matching handler. Returns Status::Ok if the request was
+    /// dispatched, otherwise Status::NotFound or Status::MethodNotAllowed, and the caller is
+    /// responsible for the response.
+    Status dispatch(CyclTime now, const Request& req, OStream& os) const;
+
+  private:
+    struct Node {
+        /// Literal children.
+        std::vector<std::pair<std::string, std::uint32_t>> children;
+        /// Parameter or wildcard name, if this is a parameter or wildcard node.
+        std::string name;
+        std::uint32_t param{0}, wildcard{0};
+        std::vector<std::pair<Method, Handler>> handlers;
+    };
+    const Handler* find_handler(std::uint32_t node, Method method,
+                                bool* path_found) const noexcept;
+    const Handler* match(std::uint32_t node, Method method, std::string_view path,
+                         RouteParams& params, bool* path_found) const noexcept;
+
+    /// Node zero is the root. A child index of zero means no child.
+    std::vector<Node> nodes_;
+    std::size_t size_{0};
+};
+
+} // namespace http
+} // namespace toolbox
+
+#endif // TOOLBOX_HTTP_ROUTER_HPP
@@ -0,0 +1,127 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Router.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+struct Handlers {
+    void on_root(CyclTime now, const Request& req, const RouteParams& params, http::OStream& os)
+    {
+        last = "root";
+    }
+    void on_user(CyclTime now, const Request& req, const RouteParams& params, http::OStream& os)
+    {
+        last = "user";
+    }
+    void on_me(CyclTime now, const Request& req, const RouteParams& params, http::OStream& os)
+    {
+        last = "me";
+    }
+    void on_order(CyclTime now, const Request& req, const RouteParams& params, http::OStream& os)
+    {
+        last = "order";
+    }
+    void on_static(CyclTime now, const Request& req, const RouteParams& params, http::OStream& os)
+    {
+        last = "static";
+    }
+    string last;
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(RouterSuite)
+
+BOOST_AUTO_TEST_CASE(RouterMatchCase)
+{
+    Handlers h;
+    Router r;
+    r.add(Method::Get, "/", bind<&Handlers::on_root>(&h));
+    r.add(Method::Get, "/users/:id", bind<&Handlers::on_user>(&h));
+    r.add(Method::Delete, "/users/:id", bind<&Handlers::on_user>(&h));
+    r.add(Method::Get, "/users/me", bind<&Handlers::on_me>(&h));
+    r.add(Method::Get, "/users/:id/orders/:order", bind<&Handlers::on_order>(&h));
+    r.add(Method::Get, "/static/*path", bind<&Handlers::on_static>(&h));
+    BOOST_TEST(r.size() == 6U);
+
+    RouteParams params;
+    BOOST_CHECK(*r.match(Method::Get, "/", params) == bind<&Handlers::on_root>(&h));
+    BOOST_TEST(params.empty());
+
+    // Literal segments take precedence over parameters.
+    BOOST_CHECK(*r.match(Method::Get, "/users/me", params) == bind<&Handlers::on_me>(&h));
+    BOOST_TEST(params.empty());
+
+    BOOST_CHECK(*r.match(Method::Get, "/users/123", params) == bind<&Handlers::on_user>(&h));
+    BOOST_TEST(params.size() == 1U);
+    BOOST_TEST(params["id"] == "123"sv);
+    BOOST_TEST(params["foo"].empty());
+
+    // Backtrack from the literal "me" to the parameter.
+    BOOST_CHECK(*r.match(Method::Get, "/users/me/orders/42", params)
+               == bind<&Handlers::on_order>(&h));
+    BOOST_TEST(params.size() == 2U);
+    BOOST_TEST(params["id"] == "me"sv);
+    BOOST_TEST(params["order"] == "42"sv);
+
+    BOOST_CHECK(*r.match(Method::Get, "/static/css/main.css", params)
+               == bind<&Handlers::on_static>(&h));
+    BOOST_TEST(params["path"] == "css/main.css"sv);
+}
+
+BOOST_AUTO_TEST_CASE(RouterNoMatchCase)
+{
+    Handlers h;
+    Router r;
+    r.add(Method::Get, "/users/:id", bind<&Handlers::on_user>(&h));
+
+    RouteParams params;
+    bool path_found;
+    BOOST_TEST(!r.match(Method::Get, "/users", params, &path_found));
+    BOOST_TEST(!path_found);
+    BOOST_TEST(!r.match(Method::Get, "/users/", params, &path_found));
+    BOOST_TEST(!path_found);
+    BOOST_TEST(!r.match(Method::Get, "/users/1/2", params, &path_found));
+    BOOST_TEST(!path_found);
+    BOOST_TEST(!r.match(Method::Get, "", params, &path_found));
+    BOOST_TEST(!path_found);
+    BOOST_TEST(!r.match(Method::Post, "/users/1", params, &path_found));
+    BOOST_TEST(path_found);
+}
+
+BOOST_AUTO_TEST_CASE(RouterInvalidCase)
+{
+    Handlers h;
+    Router r;
+    BOOST_CHECK_THROW(r.add(Method::Get, "", bind<&Handlers::on_root>(&h)), invalid_argument);
+    BOOST_CHECK_THROW(r.add(Method::Get, "foo", bind<&Handlers::on_root>(&h)), invalid_argument);
+    BOOST_CHECK_THROW(r.add(Method::Get, "/:", bind<&Handlers::on_root>(&h)), invalid_argument);
+    BOOST_CHECK_THROW(r.add(Method::Get, "/*path/foo", bind<&Handlers::on_root>(&h)),
+                      invalid_argument);
+    r.add(Method::Get, "/users/:id", bind<&Handlers::on_user>(&h));
+    BOOST_CHECK_THROW(r.add(Method::Get, "/users/:name", bind<&Handlers::on_user>(&h)),
+                      invalid_argument);
+    // Replace the existing handler.
+    r.add(Method::Get, "/users/:id", bind<&Handlers::on_me>(&h));
+    BOOST_TEST(r.size() == 1U);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
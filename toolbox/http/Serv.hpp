@@ -62,7 +62,24 @@ class BasicServ : public StreamAcceptor<BasicServ<ConnT, AppT>> {
     void on_sock_prepare(CyclTime now, IoSock& sock) {}
     void on_sock_accept(CyclTime now, IoSock&& sock, const Endpoint& ep)
     {
-        auto* const conn = new Conn{now, reactor_, std::move(sock), ep, app_};
+        auto* const admission = app_.admission();
+        if (admission && !admission->on_connect(ep)) {
+            // Reject the connection without allocating one. The response is written on a best
+            // effort basis before the socket is closed, and the request is not read.
+            std::error_code ec;
+            sock.send(ServiceUnavailableResponse.data(), ServiceUnavailableResponse.size(),
+                      MSG_NOSIGNAL, ec);
+            return;
+        }
+        Conn* conn;
+        try {
+            conn = new Conn{now, reactor_, std::move(sock), ep, app_};
+        } catch (...) {
+            if (admission) {
+                admission->on_disconnect(ep);
+            }
+            throw;
+        }
         conn_list_.push_back(*conn);
     }
 
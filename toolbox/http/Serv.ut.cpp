@@ -0,0 +1,193 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Serv.hpp"
+
+#include <toolbox/http/App.hpp>
+#include <toolbox/net/StreamSock.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <unistd.h>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+class TestApp final : public App {
+  public:
+    /// Accept the held back body, or let the idle producer write, and notify the connection.
+    void resume(CyclTime now)
+    {
+        paused = false;
+        if (os_) {
+            os_->resume(now);
+        }
+    }
+    bool producing() const noexcept { return os_ != nullptr; }
+    bool paused{false};
+    int disconnects{0};
+
+  protected:
+    void do_on_http_connect(CyclTime now, const Endpoint& ep) override {}
+    void do_on_http_disconnect(CyclTime now, const Endpoint& ep) noexcept override
+    {
+        ++disconnects;
+        os_ = nullptr;
+    }
+    void do_on_http_error(CyclTime now, const Endpoint& ep, const std::exception& e,
+                          http::OStream& os) noexcept override
+    {
+    }
+    void do_on_http_message(CyclTime now, const Endpoint& ep, const Request& req,
+                            http::OStream& os) override
+    {
+        if (req.path() == "/produce") {
+            os_ = &os;
+            os.reset_chunked(Status::Ok, "text/plain");
+            os.set_producer(bind<&TestApp::on_produce>(this));
+            return;
+        }
+        os.reset(Status::Ok, "text/plain");
+        os << req.method() << ' ' << req.path();
+        os.commit();
+    }
+    void do_on_http_timeout(CyclTime now, const Endpoint& ep) noexcept override {}
+    bool do_on_http_headers(CyclTime now, const Endpoint& ep, const Request& req) override
+    {
+        body_.clear();
+        return req.path() == "/stream";
+    }
+    size_t do_on_http_body_chunk(CyclTime now, const Endpoint& ep, const Request& req,
+                                 string_view data, http::OStream& os) override
+    {
+        os_ = &os;
+        if (paused) {
+            return 0;
+        }
+        body_ += data;
+        return data.size();
+    }
+    void do_on_http_message_end(CyclTime now, const Endpoint& ep, const Request& req,
+                                http::OStream& os) override
+    {
+        os_ = nullptr;
+        os.reset(Status::Ok, "text/plain");
+        os << body_;
+        os.commit();
+    }
+
+  private:
+    void on_produce(CyclTime now, http::OStream& os)
+    {
+        // The producer is idle while paused.
+        if (!paused) {
+            os << "foo";
+            os.finish();
+        }
+    }
+    http::OStream* os_{nullptr};
+    string body_;
+};
+
+struct Fixture {
+    Fixture() { unlink(path.c_str()); }
+    ~Fixture() { unlink(path.c_str()); }
+    /// Poll the reactor and read from the socket until the predicate is satisfied or a second has
+    /// elapsed.
+    template <typename FnT>
+    bool poll_until(StreamSockClnt& sock, FnT fn)
+    {
+        const auto end = MonoClock::now() + 1s;
+        while (!fn()) {
+            if (MonoClock::now() > end) {
+                return false;
+            }
+            reactor.poll(CyclTime::now(), 10ms);
+            char buf[1024];
+            error_code ec;
+            const auto n = sock.recv(buf, sizeof(buf), MSG_DONTWAIT, ec);
+            if (n > 0) {
+                out.append(buf, n);
+            }
+        }
+        return true;
+    }
+    const string path{"/tmp/tb-http-serv-"s + to_string(getpid()) + ".sock"};
+    const StreamEndpoint ep{parse_stream_endpoint("unix://" + path)};
+    Reactor reactor{1024};
+    TestApp app;
+    string out;
+};
+
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(ServSuite, Fixture)
+
+BOOST_AUTO_TEST_CASE(ServBodyResumeCase)
+{
+    Serv serv{CyclTime::now(), reactor, ep, app};
+    StreamSockClnt sock{ep.protocol()};
+    sock.connect(ep);
+
+    app.paused = true;
+    const auto req = "POST /stream HTTP/1.1\r\nHost: localhost\r\nContent-Length: 6\r\n\r\n"
+                     "foobar"s;
+    sock.send(req.data(), req.size(), 0);
+    // The connection waits for the application rather than offering the body again.
+    BOOST_TEST(!poll_until(sock, [this]() { return out.find("foobar") != string::npos; }));
+
+    app.resume(CyclTime::now());
+    BOOST_TEST(poll_until(sock, [this]() { return out.find("foobar") != string::npos; }));
+    BOOST_TEST(out.find("HTTP/1.1 200 OK\r\n") == 0U);
+}
+
+BOOST_AUTO_TEST_CASE(ServProducerResumeCase)
+{
+    Serv serv{CyclTime::now(), reactor, ep, app};
+    StreamSockClnt sock{ep.protocol()};
+    sock.connect(ep);
+
+    app.paused = true;
+    const auto req = "GET /produce HTTP/1.1\r\nHost: localhost\r\n\r\n"s;
+    sock.send(req.data(), req.size(), 0);
+    // The idle producer is not invoked again until the application calls resume().
+    BOOST_TEST(!poll_until(sock, [this]() { return out.find("0\r\n\r\n") != string::npos; }));
+
+    app.resume(CyclTime::now());
+    BOOST_TEST(poll_until(sock, [this]() { return out.find("0\r\n\r\n") != string::npos; }));
+    BOOST_TEST(out.find("HTTP/1.1 200 OK\r\n") == 0U);
+    BOOST_TEST(out.find("3\r\nfoo\r\n") != string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(ServProducerCloseCase)
+{
+    Serv serv{CyclTime::now(), reactor, ep, app};
+    StreamSockClnt sock{ep.protocol()};
+    sock.connect(ep);
+
+    app.paused = true;
+    const auto req = "GET /produce HTTP/1.1\r\nHost: localhost\r\n\r\n"s;
+    sock.send(req.data(), req.size(), 0);
+    BOOST_TEST(poll_until(sock, [this]() { return app.producing(); }));
+
+    // The client closes its side of the connection while the producer is idle, which is only
+    // signalled by the FIN.
+    sock.shutdown(SHUT_WR);
+    BOOST_TEST(poll_until(sock, [this]() { return app.disconnects == 1; }));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
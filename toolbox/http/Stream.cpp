@@ -19,6 +19,13 @@
 namespace toolbox {
 inline namespace http {
 using namespace std;
+namespace {
+
+/// Fixed-width chunk size, which may be preceded by leading zeros.
+constexpr auto ChunkSizePlaceholder = "00000000\r\n"sv;
+constexpr std::streamsize ChunkSizeWidth{8};
+
+} // namespace
 
 void StreamBuf::set_content_length(std::streamsize pos, std::streamsize len) noexcept
 {
@@ -30,6 +37,17 @@ void StreamBuf::set_content_length(std::streamsize pos, std::streamsize len) noe
     } while (len > 0);
 }
 
+void StreamBuf::set_chunk_size(std::streamsize pos, std::streamsize len) noexcept
+{
+    constexpr char Digits[]{"0123456789abcdef"};
+    auto* it = pbase_ + pos + ChunkSizeWidth;
+    do {
+        --it;
+        *it = Digits[len & 0xf];
+        len >>= 4;
+    } while (len > 0);
+}
+
 StreamBuf::~StreamBuf() = default;
 
 StreamBuf::int_type StreamBuf::overflow(int_type c) noexcept
@@ -55,7 +73,30 @@ OStream::~OStream() = default;
 
 void OStream::commit() noexcept
 {
+    if (close_delimited_) {
+        buf_.commit();
+        buf_.reset();
+        return;
+    }
+    if (chunked_) {
+        const auto len = buf_.pcount() - hcount_ - ChunkSizeWidth - 2;
+        if (len > 0) {
+            buf_.set_chunk_size(hcount_, len);
+            *this << "\r\n";
+        } else {
+            // A zero-length chunk would terminate the response.
+            buf_.truncate(hcount_);
+        }
+        buf_.commit();
+        buf_.reset();
+        begin_chunk();
+        return;
+    }
     if (cloff_ > 0) {
+        if (copts_.level > 0 && coding_ != ContentCoding::Identity
+            && static_cast<size_t>(buf_.pcount() - hcount_) >= copts_.threshold) {
+            compress_body();
+        }
         buf_.set_content_length(cloff_, buf_.pcount() - hcount_);
     }
     buf_.commit();
@@ -74,14 +115,112 @@ void OStream::reset(Status status, const char* content_type, NoCache no_cache)
         // Status-Line = HTTP-Version SP Status-Code SP Reason-Phrase CRLF. Use 10 space
         // place-holder for content length. RFC2616 states that field value MAY be preceded by any
         // amount of LWS, though a single SP is preferred.
-        *this << "\r\nContent-Type: " << content_type //
-              << "\r\nContent-Length:          0";
+        *this << "\r\nContent-Type: " << content_type;
+        if (copts_.level > 0) {
+            // The representation depends on Accept-Encoding whether or not this response is
+            // compressed.
+            *this << "\r\nVary: Accept-Encoding";
+        }
+        *this << "\r\nContent-Length:          0";
         cloff_ = buf_.pcount();
     } else {
         cloff_ = 0;
     }
     *this << "\r\n\r\n";
     hcount_ = buf_.pcount();
+    chunked_ = close_delimited_ = false;
+    producer_.reset();
+}
+
+void OStream::reset_chunked(Status status, const char* content_type, NoCache no_cache)
+{
+    buf_.reset();
+    *this << reset_state;
+
+    *this << "HTTP/1.1 " << status << ' ' << enum_string(status);
+    if (no_cache == NoCache::Yes) {
+        *this << "\r\nCache-Control: no-cache";
+    }
+    if (content_type) {
+        *this << "\r\nContent-Type: " << content_type;
+    }
+    cloff_ = 0;
+    producer_.reset();
+    if (!chunking_) {
+        // Without a length or chunked framing, the end of the body is signalled by closing the
+        // connection.
+        *this << "\r\nConnection: close\r\n\r\n";
+        hcount_ = buf_.pcount();
+        chunked_ = false;
+        close_delimited_ = true;
+        return;
+    }
+    *this << "\r\nTransfer-Encoding: chunked\r\n\r\n";
+    chunked_ = true;
+    close_delimited_ = false;
+    begin_chunk();
+}
+
+void OStream::write_event(string_view data, string_view event, string_view id)
+{
+    if (!id.empty()) {
+        *this << "id: " << id << '\n';
+    }
+    if (!event.empty()) {
+        *this << "event: " << event << '\n';
+    }
+    // Lines may be terminated by CRLF, CR or LF.
+    for (;;) {
+        const auto pos = data.find_first_of("\r\n");
+        *this << "data: " << data.substr(0, pos) << '\n';
+        if (pos == string_view::npos) {
+            break;
+        }
+        data.remove_prefix(data.substr(pos, 2) == "\r\n" ? pos + 2 : pos + 1);
+    }
+    *this << '\n';
+    commit();
+}
+
+void OStream::finish() noexcept
+{
+    if (close_delimited_) {
+        commit();
+    } else if (chunked_) {
+        commit();
+        // Replace the placeholder of the next chunk with the last-chunk.
+        buf_.truncate(hcount_);
+        *this << "0\r\n\r\n";
+        buf_.commit();
+        buf_.reset();
+        chunked_ = false;
+    }
+    producer_.reset();
+}
+
+void OStream::compress_body() noexcept
+{
+    try {
+        zbuf_.clear();
+        compress(coding_, copts_.level, buf_.str().substr(hcount_), zbuf_);
+        if (zbuf_.size() >= static_cast<size_t>(buf_.pcount() - hcount_)) {
+            // Incompressible.
+            return;
+        }
+        // Replace the blank line that terminates the header with the Content-Encoding field.
+        buf_.truncate(hcount_ - 2);
+        *this << "Content-Encoding: " << enum_string(coding_) << "\r\n\r\n";
+        hcount_ = buf_.pcount();
+        write(zbuf_.data(), zbuf_.size());
+    } catch (const std::exception&) {
+        // Send the body uncompressed.
+    }
+}
+
+void OStream::begin_chunk() noexcept
+{
+    hcount_ = buf_.pcount();
+    *this << ChunkSizePlaceholder;
 }
 
 } // namespace http
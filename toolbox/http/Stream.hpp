@@ -17,14 +17,18 @@
 #ifndef TOOLBOX_HTTP_STREAM_HPP
 #define TOOLBOX_HTTP_STREAM_HPP
 
+#include <toolbox/http/Compress.hpp>
 #include <toolbox/http/Types.hpp>
 #include <toolbox/io/Buffer.hpp>
+#include <toolbox/sys/Time.hpp>
+#include <toolbox/util/Slot.hpp>
 #include <toolbox/util/Stream.hpp>
 
 namespace toolbox {
 inline namespace http {
 
 constexpr char ApplicationJson[]{"application/json"};
+constexpr char TextEventStream[]{"text/event-stream"};
 constexpr char TextHtml[]{"text/html"};
 constexpr char TextPlain[]{"text/plain"};
 
@@ -45,13 +49,22 @@ class TOOLBOX_API StreamBuf final : public std::streambuf {
     StreamBuf& operator=(StreamBuf&&) = delete;
 
     std::streamsize pcount() const noexcept { return pcount_; }
+    /// Returns the bytes that have yet to be committed.
+    std::string_view str() const noexcept
+    {
+        return {pbase_, static_cast<std::size_t>(pcount_)};
+    }
     void commit() noexcept { buf_.commit(pcount_); }
     void reset() noexcept
     {
         pbase_ = nullptr;
         pcount_ = 0;
     }
+    /// Discard bytes beyond the given count that have not been committed.
+    void truncate(std::streamsize count) noexcept { pcount_ = count; }
     void set_content_length(std::streamsize pos, std::streamsize len) noexcept;
+    /// Write the chunk size as a fixed-width hex number at the given position.
+    void set_chunk_size(std::streamsize pos, std::streamsize len) noexcept;
 
   protected:
     int_type overflow(int_type c) noexcept override;
@@ -63,8 +76,24 @@ class TOOLBOX_API StreamBuf final : public std::streambuf {
     std::streamsize pcount_{0};
 };
 
+/// OStream writes HTTP responses to a buffer.
+///
+/// A response either has a fixed length, which is back-patched into the header on commit(), or
+/// uses chunked transfer encoding, in which case each commit() emits a chunk and finish()
+/// terminates the response. Chunked responses may be produced incrementally by a producer, which
+/// is re-invoked by the connection whenever there is space in the output buffer, or when the
+/// application calls resume(), until the producer calls finish().
+///
+/// HTTP/1.0 clients do not understand chunked transfer encoding, so chunked responses to them are
+/// sent without framing, and delimited by closing the connection instead.
+///
+/// When compression is enabled, the body of a fixed-length response is compressed on commit() with
+/// the coding accepted by the client, provided that it meets the size threshold.
 class TOOLBOX_API OStream final : public std::ostream {
   public:
+    using Producer = BasicSlot<CyclTime, OStream&>;
+    using Resume = BasicSlot<CyclTime>;
+
     explicit OStream(Buffer& buf) noexcept
     : std::ostream{nullptr}
     , buf_{buf}
@@ -81,21 +110,75 @@ class TOOLBOX_API OStream final : public std::ostream {
     OStream(OStream&&) = delete;
     OStream& operator=(OStream&&) = delete;
 
+    /// Returns true if a chunked response has a producer that has yet to finish.
+    bool producing() const noexcept { return !producer_.empty(); }
+    /// Returns true if the connection must be closed to terminate the response.
+    bool close_delimited() const noexcept { return close_delimited_; }
+    const CompressOptions& compression() const noexcept { return copts_; }
+    ContentCoding coding() const noexcept { return coding_; }
+
+    void set_compression(const CompressOptions& opts) noexcept { copts_ = opts; }
+    /// Set to false if the client for the current request does not support chunked transfer
+    /// encoding.
+    void set_chunking(bool chunking) noexcept { chunking_ = chunking; }
+    /// Set the coding accepted by the client for the current request.
+    void set_coding(ContentCoding coding) noexcept { coding_ = coding; }
+
     void commit() noexcept;
     void reset() noexcept
     {
         buf_.reset();
         *this << reset_state;
         cloff_ = hcount_ = 0;
+        chunked_ = close_delimited_ = false;
+        producer_.reset();
     }
     void reset(Status status, const char* content_type, NoCache no_cache = NoCache::Yes);
+    /// Begin a response with chunked transfer encoding.
+    void reset_chunked(Status status, const char* content_type, NoCache no_cache = NoCache::Yes);
+    /// Begin a server-sent event stream.
+    void reset_event_stream() { reset_chunked(Status::Ok, TextEventStream); }
+    /// Write a server-sent event and commit it as a chunk. Each line of data is sent as a separate
+    /// data field.
+    void write_event(std::string_view data, std::string_view event = {}, std::string_view id = {});
+    /// Commit any pending chunk and terminate a chunked response.
+    void finish() noexcept;
+    /// Set the producer for a chunked response.
+    void set_producer(Producer producer) noexcept { producer_ = producer; }
+    /// Invoke the producer.
+    void produce(CyclTime now) { producer_(now, *this); }
+    /// Set by the connection to be notified when the application is ready to continue.
+    void set_resume(Resume resume) noexcept { resume_ = resume; }
+    /// Notify the connection, from the reactor thread, that the application has caught up with a
+    /// streamed request body, or that an idle producer has more to write. The connection then
+    /// offers the rest of the body, or invokes the producer, at the end of the current reactor
+    /// cycle.
+    void resume(CyclTime now)
+    {
+        if (resume_) {
+            resume_(now);
+        }
+    }
 
   private:
+    void begin_chunk() noexcept;
+    /// Compress the body of a fixed-length response in place.
+    void compress_body() noexcept;
+
     StreamBuf buf_;
     /// Content-Length offset.
     std::streamsize cloff_{0};
-    /// Header size.
+    /// Header size, or offset of the current chunk if chunked.
     std::streamsize hcount_{0};
+    bool chunked_{false};
+    bool chunking_{true};
+    bool close_delimited_{false};
+    Producer producer_;
+    Resume resume_;
+    CompressOptions copts_;
+    ContentCoding coding_{ContentCoding::Identity};
+    /// Scratch space for the compressed body.
+    std::string zbuf_;
 };
 
 } // namespace http
@@ -0,0 +1,186 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Stream.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+string_view to_string_view(const Buffer& buf)
+{
+    return {buffer_cast<const char*>(buf.data()), buffer_size(buf.data())};
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(StreamSuite)
+
+BOOST_AUTO_TEST_CASE(StreamFixedCase)
+{
+    Buffer buf;
+    http::OStream os{buf};
+    os.reset(Status::Ok, TextPlain);
+    os << "Hello, World!";
+    BOOST_TEST(buf.empty());
+    os.commit();
+    BOOST_TEST(to_string_view(buf)
+               == "HTTP/1.1 200 OK\r\n"
+                  "Cache-Control: no-cache\r\n"
+                  "Content-Type: text/plain\r\n"
+                  "Content-Length:         13\r\n"
+                  "\r\n"
+                  "Hello, World!"sv);
+}
+
+BOOST_AUTO_TEST_CASE(StreamCompressCase)
+{
+    Buffer buf;
+    http::OStream os{buf};
+    os.set_compression({.threshold = 64, .level = 6});
+    os.set_coding(ContentCoding::Gzip);
+
+    // Below the threshold.
+    os.reset(Status::Ok, TextPlain, NoCache::No);
+    os << "Hello, World!";
+    os.commit();
+    BOOST_TEST(to_string_view(buf)
+               == "HTTP/1.1 200 OK\r\n"
+                  "Content-Type: text/plain\r\n"
+                  "Vary: Accept-Encoding\r\n"
+                  "Content-Length:         13\r\n"
+                  "\r\n"
+                  "Hello, World!"sv);
+
+    buf.clear();
+    os.reset(Status::Ok, TextPlain, NoCache::No);
+    os << string(1000, 'x');
+    os.commit();
+    const auto out = to_string_view(buf);
+    const auto pos = out.find("\r\n\r\n") + 4;
+    BOOST_TEST(out.substr(0, pos)
+               == "HTTP/1.1 200 OK\r\n"
+                  "Content-Type: text/plain\r\n"
+                  "Vary: Accept-Encoding\r\n"
+                  "Content-Length:         " + to_string(out.size() - pos) + "\r\n"
+                  "Content-Encoding: gzip\r\n"
+                  "\r\n");
+    // Gzip magic.
+    BOOST_TEST(out.substr(pos, 2) == "\x1f\x8b"sv);
+}
+
+BOOST_AUTO_TEST_CASE(StreamChunkedCase)
+{
+    Buffer buf;
+    http::OStream os{buf};
+    os.reset_chunked(Status::Ok, TextPlain, NoCache::No);
+    // The head is sent with the first chunk.
+    BOOST_TEST(buf.empty());
+    os << "Hello, ";
+    os.commit();
+    // Empty chunks are not sent.
+    os.commit();
+    os << string(26, 'x');
+    os.commit();
+    BOOST_TEST(!os.producing());
+    os.finish();
+    BOOST_TEST(to_string_view(buf)
+               == "HTTP/1.1 200 OK\r\n"
+                  "Content-Type: text/plain\r\n"
+                  "Transfer-Encoding: chunked\r\n"
+                  "\r\n"
+                  "00000007\r\nHello, \r\n"
+                  "0000001a\r\nxxxxxxxxxxxxxxxxxxxxxxxxxx\r\n"
+                  "0\r\n\r\n"sv);
+}
+
+BOOST_AUTO_TEST_CASE(StreamEventCase)
+{
+    Buffer buf;
+    http::OStream os{buf};
+    os.reset_event_stream();
+    os.write_event("foo\nbar"sv, "update"sv, "1"sv);
+    os.write_event("baz"sv);
+    // CRLF and CR also terminate lines.
+    os.write_event("a\r\nb\rc"sv);
+    os.finish();
+    BOOST_TEST(to_string_view(buf)
+               == "HTTP/1.1 200 OK\r\n"
+                  "Cache-Control: no-cache\r\n"
+                  "Content-Type: text/event-stream\r\n"
+                  "Transfer-Encoding: chunked\r\n"
+                  "\r\n"
+                  "00000029\r\nid: 1\nevent: update\ndata: foo\ndata: bar\n\n\r\n"
+                  "0000000b\r\ndata: baz\n\n\r\n"
+                  "00000019\r\ndata: a\ndata: b\ndata: c\n\n\r\n"
+                  "0\r\n\r\n"sv);
+}
+
+BOOST_AUTO_TEST_CASE(StreamCloseDelimitedCase)
+{
+    Buffer buf;
+    http::OStream os{buf};
+    // HTTP/1.0 client.
+    os.set_chunking(false);
+    os.reset_chunked(Status::Ok, TextPlain, NoCache::No);
+    BOOST_TEST(os.close_delimited());
+    os << "Hello, ";
+    os.commit();
+    os << "World!";
+    os.finish();
+    BOOST_TEST(os.close_delimited());
+    BOOST_TEST(to_string_view(buf)
+               == "HTTP/1.1 200 OK\r\n"
+                  "Content-Type: text/plain\r\n"
+                  "Connection: close\r\n"
+                  "\r\n"
+                  "Hello, World!"sv);
+    // A fixed-length response is unaffected.
+    os.reset(Status::Ok, TextPlain);
+    BOOST_TEST(!os.close_delimited());
+}
+
+BOOST_AUTO_TEST_CASE(StreamProducerCase)
+{
+    struct Producer {
+        void operator()(CyclTime now, http::OStream& os)
+        {
+            os << count;
+            os.commit();
+            if (++count == 3) {
+                os.finish();
+            }
+        }
+        int count{0};
+    } producer;
+
+    Buffer buf;
+    http::OStream os{buf};
+    os.reset_chunked(Status::Ok, TextPlain, NoCache::No);
+    os.set_producer(bind(&producer));
+    while (os.producing()) {
+        os.produce(CyclTime::current());
+    }
+    BOOST_TEST(producer.count == 3);
+    BOOST_TEST(to_string_view(buf).ends_with("00000001\r\n0\r\n00000001\r\n1\r\n00000001\r\n2\r\n"
+                                             "0\r\n\r\n"sv));
+    // A new response clears the producer.
+    os.set_producer(bind(&producer));
+    os.reset(Status::Ok, TextPlain);
+    BOOST_TEST(!os.producing());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
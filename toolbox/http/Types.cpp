@@ -31,5 +31,156 @@ const char* enum_string(Status status) noexcept
     std::terminate();
 }
 
+const char* enum_string(Header header) noexcept
+{
+    switch (header) {
+    case Header::Accept:
+        return "Accept";
+    case Header::AcceptEncoding:
+        return "Accept-Encoding";
+    case Header::AcceptLanguage:
+        return "Accept-Language";
+    case Header::Authorization:
+        return "Authorization";
+    case Header::CacheControl:
+        return "Cache-Control";
+    case Header::Connection:
+        return "Connection";
+    case Header::ContentEncoding:
+        return "Content-Encoding";
+    case Header::ContentLength:
+        return "Content-Length";
+    case Header::ContentType:
+        return "Content-Type";
+    case Header::Cookie:
+        return "Cookie";
+    case Header::Host:
+        return "Host";
+    case Header::IfModifiedSince:
+        return "If-Modified-Since";
+    case Header::IfNoneMatch:
+        return "If-None-Match";
+    case Header::Origin:
+        return "Origin";
+    case Header::Referer:
+        return "Referer";
+    case Header::SecWebSocketKey:
+        return "Sec-WebSocket-Key";
+    case Header::SecWebSocketProtocol:
+        return "Sec-WebSocket-Protocol";
+    case Header::SecWebSocketVersion:
+        return "Sec-WebSocket-Version";
+    case Header::TransferEncoding:
+        return "Transfer-Encoding";
+    case Header::Upgrade:
+        return "Upgrade";
+    case Header::UserAgent:
+        return "User-Agent";
+    case Header::XForwardedFor:
+        return "X-Forwarded-For";
+    case Header::Other:
+        return "Other";
+    }
+    std::terminate();
+}
+
+Header get_header(std::string_view name) noexcept
+{
+    // Dispatch on length first so that at most a few comparisons are required.
+    switch (name.size()) {
+    case 4:
+        if (iequals(name, "host")) {
+            return Header::Host;
+        }
+        break;
+    case 6:
+        if (iequals(name, "accept")) {
+            return Header::Accept;
+        }
+        if (iequals(name, "cookie")) {
+            return Header::Cookie;
+        }
+        if (iequals(name, "origin")) {
+            return Header::Origin;
+        }
+        break;
+    case 7:
+        if (iequals(name, "upgrade")) {
+            return Header::Upgrade;
+        }
+        if (iequals(name, "referer")) {
+            return Header::Referer;
+        }
+        break;
+    case 10:
+        if (iequals(name, "connection")) {
+            return Header::Connection;
+        }
+        if (iequals(name, "user-agent")) {
+            return Header::UserAgent;
+        }
+        break;
+    case 12:
+        if (iequals(name, "content-type")) {
+            return Header::ContentType;
+        }
+        break;
+    case 13:
+        if (iequals(name, "authorization")) {
+            return Header::Authorization;
+        }
+        if (iequals(name, "cache-control")) {
+            return Header::CacheControl;
+        }
+        if (iequals(name, "if-none-match")) {
+            return Header::IfNoneMatch;
+        }
+        break;
+    case 14:
+        if (iequals(name, "content-length")) {
+            return Header::ContentLength;
+        }
+        break;
+    case 15:
+        if (iequals(name, "accept-encoding")) {
+            return Header::AcceptEncoding;
+        }
+        if (iequals(name, "accept-language")) {
+            return Header::AcceptLanguage;
+        }
+        if (iequals(name, "x-forwarded-for")) {
+            return Header::XForwardedFor;
+        }
+        break;
+    case 16:
+        if (iequals(name, "content-encoding")) {
+            return Header::ContentEncoding;
+        }
+        break;
+    case 17:
+        if (iequals(name, "if-modified-since")) {
+            return Header::IfModifiedSince;
+        }
+        if (iequals(name, "sec-websocket-key")) {
+            return Header::SecWebSocketKey;
+        }
+        if (iequals(name, "transfer-encoding")) {
+            return Header::TransferEncoding;
+        }
+        break;
+    case 21:
+        if (iequals(name, "sec-websocket-version")) {
+            return Header::SecWebSocketVersion;
+        }
+        break;
+    case 22:
+        if (iequals(name, "sec-websocket-protocol")) {
+            return Header::SecWebSocketProtocol;
+        }
+        break;
+    }
+    return Header::Other;
+}
+
 } // namespace http
 } // namespace toolbox
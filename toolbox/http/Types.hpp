@@ -18,8 +18,10 @@
 #define TOOLBOX_HTTP_TYPES_HPP
 
 #include <toolbox/contrib/http_parser.h>
+#include <toolbox/util/String.hpp>
 
 #include <iostream>
+#include <string_view>
 
 namespace toolbox {
 inline namespace http {
@@ -84,6 +86,7 @@ enum class Status : int {
     NotFound = HTTP_STATUS_NOT_FOUND,
     MethodNotAllowed = HTTP_STATUS_METHOD_NOT_ALLOWED,
     RequestTimeout = HTTP_STATUS_REQUEST_TIMEOUT,
+    TooManyRequests = HTTP_STATUS_TOO_MANY_REQUESTS,
     InternalServerError = HTTP_STATUS_INTERNAL_SERVER_ERROR,
     ServiceUnavailable = HTTP_STATUS_SERVICE_UNAVAILABLE
 };
@@ -97,6 +100,74 @@ inline std::ostream& operator<<(std::ostream& os, Status status)
 
 enum class Type : int { Request = HTTP_REQUEST, Response = HTTP_RESPONSE };
 
+/// Well-known header fields, which are resolved to an index slot when a request is flushed.
+enum class Header : int {
+    Accept,
+    AcceptEncoding,
+    AcceptLanguage,
+    Authorization,
+    CacheControl,
+    Connection,
+    ContentEncoding,
+    ContentLength,
+    ContentType,
+    Cookie,
+    Host,
+    IfModifiedSince,
+    IfNoneMatch,
+    Origin,
+    Referer,
+    SecWebSocketKey,
+    SecWebSocketProtocol,
+    SecWebSocketVersion,
+    TransferEncoding,
+    Upgrade,
+    UserAgent,
+    XForwardedFor,
+    /// Any other header field.
+    Other
+};
+
+/// Number of well-known header fields.
+constexpr std::size_t HeaderCount{static_cast<std::size_t>(Header::Other)};
+
+TOOLBOX_API const char* enum_string(Header header) noexcept;
+
+inline std::ostream& operator<<(std::ostream& os, Header header)
+{
+    return os << enum_string(header);
+}
+
+/// Returns the well-known header with the given case-insensitive name, or Header::Other if the
+/// name is not well-known.
+TOOLBOX_API Header get_header(std::string_view name) noexcept;
+
+/// Calls fn with each trimmed element of a comma-separated header field value.
+template <typename FnT>
+void for_each_token(std::string_view sv, FnT fn)
+{
+    while (!sv.empty()) {
+        const auto pos = sv.find(',');
+        fn(trim_ows(sv.substr(0, pos)));
+        if (pos == std::string_view::npos) {
+            break;
+        }
+        sv.remove_prefix(pos + 1);
+    }
+}
+
+/// Returns true if a comma-separated header field value contains the token, ignoring case.
+inline bool has_token(std::string_view sv, std::string_view token) noexcept
+{
+    bool found{false};
+    for_each_token(sv, [&found, token](std::string_view tok) {
+        if (iequals(tok, token)) {
+            found = true;
+        }
+    });
+    return found;
+}
+
 } // namespace http
 } // namespace toolbox
 
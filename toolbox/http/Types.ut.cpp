@@ -34,4 +34,28 @@ BOOST_AUTO_TEST_CASE(TypesCase)
     BOOST_TEST(enum_string(Status::ServiceUnavailable) == "Service Unavailable");
 }
 
+BOOST_AUTO_TEST_CASE(HeaderCase)
+{
+    for (size_t i{0}; i < HeaderCount; ++i) {
+        const auto header = static_cast<Header>(i);
+        BOOST_TEST(get_header(enum_string(header)) == header);
+    }
+    BOOST_TEST(get_header("content-TYPE"sv) == Header::ContentType);
+    BOOST_TEST(get_header("X-Request-Id"sv) == Header::Other);
+    BOOST_TEST(get_header(""sv) == Header::Other);
+}
+
+BOOST_AUTO_TEST_CASE(TokenCase)
+{
+    string toks;
+    for_each_token("a, b ,,c"sv, [&toks](string_view tok) {
+        toks += tok;
+        toks += '|';
+    });
+    BOOST_TEST(toks == "a|b||c|");
+    BOOST_TEST(has_token("keep-alive, Upgrade"sv, "upgrade"sv));
+    BOOST_TEST(!has_token("keep-alive, Upgraded"sv, "upgrade"sv));
+    BOOST_TEST(!has_token(""sv, "upgrade"sv));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -15,3 +15,154 @@
 // limitations under the License.
 
 #include "Url.hpp"
+
+#include <bit>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace toolbox {
+inline namespace http {
+using namespace std;
+namespace {
+
+constexpr bool is_special(char c) noexcept
+{
+    return c == '&' || c == '=' || c == '%' || c == '+';
+}
+
+/// Returns the first '&', '=', '%' or '+' in the range, or last if there is none.
+const char* find_special(const char* it, const char* last) noexcept
+{
+#if defined(__SSE2__)
+    const auto amp = _mm_set1_epi8('&');
+    const auto eq = _mm_set1_epi8('=');
+    const auto pct = _mm_set1_epi8('%');
+    const auto plus = _mm_set1_epi8('+');
+    for (; last - it >= 16; it += 16) {
+        const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+        const auto m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, amp), _mm_cmpeq_epi8(v, eq)),
+                                    _mm_or_si128(_mm_cmpeq_epi8(v, pct), _mm_cmpeq_epi8(v, plus)));
+        if (const auto mask = static_cast<unsigned>(_mm_movemask_epi8(m)); mask != 0) {
+            return it + countr_zero(mask);
+        }
+    }
+#endif
+    for (; it != last; ++it) {
+        if (is_special(*it)) {
+            break;
+        }
+    }
+    return it;
+}
+
+constexpr int hex_digit(char c) noexcept
+{
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+/// Decode the character at the front of the encoded string, and advance past it.
+char decode_char(const char*& it, const char* last) noexcept
+{
+    const char c{*it++};
+    if (c == '+') {
+        return ' ';
+    }
+    if (c == '%' && last - it >= 2) {
+        const int hi{hex_digit(it[0])}, lo{hex_digit(it[1])};
+        if (hi >= 0 && lo >= 0) {
+            it += 2;
+            return static_cast<char>((hi << 4) | lo);
+        }
+    }
+    return c;
+}
+
+} // namespace
+
+bool next_query_param(string_view& query, QueryParam& param) noexcept
+{
+    const char* it{query.data()};
+    const char* const last{it + query.size()};
+    while (it != last && *it == '&') {
+        ++it;
+    }
+    if (it == last) {
+        query = {};
+        return false;
+    }
+    const char* const first{it};
+    const char* eq{nullptr};
+    bool key_escaped{false}, value_escaped{false};
+    // A single pass over the parameter finds the separators and any escapes.
+    for (; (it = find_special(it, last)) != last && *it != '&'; ++it) {
+        if (*it == '=') {
+            // Subsequent '=' characters are part of the value.
+            if (!eq) {
+                eq = it;
+            }
+        } else if (eq) {
+            value_escaped = true;
+        } else {
+            key_escaped = true;
+        }
+    }
+    if (eq) {
+        param.key = {first, static_cast<size_t>(eq - first)};
+        param.value = {eq + 1, static_cast<size_t>(it - eq - 1)};
+    } else {
+        param.key = {first, static_cast<size_t>(it - first)};
+        // An empty value that still points into the query string, so that iterators compare
+        // unequal to the end iterator.
+        param.value = {it, 0};
+    }
+    param.key_escaped = key_escaped;
+    param.value_escaped = value_escaped;
+    query = it != last ? string_view{it + 1, static_cast<size_t>(last - it - 1)} : string_view{};
+    return true;
+}
+
+string_view url_decode(string_view sv, char* buf) noexcept
+{
+    const char* it{sv.data()};
+    const char* const last{it + sv.size()};
+    // Find the first escape, skipping any '&' or '=' characters.
+    for (; (it = find_special(it, last)) != last && *it != '%' && *it != '+'; ++it) {
+    }
+    if (it == last) {
+        return sv;
+    }
+    const auto prefix = static_cast<size_t>(it - sv.data());
+    memcpy(buf, sv.data(), prefix);
+    char* out{buf + prefix};
+    while (it != last) {
+        *out++ = decode_char(it, last);
+    }
+    return {buf, static_cast<size_t>(out - buf)};
+}
+
+bool url_decoded_equal(string_view encoded, string_view decoded) noexcept
+{
+    const char* it{encoded.data()};
+    const char* const last{it + encoded.size()};
+    for (const char c : decoded) {
+        if (it == last || decode_char(it, last) != c) {
+            return false;
+        }
+    }
+    return it == last;
+}
+
+} // namespace http
+} // namespace toolbox
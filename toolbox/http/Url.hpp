@@ -21,9 +21,114 @@
 
 #include <toolbox/contrib/http_parser.h>
 
+#include <iterator>
+#include <string>
+
 namespace toolbox {
 inline namespace http {
 
+/// QueryParam is a single key/value pair whose key and value are views into the raw query string.
+/// The key and value are percent-encoded, and the flags indicate whether either needs decoding.
+struct QueryParam {
+    std::string_view key, value;
+    /// True if the key or value contains a percent-encoded octet or a '+'.
+    bool key_escaped{false}, value_escaped{false};
+};
+
+/// Split the next parameter from the front of the query string, and advance the query string past
+/// it. Empty parameters are skipped. Returns false if there are no more parameters.
+TOOLBOX_API bool next_query_param(std::string_view& query, QueryParam& param) noexcept;
+
+/// Percent-decode the string, where '+' is decoded as a space. The string is returned unchanged,
+/// without a copy, if it contains no escapes. Otherwise, it is decoded into the buffer, which must
+/// be at least as large as the string. Malformed escapes are copied verbatim.
+TOOLBOX_API std::string_view url_decode(std::string_view sv, char* buf) noexcept;
+
+/// Percent-decode the string into the buffer, which is resized as required, only if the string
+/// contains escapes.
+inline std::string_view url_decode(std::string_view sv, std::string& buf)
+{
+    if (buf.size() < sv.size()) {
+        buf.resize(sv.size());
+    }
+    return url_decode(sv, buf.data());
+}
+
+/// Returns true if the percent-encoded string is equal to the decoded string. No buffer is
+/// required.
+TOOLBOX_API bool url_decoded_equal(std::string_view encoded, std::string_view decoded) noexcept;
+
+/// QueryIterator is a forward iterator over the parameters of a query string. It does not
+/// allocate.
+class QueryIterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = QueryParam;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const QueryParam*;
+    using reference = const QueryParam&;
+
+    QueryIterator() noexcept = default;
+    explicit QueryIterator(std::string_view query) noexcept
+    : rest_{query}
+    {
+        ++*this;
+    }
+
+    reference operator*() const noexcept { return param_; }
+    pointer operator->() const noexcept { return &param_; }
+    QueryIterator& operator++() noexcept
+    {
+        if (!next_query_param(rest_, param_)) {
+            *this = {};
+        }
+        return *this;
+    }
+    QueryIterator operator++(int) noexcept
+    {
+        auto it = *this;
+        ++*this;
+        return it;
+    }
+    bool operator==(const QueryIterator& rhs) const noexcept
+    {
+        return param_.key.data() == rhs.param_.key.data()
+            && param_.value.data() == rhs.param_.value.data();
+    }
+
+  private:
+    std::string_view rest_;
+    QueryParam param_;
+};
+
+/// QueryParams is a range over the parameters of a query string.
+class QueryParams {
+  public:
+    explicit QueryParams(std::string_view query) noexcept
+    : query_{query}
+    {
+    }
+
+    QueryIterator begin() const noexcept { return QueryIterator{query_}; }
+    QueryIterator end() const noexcept { return {}; }
+
+    /// Returns an iterator to the first parameter whose decoded key is equal to the name, or end()
+    /// if absent.
+    QueryIterator find(std::string_view name) const noexcept
+    {
+        auto it = begin();
+        for (; it != end(); ++it) {
+            if (it->key_escaped ? url_decoded_equal(it->key, name) : it->key == name) {
+                break;
+            }
+        }
+        return it;
+    }
+
+  private:
+    std::string_view query_;
+};
+
 template <typename DerivedT>
 class BasicUrl {
   public:
@@ -62,6 +167,33 @@ class BasicUrl {
         const auto& field = parser_.field_data[UF_QUERY];
         return url().substr(field.off, field.len);
     }
+    /// Returns a range over the query parameters.
+    QueryParams query_params() const noexcept { return QueryParams{query()}; }
+    /// Returns true if the query has a parameter with the given name.
+    bool has_query_param(std::string_view name) const noexcept
+    {
+        const QueryParams params{query()};
+        return params.find(name) != params.end();
+    }
+    /// Returns the raw value of the first query parameter with the given name, or an empty view if
+    /// absent.
+    std::string_view query_param(std::string_view name) const noexcept
+    {
+        const QueryParams params{query()};
+        const auto it = params.find(name);
+        return it != params.end() ? it->value : std::string_view{};
+    }
+    /// Returns the decoded value of the first query parameter with the given name, or an empty
+    /// view if absent. The buffer is only used if the value contains escapes.
+    std::string_view query_param(std::string_view name, std::string& buf) const
+    {
+        const QueryParams params{query()};
+        const auto it = params.find(name);
+        if (it == params.end()) {
+            return {};
+        }
+        return it->value_escaped ? url_decode(it->value, buf) : it->value;
+    }
     auto fragment() const noexcept
     {
         const auto& field = parser_.field_data[UF_FRAGMENT];
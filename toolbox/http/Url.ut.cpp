@@ -50,4 +50,51 @@ BOOST_AUTO_TEST_CASE(UrlViewCase)
     BOOST_TEST(url.user_info().empty());
 }
 
+BOOST_AUTO_TEST_CASE(QueryParamsCase)
+{
+    UrlView url{"/api?a=1&&b=x%20y&c&d=e=f&%61+b=2&=z"sv};
+    vector<pair<string_view, string_view>> params;
+    for (const auto& param : url.query_params()) {
+        params.emplace_back(param.key, param.value);
+    }
+    const vector<pair<string_view, string_view>> expected{
+        {"a"sv, "1"sv}, {"b"sv, "x%20y"sv}, {"c"sv, ""sv},
+        {"d"sv, "e=f"sv}, {"%61+b"sv, "2"sv}, {""sv, "z"sv}};
+    BOOST_TEST((params == expected));
+
+    string buf;
+    BOOST_TEST(url.query_param("a") == "1"sv);
+    BOOST_TEST(url.query_param("b") == "x%20y"sv);
+    BOOST_TEST(url.query_param("b", buf) == "x y"sv);
+    BOOST_TEST(url.has_query_param("c"));
+    BOOST_TEST(url.query_param("c").empty());
+    BOOST_TEST(url.query_param("d") == "e=f"sv);
+    // Keys are compared after decoding.
+    BOOST_TEST(url.query_param("a b") == "2"sv);
+    BOOST_TEST(!url.has_query_param("e"));
+    BOOST_TEST(url.query_param("e", buf).empty());
+
+    // A long query exercises the vectorised scan.
+    const string query{"long=" + string(100, 'x') + "&key=" + string(40, 'y') + "%2B"};
+    BOOST_TEST(UrlView{"/?" + query}.query_param("key", buf) == string(40, 'y') + '+');
+}
+
+BOOST_AUTO_TEST_CASE(UrlDecodeCase)
+{
+    char buf[64];
+    // No escapes, so the input is returned without a copy.
+    const auto sv = "abc=def&ghi"sv;
+    BOOST_TEST(url_decode(sv, buf).data() == sv.data());
+
+    BOOST_TEST(url_decode("a+b%2Fc%2f"sv, buf) == "a b/c/"sv);
+    // Malformed escapes are copied verbatim.
+    BOOST_TEST(url_decode("100%"sv, buf) == "100%"sv);
+    BOOST_TEST(url_decode("%zz%4"sv, buf) == "%zz%4"sv);
+
+    BOOST_TEST(url_decoded_equal("a%20b"sv, "a b"sv));
+    BOOST_TEST(url_decoded_equal("a+b"sv, "a b"sv));
+    BOOST_TEST(!url_decoded_equal("a%20b"sv, "a b "sv));
+    BOOST_TEST(!url_decoded_equal("a%20bc"sv, "a b"sv));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
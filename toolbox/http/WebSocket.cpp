@@ -0,0 +1,264 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "WebSocket.hpp"
+
+#include <toolbox/http/Exception.hpp>
+#include <toolbox/http/Request.hpp>
+#include <toolbox/util/Base64.hpp>
+
+#include <array>
+#include <bit>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace toolbox {
+inline namespace http {
+using namespace std;
+namespace {
+
+static_assert(endian::native == endian::little);
+
+/// GUID appended to the client's key by RFC 6455.
+constexpr auto WsGuid = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"sv;
+
+/// SHA-1 as specified by RFC 3174. It is only used to derive the handshake's accept key, which is
+/// not a security property, so a small local implementation avoids a dependency on a crypto
+/// library.
+class Sha1 {
+  public:
+    void update(string_view data) noexcept
+    {
+        len_ += data.size();
+        while (!data.empty()) {
+            const auto n = min(data.size(), sizeof(block_) - pos_);
+            memcpy(block_ + pos_, data.data(), n);
+            pos_ += n;
+            data.remove_prefix(n);
+            if (pos_ == sizeof(block_)) {
+                transform();
+                pos_ = 0;
+            }
+        }
+    }
+    array<unsigned char, 20> finish() noexcept
+    {
+        const uint64_t bits{len_ * 8};
+        // Pad with a one bit, then zeros, leaving room for the 64-bit big-endian length.
+        block_[pos_++] = 0x80;
+        if (pos_ > 56) {
+            memset(block_ + pos_, 0, sizeof(block_) - pos_);
+            transform();
+            pos_ = 0;
+        }
+        memset(block_ + pos_, 0, 56 - pos_);
+        const auto be_bits = __builtin_bswap64(bits);
+        memcpy(block_ + 56, &be_bits, sizeof(be_bits));
+        transform();
+        array<unsigned char, 20> digest;
+        for (int i{0}; i < 5; ++i) {
+            const auto n = __builtin_bswap32(h_[i]);
+            memcpy(digest.data() + i * 4, &n, sizeof(n));
+        }
+        return digest;
+    }
+
+  private:
+    void transform() noexcept
+    {
+        uint32_t w[80];
+        for (int i{0}; i < 16; ++i) {
+            uint32_t n;
+            memcpy(&n, block_ + i * 4, sizeof(n));
+            w[i] = __builtin_bswap32(n);
+        }
+        for (int i{16}; i < 80; ++i) {
+            w[i] = rotl(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+        }
+        auto a = h_[0], b = h_[1], c = h_[2], d = h_[3], e = h_[4];
+        for (int i{0}; i < 80; ++i) {
+            uint32_t f, k;
+            if (i < 20) {
+                f = (b & c) | (~b & d);
+                k = 0x5a827999;
+            } else if (i < 40) {
+                f = b ^ c ^ d;
+                k = 0x6ed9eba1;
+            } else if (i < 60) {
+                f = (b & c) | (b & d) | (c & d);
+                k = 0x8f1bbcdc;
+            } else {
+                f = b ^ c ^ d;
+                k = 0xca62c1d6;
+            }
+            const auto t = rotl(a, 5) + f + e + k + w[i];
+            e = d;
+            d = c;
+            c = rotl(b, 30);
+            b = a;
+            a = t;
+        }
+        h_[0] += a;
+        h_[1] += b;
+        h_[2] += c;
+        h_[3] += d;
+        h_[4] += e;
+    }
+
+    uint32_t h_[5]{0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0};
+    unsigned char block_[64];
+    size_t pos_{0};
+    uint64_t len_{0};
+};
+
+} // namespace
+
+size_t parse_ws_header(string_view buf, WsFrameHeader& hdr)
+{
+    if (buf.size() < 2) {
+        return 0;
+    }
+    const auto b0 = static_cast<uint8_t>(buf[0]);
+    const auto b1 = static_cast<uint8_t>(buf[1]);
+    if ((b0 & 0x70) != 0) {
+        // No extensions are negotiated, so the reserved bits must be clear.
+        throw Exception{Status::BadRequest, "reserved bits set in websocket frame"};
+    }
+    hdr.fin = (b0 & 0x80) != 0;
+    hdr.opcode = static_cast<WsOpcode>(b0 & 0x0f);
+    hdr.masked = (b1 & 0x80) != 0;
+    size_t pos{2};
+    uint64_t len{b1 & 0x7fU};
+    if (len == 126) {
+        if (buf.size() < pos + 2) {
+            return 0;
+        }
+        uint16_t n;
+        memcpy(&n, buf.data() + pos, sizeof(n));
+        len = __builtin_bswap16(n);
+        pos += 2;
+    } else if (len == 127) {
+        if (buf.size() < pos + 8) {
+            return 0;
+        }
+        uint64_t n;
+        memcpy(&n, buf.data() + pos, sizeof(n));
+        len = __builtin_bswap64(n);
+        if (len >> 63) {
+            throw Exception{Status::BadRequest, "invalid websocket payload length"};
+        }
+        pos += 8;
+    }
+    hdr.payload_len = len;
+    if (hdr.masked) {
+        if (buf.size() < pos + 4) {
+            return 0;
+        }
+        memcpy(&hdr.mask, buf.data() + pos, sizeof(hdr.mask));
+        pos += 4;
+    } else {
+        hdr.mask = 0;
+    }
+    return pos;
+}
+
+size_t put_ws_header(char* buf, bool fin, WsOpcode opcode, uint64_t payload_len) noexcept
+{
+    buf[0] = static_cast<char>((fin ? 0x80 : 0x00) | static_cast<uint8_t>(opcode));
+    if (payload_len < 126) {
+        buf[1] = static_cast<char>(payload_len);
+        return 2;
+    }
+    if (payload_len <= 0xffff) {
+        buf[1] = 126;
+        const uint16_t n{__builtin_bswap16(static_cast<uint16_t>(payload_len))};
+        memcpy(buf + 2, &n, sizeof(n));
+        return 4;
+    }
+    buf[1] = 127;
+    const uint64_t n{__builtin_bswap64(payload_len)};
+    memcpy(buf + 2, &n, sizeof(n));
+    return 10;
+}
+
+SharedBufferPtr make_ws_frame(WsOpcode opcode, string_view payload)
+{
+    string frame;
+    frame.resize(MaxWsHeaderSize + payload.size());
+    const auto hdr_size = put_ws_header(frame.data(), true, opcode, payload.size());
+    memcpy(frame.data() + hdr_size, payload.data(), payload.size());
+    frame.resize(hdr_size + payload.size());
+    return make_shared_buffer(std::move(frame));
+}
+
+void ws_unmask(char* data, size_t len, uint32_t mask, size_t offset) noexcept
+{
+    // Align the key with the start of the data.
+    mask = rotr(mask, static_cast<int>(offset % 4) * 8);
+    auto* it = data;
+    auto* const end = data + len;
+#if defined(__AVX2__)
+    const auto m32 = _mm256_set1_epi32(static_cast<int>(mask));
+    for (; end - it >= 32; it += 32) {
+        const auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(it), _mm256_xor_si256(v, m32));
+    }
+#endif
+#if defined(__SSE2__)
+    const auto m16 = _mm_set1_epi32(static_cast<int>(mask));
+    for (; end - it >= 16; it += 16) {
+        const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(it), _mm_xor_si128(v, m16));
+    }
+#endif
+    const uint64_t m8{(uint64_t{mask} << 32) | mask};
+    for (; end - it >= 8; it += 8) {
+        uint64_t v;
+        memcpy(&v, it, sizeof(v));
+        v ^= m8;
+        memcpy(it, &v, sizeof(v));
+    }
+    // Each block above is a multiple of four bytes, so the key is still aligned. The tail may be
+    // up to seven bytes, so the key is rotated rather than shifted past its width.
+    for (; it != end; ++it) {
+        *it ^= static_cast<char>(mask);
+        mask = rotr(mask, 8);
+    }
+}
+
+string ws_accept_key(string_view key)
+{
+    Sha1 sha1;
+    sha1.update(key);
+    sha1.update(WsGuid);
+    const auto digest = sha1.finish();
+    return base64_encode({reinterpret_cast<const char*>(digest.data()), digest.size()});
+}
+
+bool is_ws_upgrade(const Request& req) noexcept
+{
+    return req.method() == Method::Get && has_token(req.header(Header::Upgrade), "websocket")
+        && has_token(req.header(Header::Connection), "upgrade")
+        && !req.header(Header::SecWebSocketKey).empty()
+        && req.header(Header::SecWebSocketVersion) == "13";
+}
+
+} // namespace http
+} // namespace toolbox
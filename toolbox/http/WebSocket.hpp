@@ -0,0 +1,96 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_HTTP_WEBSOCKET_HPP
+#define TOOLBOX_HTTP_WEBSOCKET_HPP
+
+#include <toolbox/http/Types.hpp>
+#include <toolbox/io/SharedBuffer.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace toolbox {
+inline namespace http {
+class Request;
+
+enum class WsOpcode : std::uint8_t {
+    Continuation = 0x0,
+    Text = 0x1,
+    Binary = 0x2,
+    Close = 0x8,
+    Ping = 0x9,
+    Pong = 0xa
+};
+
+/// Returns true for Close, Ping and Pong frames.
+constexpr bool is_control(WsOpcode opcode) noexcept
+{
+    return (static_cast<std::uint8_t>(opcode) & 0x8) != 0;
+}
+
+/// Close status codes from RFC 6455.
+enum class WsClose : std::uint16_t {
+    Normal = 1000,
+    GoingAway = 1001,
+    ProtocolError = 1002,
+    UnsupportedData = 1003,
+    InvalidPayload = 1007,
+    PolicyViolation = 1008,
+    MessageTooBig = 1009,
+    InternalError = 1011
+};
+
+/// Maximum size of a frame header, which is two bytes, an eight byte extended length and a four
+/// byte masking key.
+constexpr std::size_t MaxWsHeaderSize{14};
+
+struct WsFrameHeader {
+    bool fin{false};
+    WsOpcode opcode{WsOpcode::Continuation};
+    bool masked{false};
+    std::uint32_t mask{0};
+    std::uint64_t payload_len{0};
+};
+
+/// Parse a frame header from the front of the buffer. Returns the size of the header, or zero if
+/// the header is incomplete.
+/// \throws Exception if the header is malformed.
+TOOLBOX_API std::size_t parse_ws_header(std::string_view buf, WsFrameHeader& hdr);
+
+/// Write an unmasked frame header, as sent by a server, to the buffer, which must be at least
+/// MaxWsHeaderSize bytes. Returns the size of the header.
+TOOLBOX_API std::size_t put_ws_header(char* buf, bool fin, WsOpcode opcode,
+                                      std::uint64_t payload_len) noexcept;
+
+/// Returns an unfragmented, unmasked frame that can be queued on many connections.
+TOOLBOX_API SharedBufferPtr make_ws_frame(WsOpcode opcode, std::string_view payload);
+
+/// Apply the masking key in place. The key is in network byte order as it appears on the wire,
+/// and offset is the position of data within the payload, which allows a payload to be unmasked
+/// in fragments. SIMD is used where available.
+TOOLBOX_API void ws_unmask(char* data, std::size_t len, std::uint32_t mask,
+                           std::size_t offset = 0) noexcept;
+
+/// Returns the Sec-WebSocket-Accept value for the client's Sec-WebSocket-Key.
+TOOLBOX_API std::string ws_accept_key(std::string_view key);
+
+/// Returns true if the request is a valid WebSocket opening handshake.
+TOOLBOX_API bool is_ws_upgrade(const Request& req) noexcept;
+
+} // namespace http
+} // namespace toolbox
+
+#endif // TOOLBOX_HTTP_WEBSOCKET_HPP
@@ -0,0 +1,317 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "WebSocket.hpp"
+
+#include <toolbox/http/Admission.hpp>
+#include <toolbox/http/App.hpp>
+#include <toolbox/http/Exception.hpp>
+#include <toolbox/http/Serv.hpp>
+#include <toolbox/http/WsApp.hpp>
+#include <toolbox/net/StreamSock.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstring>
+
+#include <unistd.h>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+class TestWsApp final : public WsApp {
+  public:
+    vector<string> messages;
+    int closed{0};
+
+  protected:
+    void do_on_ws_message(CyclTime now, WsConn& conn, WsOpcode opcode, string_view data) override
+    {
+        messages.emplace_back(data);
+        conn.send(now, opcode, data);
+    }
+    void do_on_ws_close(CyclTime now, WsConn& conn) noexcept override { ++closed; }
+};
+
+class TestApp final : public App {
+  public:
+    explicit TestApp(WsApp& ws_app) { set_ws_app(&ws_app); }
+
+  protected:
+    void do_on_http_connect(CyclTime now, const Endpoint& ep) override {}
+    void do_on_http_disconnect(CyclTime now, const Endpoint& ep) noexcept override {}
+    void do_on_http_error(CyclTime now, const Endpoint& ep, const std::exception& e,
+                          http::OStream& os) noexcept override
+    {
+    }
+    void do_on_http_message(CyclTime now, const Endpoint& ep, const Request& req,
+                            http::OStream& os) override
+    {
+        os.reset(Status::Ok, "text/plain");
+        os << "plain";
+        os.commit();
+    }
+    void do_on_http_timeout(CyclTime now, const Endpoint& ep) noexcept override {}
+};
+
+/// Returns a masked frame, as sent by a client.
+string make_frame(bool fin, WsOpcode opcode, string_view payload)
+{
+    constexpr char Key[] = {'\x12', '\x34', '\x56', '\x78'};
+    char buf[MaxWsHeaderSize];
+    auto n = put_ws_header(buf, fin, opcode, payload.size());
+    buf[1] |= '\x80';
+    string frame{buf, n};
+    frame.append(Key, sizeof(Key));
+    for (size_t i{0}; i < payload.size(); ++i) {
+        frame += static_cast<char>(payload[i] ^ Key[i % 4]);
+    }
+    return frame;
+}
+
+struct Fixture {
+    Fixture() { unlink(path.c_str()); }
+    ~Fixture() { unlink(path.c_str()); }
+    /// Poll the reactor until the client has received the expected number of bytes or a second
+    /// has elapsed.
+    string recv(StreamSockClnt& sock, size_t size)
+    {
+        string out;
+        const auto end = MonoClock::now() + 1s;
+        while (out.size() < size && MonoClock::now() < end) {
+            reactor.poll(CyclTime::now(), 10ms);
+            char buf[1024];
+            error_code ec;
+            const auto n = sock.recv(buf, sizeof(buf), MSG_DONTWAIT, ec);
+            if (n > 0) {
+                out.append(buf, n);
+            }
+        }
+        return out;
+    }
+    const string path{"/tmp/tb-http-ws-"s + to_string(getpid()) + ".sock"};
+    const StreamEndpoint ep{parse_stream_endpoint("unix://" + path)};
+    Reactor reactor{1024};
+    TestWsApp ws_app;
+    TestApp app{ws_app};
+};
+
+constexpr auto Handshake = "GET /ws HTTP/1.1\r\n"
+                           "Host: localhost\r\n"
+                           "Upgrade: websocket\r\n"
+                           "Connection: Upgrade\r\n"
+                           "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+                           "Sec-WebSocket-Version: 13\r\n"
+                           "\r\n"sv;
+
+constexpr auto HandshakeResponse = "HTTP/1.1 101 Switching Protocols\r\n"
+                                   "Upgrade: websocket\r\n"
+                                   "Connection: Upgrade\r\n"
+                                   "Sec-WebSocket-Accept: s3pPLMBiTxaQ9kYGzzhZRbK+xOo=\r\n"
+                                   "\r\n"sv;
+
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(WebSocketSuite, Fixture)
+
+BOOST_AUTO_TEST_CASE(WsHeaderCase)
+{
+    char buf[MaxWsHeaderSize];
+    WsFrameHeader hdr;
+
+    for (const uint64_t len : {0UL, 125UL, 126UL, 65535UL, 65536UL, 1UL << 40}) {
+        const auto n = put_ws_header(buf, true, WsOpcode::Binary, len);
+        BOOST_TEST(n == (len < 126 ? 2U : len <= 65535 ? 4U : 10U));
+        BOOST_TEST(parse_ws_header({buf, n}, hdr) == n);
+        BOOST_TEST(hdr.fin);
+        BOOST_TEST((hdr.opcode == WsOpcode::Binary));
+        BOOST_TEST(!hdr.masked);
+        BOOST_TEST(hdr.payload_len == len);
+        // Incomplete.
+        BOOST_TEST(parse_ws_header({buf, n - 1}, hdr) == 0U);
+    }
+
+    const auto frame = make_frame(false, WsOpcode::Text, "hello");
+    BOOST_TEST(parse_ws_header(frame, hdr) == 6U);
+    BOOST_TEST(!hdr.fin);
+    BOOST_TEST(hdr.masked);
+    BOOST_TEST(hdr.payload_len == 5U);
+
+    // Reserved bits.
+    BOOST_CHECK_THROW(parse_ws_header("\xc1\x00"sv, hdr), http::Exception);
+}
+
+BOOST_AUTO_TEST_CASE(WsUnmaskCase)
+{
+    constexpr char Key[] = {'\x01', '\x02', '\x03', '\x04'};
+    uint32_t mask;
+    memcpy(&mask, Key, sizeof(mask));
+
+    string data;
+    for (int i{0}; i < 200; ++i) {
+        data += static_cast<char>(i);
+    }
+    // Compare against a scalar reference at every offset and length, to cover the vector loops
+    // and the tail.
+    for (size_t offset{0}; offset < 4; ++offset) {
+        for (size_t len{0}; len <= data.size(); len += 7) {
+            string actual{data.substr(0, len)};
+            ws_unmask(actual.data(), actual.size(), mask, offset);
+            string expected{data.substr(0, len)};
+            for (size_t i{0}; i < len; ++i) {
+                expected[i] ^= Key[(offset + i) % 4];
+            }
+            BOOST_TEST(actual == expected);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(WsAcceptKeyCase)
+{
+    // Example from RFC 6455.
+    BOOST_TEST(ws_accept_key("dGhlIHNhbXBsZSBub25jZQ==") == "s3pPLMBiTxaQ9kYGzzhZRbK+xOo=");
+}
+
+BOOST_AUTO_TEST_CASE(WsEchoCase)
+{
+    const auto now = CyclTime::now();
+    Serv serv{now, reactor, ep, app};
+    StreamSockClnt sock{ep.protocol()};
+    sock.connect(ep);
+
+    // The first frame is sent with the handshake.
+    const auto hello = string{Handshake} + make_frame(true, WsOpcode::Text, "hello");
+    sock.send(hello.data(), hello.size(), 0);
+    auto out = recv(sock, HandshakeResponse.size() + 7);
+    BOOST_TEST(out.substr(0, HandshakeResponse.size()) == HandshakeResponse);
+    BOOST_TEST(out.substr(HandshakeResponse.size()) == "\x81\x05hello"s);
+    BOOST_TEST(ws_app.conn_count() == 1U);
+
+    // Fragmented message with an interleaved Ping.
+    const auto frames = make_frame(false, WsOpcode::Binary, string(200, 'x'))
+        + make_frame(true, WsOpcode::Ping, "ping") + make_frame(true, WsOpcode::Continuation, "y");
+    sock.send(frames.data(), frames.size(), 0);
+    out = recv(sock, 6 + 4 + 201);
+    BOOST_TEST(out.substr(0, 6) == "\x8a\x04ping"s);
+    BOOST_TEST(out.substr(10) == string(200, 'x') + 'y');
+    BOOST_TEST(ws_app.messages.size() == 2U);
+
+    // The Close frame is echoed.
+    const auto close = make_frame(true, WsOpcode::Close, "\x03\xe8"sv);
+    sock.send(close.data(), close.size(), 0);
+    out = recv(sock, 4);
+    BOOST_TEST(out == "\x88\x02\x03\xe8"s);
+    BOOST_TEST(ws_app.conn_count() == 0U);
+    BOOST_TEST(ws_app.closed == 1);
+}
+
+BOOST_AUTO_TEST_CASE(WsProtocolErrorCase)
+{
+    const auto now = CyclTime::now();
+    Serv serv{now, reactor, ep, app};
+    StreamSockClnt sock{ep.protocol()};
+    sock.connect(ep);
+
+    sock.send(Handshake.data(), Handshake.size(), 0);
+    BOOST_TEST(recv(sock, HandshakeResponse.size()) == HandshakeResponse);
+
+    // Client frames must be masked.
+    char buf[MaxWsHeaderSize];
+    const auto n = put_ws_header(buf, true, WsOpcode::Text, 0);
+    sock.send(buf, n, 0);
+    const auto out = recv(sock, 4);
+    BOOST_TEST(out.substr(0, 4) == "\x88\x10\x03\xea"s);
+    BOOST_TEST(ws_app.conn_count() == 0U);
+}
+
+BOOST_AUTO_TEST_CASE(WsBroadcastCase)
+{
+    const auto now = CyclTime::now();
+    Serv serv{now, reactor, ep, app};
+    StreamSockClnt sock1{ep.protocol()}, sock2{ep.protocol()};
+    sock1.connect(ep);
+    sock2.connect(ep);
+    sock1.send(Handshake.data(), Handshake.size(), 0);
+    sock2.send(Handshake.data(), Handshake.size(), 0);
+    BOOST_TEST(recv(sock1, HandshakeResponse.size()) == HandshakeResponse);
+    BOOST_TEST(recv(sock2, HandshakeResponse.size()) == HandshakeResponse);
+
+    BOOST_TEST(ws_app.broadcast(CyclTime::now(), WsOpcode::Text, "news") == 2U);
+    BOOST_TEST(recv(sock1, 6) == "\x81\x04news"s);
+    BOOST_TEST(recv(sock2, 6) == "\x81\x04news"s);
+}
+
+BOOST_AUTO_TEST_CASE(WsSlowConsumerCase)
+{
+    constexpr size_t MaxQueued{64 * 1024};
+    const string data(16 * 1024, 'x');
+
+    for (const auto policy : {SlowConsumer::Drop, SlowConsumer::Conflate, SlowConsumer::Disconnect}) {
+        // The peer never reads.
+        auto socks = socketpair(UnixStreamProtocol{});
+        socks.first.set_non_block();
+        socks.first.set_snd_buf(MaxQueued);
+        new WsConn{CyclTime::now(), reactor, std::move(socks.first), {}, ws_app, {}, {}};
+        WsConn* conn{nullptr};
+        ws_app.for_each_conn([&conn](WsConn& c) { conn = &c; });
+        conn->set_slow_consumer(policy, MaxQueued);
+        // Wait for the connection to become writable.
+        reactor.poll(CyclTime::now(), 0ms);
+
+        size_t sent{0};
+        for (int i{0}; i < 100; ++i) {
+            sent += ws_app.broadcast(CyclTime::now(), WsOpcode::Binary, data);
+        }
+        switch (policy) {
+        case SlowConsumer::Drop:
+            BOOST_TEST(sent < 100U);
+            BOOST_TEST(conn->queued() < MaxQueued + data.size() + MaxWsHeaderSize);
+            break;
+        case SlowConsumer::Conflate:
+            BOOST_TEST(sent == 100U);
+            BOOST_TEST(conn->queued() < MaxQueued + data.size() + MaxWsHeaderSize);
+            break;
+        case SlowConsumer::Disconnect:
+            BOOST_TEST(sent < 100U);
+            BOOST_TEST(ws_app.conn_count() == 0U);
+            break;
+        }
+        if (ws_app.conn_count() > 0) {
+            conn->dispose(CyclTime::now());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(WsAdmissionCase)
+{
+    Admission admission;
+    const auto peer = parse_stream_endpoint("tcp4://192.168.1.3:1000");
+    // The slot admitted for the HTTP connection is handed over with the socket.
+    BOOST_TEST(admission.on_connect(peer));
+
+    auto socks = socketpair(UnixStreamProtocol{});
+    socks.first.set_non_block();
+    new WsConn{CyclTime::now(), reactor, std::move(socks.first), peer, ws_app, {}, {}, &admission};
+    WsConn* conn{nullptr};
+    ws_app.for_each_conn([&conn](WsConn& c) { conn = &c; });
+    BOOST_TEST(admission.conn_count(peer) == 1U);
+
+    conn->dispose(CyclTime::now());
+    BOOST_TEST(admission.conn_count(peer) == 0U);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
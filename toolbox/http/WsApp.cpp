@@ -0,0 +1,58 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "WsApp.hpp"
+
+namespace toolbox {
+inline namespace http {
+using namespace std;
+
+WsApp::~WsApp()
+{
+    const auto now = CyclTime::current();
+    // The connections are unlinked before they are disposed, so on_ws_close() is not called.
+    conn_list_.clear_and_dispose([now](auto* conn) { conn->dispose(now); });
+}
+
+size_t WsApp::conn_count() const noexcept
+{
+    return distance(conn_list_.begin(), conn_list_.end());
+}
+
+size_t WsApp::broadcast(CyclTime now, WsOpcode opcode, string_view data)
+{
+    const auto frame = make_ws_frame(opcode, data);
+    size_t n{0};
+    for (auto it = conn_list_.begin(); it != conn_list_.end();) {
+        // The connection may be disposed by the slow-consumer policy or a write error.
+        auto& conn = *it++;
+        if (conn.send(now, frame)) {
+            ++n;
+        }
+    }
+    return n;
+}
+
+bool WsApp::do_on_ws_upgrade(CyclTime now, const Endpoint& ep, const Request& req)
+{
+    return true;
+}
+
+void WsApp::do_on_ws_open(CyclTime now, WsConn& conn) {}
+
+void WsApp::do_on_ws_close(CyclTime now, WsConn& conn) noexcept {}
+
+} // namespace http
+} // namespace toolbox
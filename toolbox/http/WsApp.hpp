@@ -0,0 +1,94 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_HTTP_WSAPP_HPP
+#define TOOLBOX_HTTP_WSAPP_HPP
+
+#include <toolbox/http/WsConn.hpp>
+
+namespace toolbox {
+inline namespace http {
+class Request;
+
+/// WsApp receives the events of WebSocket connections, and owns the connections. It is attached
+/// to an App with App::set_ws_app().
+class TOOLBOX_API WsApp {
+
+    friend class WsConn;
+
+    using ConstantTimeSizeOption = boost::intrusive::constant_time_size<false>;
+    using MemberHookOption
+        = boost::intrusive::member_hook<WsConn, decltype(WsConn::list_hook), &WsConn::list_hook>;
+    using ConnList = boost::intrusive::list<WsConn, ConstantTimeSizeOption, MemberHookOption>;
+
+  public:
+    using Endpoint = StreamEndpoint;
+
+    WsApp() noexcept = default;
+    virtual ~WsApp();
+
+    // Copy.
+    WsApp(const WsApp&) = delete;
+    WsApp& operator=(const WsApp&) = delete;
+
+    // Move.
+    WsApp(WsApp&&) = delete;
+    WsApp& operator=(WsApp&&) = delete;
+
+    /// Called with a valid opening handshake. Returns false to reject the upgrade, in which case
+    /// the request is passed to App::on_http_message() as usual.
+    bool on_ws_upgrade(CyclTime now, const Endpoint& ep, const Request& req)
+    {
+        return do_on_ws_upgrade(now, ep, req);
+    }
+    void on_ws_open(CyclTime now, WsConn& conn) { do_on_ws_open(now, conn); }
+    /// Called with each complete message. The data is only valid for the duration of the call.
+    void on_ws_message(CyclTime now, WsConn& conn, WsOpcode opcode, std::string_view data)
+    {
+        do_on_ws_message(now, conn, opcode, data);
+    }
+    void on_ws_close(CyclTime now, WsConn& conn) noexcept { do_on_ws_close(now, conn); }
+
+    /// Returns the number of open connections.
+    std::size_t conn_count() const noexcept;
+    /// Encode the message once and queue a reference to it on every open connection, subject to
+    /// each connection's slow-consumer policy. Returns the number of connections on which the
+    /// message was queued.
+    std::size_t broadcast(CyclTime now, WsOpcode opcode, std::string_view data);
+    template <typename FnT>
+    void for_each_conn(FnT fn)
+    {
+        for (auto& conn : conn_list_) {
+            fn(conn);
+        }
+    }
+
+  protected:
+    virtual bool do_on_ws_upgrade(CyclTime now, const Endpoint& ep, const Request& req);
+    virtual void do_on_ws_open(CyclTime now, WsConn& conn);
+    virtual void do_on_ws_message(CyclTime now, WsConn& conn, WsOpcode opcode,
+                                  std::string_view data)
+        = 0;
+    virtual void do_on_ws_close(CyclTime now, WsConn& conn) noexcept;
+
+  private:
+    // List of active connections.
+    ConnList conn_list_;
+};
+
+} // namespace http
+} // namespace toolbox
+
+#endif // TOOLBOX_HTTP_WSAPP_HPP
@@ -0,0 +1,415 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "WsConn.hpp"
+
+#include <toolbox/http/Admission.hpp>
+#include <toolbox/http/Exception.hpp>
+#include <toolbox/http/WsApp.hpp>
+#include <toolbox/sys/Log.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#include <sys/uio.h>
+
+namespace toolbox {
+inline namespace http {
+using namespace std;
+namespace {
+
+/// Maximum payload size of a control frame.
+constexpr size_t MaxControlSize{125};
+/// Maximum number of segments written with a single system call.
+constexpr size_t MaxIov{64};
+
+void append(Buffer& buf, string_view data)
+{
+    const auto out = buf.prepare(data.size());
+    memcpy(buffer_cast<char*>(out), data.data(), data.size());
+    buf.commit(data.size());
+}
+
+} // namespace
+
+WsConn::WsConn(CyclTime now, Reactor& r, IoSock&& sock, const Endpoint& ep, WsApp& app,
+               string_view in, string_view out, Admission* admission)
+: reactor_{r}
+, sock_{std::move(sock)}
+, ep_{ep}
+, app_{app}
+, admission_{admission}
+{
+    append(in_, in);
+    append(out_, out);
+    push_private(out.size());
+    // The socket is writable, so the first event writes the handshake response and handles any
+    // input that was received with the handshake request.
+    sub_ = r.subscribe(*sock_, EpollIn | EpollOut, bind<&WsConn::on_io_event>(this));
+    write_blocked_ = true;
+    ping_tmr_ = r.timer(now.mono_time() + PingInterval, PingInterval, Priority::Low,
+                        bind<&WsConn::on_ping_timer>(this));
+    app.conn_list_.push_back(*this);
+    app.on_ws_open(now, *this);
+}
+
+WsConn::~WsConn() = default;
+
+void WsConn::send(CyclTime now, WsOpcode opcode, string_view data)
+{
+    if (close_sent_) {
+        // No frames may follow a Close frame.
+        return;
+    }
+    put_frame(opcode, data);
+    flush_later(now);
+}
+
+bool WsConn::send(CyclTime now, const SharedBufferPtr& frame)
+{
+    if (close_sent_) {
+        return false;
+    }
+    if (queued_ >= max_queued_) {
+        switch (slow_consumer_) {
+        case SlowConsumer::Drop:
+            return false;
+        case SlowConsumer::Conflate:
+            conflate();
+            break;
+        case SlowConsumer::Disconnect:
+            // Nothing more is queued while the disposal is pending.
+            close_sent_ = true;
+            dispose(now);
+            return false;
+        }
+    }
+    queue_.push_back({frame, frame->size()});
+    queued_ += frame->size();
+    flush_later(now);
+    return true;
+}
+
+void WsConn::close(CyclTime now, WsClose code, string_view reason)
+{
+    if (close_sent_) {
+        return;
+    }
+    char buf[MaxControlSize];
+    const uint16_t n{__builtin_bswap16(static_cast<uint16_t>(code))};
+    memcpy(buf, &n, sizeof(n));
+    reason = reason.substr(0, MaxControlSize - sizeof(n));
+    memcpy(buf + sizeof(n), reason.data(), reason.size());
+    put_frame(WsOpcode::Close, {buf, sizeof(n) + reason.size()});
+    close_sent_ = true;
+    flush_later(now);
+}
+
+void WsConn::dispose_now(CyclTime now) noexcept
+{
+    // The connection has already been unlinked if the application is being destroyed.
+    if (list_hook.is_linked()) {
+        app_.on_ws_close(now, *this); // noexcept
+    }
+    if (admission_) {
+        admission_->on_disconnect(ep_); // noexcept
+    }
+    // Best effort to drain any data still pending in the write buffer before the socket is
+    // closed.
+    if (!queue_.empty()) {
+        error_code ec;
+        write_queue(ec); // noexcept
+    }
+    delete this;
+}
+
+void WsConn::on_io_event(CyclTime now, int fd, unsigned events)
+{
+    auto lock = lock_this(now);
+    try {
+        if (events & (EpollIn | EpollHup)) {
+            if (!drain_input(now, fd)) {
+                dispose(now);
+                return;
+            }
+        }
+        if (!in_.empty()) {
+            flush_input(now);
+        }
+        if (write_blocked_ || !queue_.empty()) {
+            flush_output(now);
+        }
+    } catch (const std::exception& e) {
+        TOOLBOX_ERROR << "websocket error: " << e.what();
+        dispose(now);
+    }
+}
+
+void WsConn::on_ping_timer(CyclTime now, Timer& tmr)
+{
+    if (!alive_) {
+        // Nothing has been received from the peer since the last Ping.
+        dispose(now);
+        return;
+    }
+    alive_ = false;
+    send(now, WsOpcode::Ping, {});
+}
+
+bool WsConn::drain_input(CyclTime now, int fd)
+{
+    // Limit the number of reads to avoid starvation.
+    for (int i{0}; i < 4; ++i) {
+        error_code ec;
+        const auto buf = in_.prepare(16384);
+        const auto size = os::read(fd, buf, ec);
+        if (ec) {
+            // No data available in socket buffer.
+            if (ec == errc::operation_would_block) {
+                break;
+            }
+            throw system_error{ec, "read"};
+        }
+        if (size == 0) {
+            return false;
+        }
+        // Commit actual bytes read.
+        in_.commit(size);
+        alive_ = true;
+        // Assume that the TCP stream has been drained if we read less than the requested amount.
+        if (static_cast<size_t>(size) < buffer_size(buf)) {
+            break;
+        }
+    }
+    return true;
+}
+
+void WsConn::flush_input(CyclTime now)
+{
+    while (!close_sent_) {
+        const auto in = in_.str();
+        WsFrameHeader hdr;
+        size_t hdr_size;
+        try {
+            hdr_size = parse_ws_header(in, hdr);
+        } catch (const Exception& e) {
+            close(now, WsClose::ProtocolError, e.what());
+            break;
+        }
+        if (hdr_size == 0) {
+            break;
+        }
+        if (!hdr.masked) {
+            close(now, WsClose::ProtocolError, "unmasked frame");
+            break;
+        }
+        if (is_control(hdr.opcode)) {
+            if (!hdr.fin || hdr.payload_len > MaxControlSize) {
+                close(now, WsClose::ProtocolError, "invalid control frame");
+                break;
+            }
+        } else if (hdr.payload_len > MaxMessageSize - message_.size()) {
+            close(now, WsClose::MessageTooBig);
+            break;
+        }
+        // Wait for the whole frame.
+        if (in.size() - hdr_size < hdr.payload_len) {
+            break;
+        }
+        // The payload is unmasked in place, so that an unfragmented message can be delivered
+        // without a copy.
+        auto* const payload = const_cast<char*>(in.data()) + hdr_size;
+        const auto len = static_cast<size_t>(hdr.payload_len);
+        ws_unmask(payload, len, hdr.mask);
+        on_frame(now, hdr, {payload, len});
+        in_.consume(hdr_size + len);
+    }
+}
+
+void WsConn::on_frame(CyclTime now, const WsFrameHeader& hdr, string_view payload)
+{
+    switch (hdr.opcode) {
+    case WsOpcode::Continuation:
+        if (!fragmented_) {
+            close(now, WsClose::ProtocolError, "unexpected continuation frame");
+            return;
+        }
+        message_.append(payload);
+        if (hdr.fin) {
+            fragmented_ = false;
+            app_.on_ws_message(now, *this, message_opcode_, message_);
+            message_.clear();
+        }
+        break;
+    case WsOpcode::Text:
+    case WsOpcode::Binary:
+        if (fragmented_) {
+            close(now, WsClose::ProtocolError, "expected continuation frame");
+            return;
+        }
+        if (hdr.fin) {
+            app_.on_ws_message(now, *this, hdr.opcode, payload);
+        } else {
+            fragmented_ = true;
+            message_opcode_ = hdr.opcode;
+            message_.assign(payload);
+        }
+        break;
+    case WsOpcode::Close:
+        // Echo the status code, if any, and close the connection once it has been written.
+        if (payload.size() >= 2) {
+            uint16_t n;
+            memcpy(&n, payload.data(), sizeof(n));
+            close(now, static_cast<WsClose>(__builtin_bswap16(n)));
+        } else {
+            close(now, WsClose::Normal);
+        }
+        break;
+    case WsOpcode::Ping:
+        send(now, WsOpcode::Pong, payload);
+        break;
+    case WsOpcode::Pong:
+        // Any input is proof of life.
+        break;
+    default:
+        close(now, WsClose::ProtocolError, "unknown opcode");
+        break;
+    }
+}
+
+void WsConn::put_frame(WsOpcode opcode, string_view data)
+{
+    const auto buf = out_.prepare(MaxWsHeaderSize + data.size());
+    auto* const p = buffer_cast<char*>(buf);
+    const auto hdr_size = put_ws_header(p, true, opcode, data.size());
+    memcpy(p + hdr_size, data.data(), data.size());
+    out_.commit(hdr_size + data.size());
+    push_private(hdr_size + data.size());
+}
+
+void WsConn::push_private(size_t size)
+{
+    if (size == 0) {
+        return;
+    }
+    if (!queue_.empty() && !queue_.back().shared) {
+        queue_.back().size += size;
+    } else {
+        queue_.push_back({nullptr, size});
+    }
+    queued_ += size;
+}
+
+void WsConn::conflate() noexcept
+{
+    auto it = queue_.begin();
+    // The front segment may have been partially written.
+    if (it != queue_.end()) {
+        ++it;
+    }
+    it = remove_if(it, queue_.end(), [this](const auto& seg) {
+        if (seg.shared) {
+            queued_ -= seg.size;
+            return true;
+        }
+        return false;
+    });
+    queue_.erase(it, queue_.end());
+}
+
+void WsConn::flush_output(CyclTime now)
+{
+    if (!queue_.empty()) {
+        error_code ec;
+        const auto size = write_queue(ec);
+        if (ec) {
+            if (ec != errc::operation_would_block) {
+                throw system_error{ec, "sendmsg"};
+            }
+        } else {
+            consume_queue(size);
+        }
+    }
+    const bool blocked{!queue_.empty()};
+    if (!blocked && close_sent_) {
+        // The Close frame has been written.
+        dispose(now);
+        return;
+    }
+    if (blocked != write_blocked_) {
+        // Poll for writability until the output queue has been drained.
+        sub_.set_events(blocked ? EpollIn | EpollOut : EpollIn);
+        write_blocked_ = blocked;
+    }
+}
+
+void WsConn::flush_later(CyclTime now)
+{
+    if (write_blocked_ || is_locked()) {
+        return;
+    }
+    auto lock = lock_this(now);
+    try {
+        flush_output(now);
+    } catch (const std::exception& e) {
+        TOOLBOX_ERROR << "websocket error: " << e.what();
+        dispose(now);
+    }
+}
+
+ssize_t WsConn::write_queue(error_code& ec) noexcept
+{
+    iovec iov[MaxIov];
+    size_t n{0};
+    // Private segments are contiguous in out_.
+    const auto* priv = out_.str().data();
+    for (const auto& seg : queue_) {
+        if (n == MaxIov) {
+            break;
+        }
+        if (seg.shared) {
+            const auto str = seg.shared->str();
+            iov[n++] = {const_cast<char*>(str.data()) + str.size() - seg.size, seg.size};
+        } else {
+            iov[n++] = {const_cast<char*>(priv), seg.size};
+            priv += seg.size;
+        }
+    }
+    msghdr msg{};
+    msg.msg_iov = iov;
+    msg.msg_iovlen = n;
+    // Report a closed connection as an error rather than raising SIGPIPE.
+    return sock_.sendmsg(msg, MSG_NOSIGNAL, ec);
+}
+
+void WsConn::consume_queue(size_t size) noexcept
+{
+    queued_ -= size;
+    while (size > 0) {
+        auto& seg = queue_.front();
+        const auto n = min(size, seg.size);
+        if (!seg.shared) {
+            out_.consume(n);
+        }
+        seg.size -= n;
+        size -= n;
+        if (seg.size == 0) {
+            queue_.pop_front();
+        }
+    }
+}
+
+} // namespace http
+} // namespace toolbox
@@ -0,0 +1,162 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_HTTP_WSCONN_HPP
+#define TOOLBOX_HTTP_WSCONN_HPP
+
+#include <toolbox/http/WebSocket.hpp>
+#include <toolbox/io/Buffer.hpp>
+#include <toolbox/io/Disposer.hpp>
+#include <toolbox/io/Reactor.hpp>
+#include <toolbox/net/Endpoint.hpp>
+#include <toolbox/net/IoSock.hpp>
+
+#include <boost/intrusive/list.hpp>
+
+#include <deque>
+
+namespace toolbox {
+inline namespace http {
+class Admission;
+class WsApp;
+
+/// Policy applied when a shared frame is sent to a connection whose output queue is at or above
+/// its limit.
+enum class SlowConsumer : int {
+    /// Discard the new frame.
+    Drop,
+    /// Replace the shared frames that are still waiting to be written with the new frame, so that
+    /// a slow peer only receives the latest.
+    Conflate,
+    /// Close the connection.
+    Disconnect
+};
+
+/// WsConn is a server-side WebSocket connection. It takes ownership of the socket from the HTTP
+/// connection once the opening handshake has been accepted, and is owned by the WsApp.
+class TOOLBOX_API WsConn : public BasicDisposer<WsConn> {
+
+    friend class BasicDisposer<WsConn>;
+
+    // Automatically unlink when object is destroyed.
+    using AutoUnlinkOption = boost::intrusive::link_mode<boost::intrusive::auto_unlink>;
+
+  public:
+    using Endpoint = StreamEndpoint;
+
+    /// A Ping is sent at this interval, and the connection is closed if nothing has been received
+    /// from the peer for a whole interval.
+    static constexpr auto PingInterval = 30s;
+    /// Maximum size of a message, including the reassembled fragments of a fragmented message.
+    static constexpr std::size_t MaxMessageSize{16 * 1024 * 1024};
+    /// Default limit on the number of bytes waiting to be written before the slow-consumer policy
+    /// is applied.
+    static constexpr std::size_t DefaultMaxQueued{4 * 1024 * 1024};
+
+    /// The input is any data that followed the handshake request, and the output is the handshake
+    /// response, which has yet to be written. The connection slot that was admitted for the HTTP
+    /// connection, if any, is released when this connection is closed.
+    WsConn(CyclTime now, Reactor& r, IoSock&& sock, const Endpoint& ep, WsApp& app,
+           std::string_view in, std::string_view out, Admission* admission = nullptr);
+
+    // Copy.
+    WsConn(const WsConn&) = delete;
+    WsConn& operator=(const WsConn&) = delete;
+
+    // Move.
+    WsConn(WsConn&&) = delete;
+    WsConn& operator=(WsConn&&) = delete;
+
+    const Endpoint& endpoint() const noexcept { return ep_; }
+    /// Returns true once a Close frame has been sent.
+    bool is_closing() const noexcept { return close_sent_; }
+    /// Returns the number of bytes waiting to be written.
+    std::size_t queued() const noexcept { return queued_; }
+    SlowConsumer slow_consumer() const noexcept { return slow_consumer_; }
+    /// Set the policy applied to shared frames once the output queue reaches max_queued bytes.
+    void set_slow_consumer(SlowConsumer policy, std::size_t max_queued) noexcept
+    {
+        slow_consumer_ = policy;
+        max_queued_ = max_queued;
+    }
+
+    /// Send a single unfragmented frame. Frames sent from a callback are written together once the
+    /// callback has returned.
+    void send(CyclTime now, WsOpcode opcode, std::string_view data);
+    void send_text(CyclTime now, std::string_view data) { send(now, WsOpcode::Text, data); }
+    void send_binary(CyclTime now, std::string_view data) { send(now, WsOpcode::Binary, data); }
+    /// Queue a reference to a frame that was encoded once with make_ws_frame(), typically for
+    /// many connections. The slow-consumer policy applies. Returns false if the frame was dropped
+    /// or the connection was closed.
+    bool send(CyclTime now, const SharedBufferPtr& frame);
+    /// Send a Close frame and close the connection once it has been written.
+    void close(CyclTime now, WsClose code, std::string_view reason = {});
+
+    boost::intrusive::list_member_hook<AutoUnlinkOption> list_hook;
+
+  protected:
+    void dispose_now(CyclTime now) noexcept;
+
+  private:
+    ~WsConn();
+    void on_io_event(CyclTime now, int fd, unsigned events);
+    void on_ping_timer(CyclTime now, Timer& tmr);
+    /// Returns false if the peer has closed the connection.
+    bool drain_input(CyclTime now, int fd);
+    /// Handle each complete frame in the input buffer.
+    void flush_input(CyclTime now);
+    void on_frame(CyclTime now, const WsFrameHeader& hdr, std::string_view payload);
+    void put_frame(WsOpcode opcode, std::string_view data);
+    /// Queue the bytes that were appended to out_.
+    void push_private(std::size_t size);
+    /// Remove the shared frames that have yet to be started.
+    void conflate() noexcept;
+    /// Write as much of the output queue as possible without blocking.
+    void flush_output(CyclTime now);
+    /// Flush the output queue, unless a callback is in progress, in which case the queue is
+    /// flushed once the callback has returned.
+    void flush_later(CyclTime now);
+    /// Write the front of the output queue with a single system call.
+    ssize_t write_queue(std::error_code& ec) noexcept;
+    void consume_queue(std::size_t size) noexcept;
+
+    Reactor& reactor_;
+    IoSock sock_;
+    Endpoint ep_;
+    WsApp& app_;
+    Admission* const admission_;
+    Reactor::Handle sub_;
+    Timer ping_tmr_;
+    /// Output is queued as a sequence of segments, each of which is either a range of private
+    /// bytes at the front of out_ or a reference to a shared frame.
+    struct Segment {
+        SharedBufferPtr shared;
+        /// Number of bytes remaining.
+        std::size_t size;
+    };
+    Buffer in_, out_;
+    std::deque<Segment> queue_;
+    std::size_t queued_{0}, max_queued_{DefaultMaxQueued};
+    SlowConsumer slow_consumer_{SlowConsumer::Disconnect};
+    /// Reassembled payload of a fragmented message.
+    std::string message_;
+    WsOpcode message_opcode_{WsOpcode::Continuation};
+    bool fragmented_{false}, alive_{true}, close_sent_{false}, write_blocked_{false};
+};
+
+} // namespace http
+} // namespace toolbox
+
+#endif // TOOLBOX_HTTP_WSCONN_HPP
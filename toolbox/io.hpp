@@ -27,6 +27,7 @@
 #include "io/Hook.hpp"
 #include "io/Reactor.hpp"
 #include "io/Runner.hpp"
+#include "io/SharedBuffer.hpp"
 #include "io/Stream.hpp"
 #include "io/Timer.hpp"
 #include "io/TimerFd.hpp"
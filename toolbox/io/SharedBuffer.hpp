@@ -0,0 +1,67 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_IO_SHAREDBUFFER_HPP
+#define TOOLBOX_IO_SHAREDBUFFER_HPP
+
+#include <toolbox/io/Buffer.hpp>
+#include <toolbox/util/RefCount.hpp>
+
+#include <string>
+
+namespace toolbox {
+inline namespace io {
+
+/// SharedBuffer is an immutable, reference-counted byte sequence. A message that is sent to many
+/// connections is encoded once into a SharedBuffer, and each connection queues a reference to it
+/// rather than a copy.
+///
+/// The reference count is not atomic, so a SharedBuffer must only be shared between connections
+/// on the same reactor thread.
+class SharedBuffer : public RefCount<SharedBuffer, ThreadUnsafePolicy> {
+  public:
+    explicit SharedBuffer(std::string data) noexcept
+    : data_{std::move(data)}
+    {
+    }
+    ~SharedBuffer() = default;
+
+    // Copy.
+    SharedBuffer(const SharedBuffer&) = delete;
+    SharedBuffer& operator=(const SharedBuffer&) = delete;
+
+    // Move.
+    SharedBuffer(SharedBuffer&&) = delete;
+    SharedBuffer& operator=(SharedBuffer&&) = delete;
+
+    ConstBuffer data() const noexcept { return {data_.data(), data_.size()}; }
+    std::string_view str() const noexcept { return data_; }
+    std::size_t size() const noexcept { return data_.size(); }
+
+  private:
+    const std::string data_;
+};
+
+using SharedBufferPtr = boost::intrusive_ptr<const SharedBuffer>;
+
+inline SharedBufferPtr make_shared_buffer(std::string data)
+{
+    return make_intrusive<SharedBuffer>(std::move(data));
+}
+
+} // namespace io
+} // namespace toolbox
+
+#endif // TOOLBOX_IO_SHAREDBUFFER_HPP
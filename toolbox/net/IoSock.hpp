@@ -84,6 +84,12 @@ struct IoSock : Sock {
         return os::send(get(), buf, flags, ec);
     }
     std::size_t send(ConstBuffer buf, int flags) { return os::send(get(), buf, flags); }
+
+    ssize_t sendmsg(const msghdr& msg, int flags, std::error_code& ec) noexcept
+    {
+        return os::sendmsg(get(), msg, flags, ec);
+    }
+    std::size_t sendmsg(const msghdr& msg, int flags) { return os::sendmsg(get(), msg, flags); }
 };
 
 template <typename ProtocolT>
@@ -479,6 +479,26 @@ inline std::size_t send(int sockfd, ConstBuffer buf, int flags)
     return send(sockfd, buffer_cast<const void*>(buf), buffer_size(buf), flags);
 }
 
+/// Send a message on a socket.
+inline ssize_t sendmsg(int sockfd, const msghdr& msg, int flags, std::error_code& ec) noexcept
+{
+    const auto ret = ::sendmsg(sockfd, &msg, flags);
+    if (ret < 0) {
+        ec = make_error(errno);
+    }
+    return ret;
+}
+
+/// Send a message on a socket.
+inline std::size_t sendmsg(int sockfd, const msghdr& msg, int flags)
+{
+    const auto ret = ::sendmsg(sockfd, &msg, flags);
+    if (ret < 0) {
+        throw std::system_error{make_error(errno), "sendmsg"};
+    }
+    return ret;
+}
+
 /// Send a message on a socket.
 inline ssize_t sendto(int sockfd, const void* buf, std::size_t len, int flags, const sockaddr& addr,
                       socklen_t addrlen, std::error_code& ec) noexcept
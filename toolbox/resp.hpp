@@ -17,7 +17,10 @@
 #ifndef TOOLBOX_RESP_HPP
 #define TOOLBOX_RESP_HPP
 
+#include "resp/Encoder.hpp"
 #include "resp/Exception.hpp"
 #include "resp/Parser.hpp"
+#include "resp/RespClnt.hpp"
+#include "resp/RespReply.hpp"
 
 #endif // TOOLBOX_RESP_HPP
@@ -0,0 +1,150 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Encoder.hpp"
+
+#include <array>
+#include <charconv>
+#include <cstring>
+
+namespace toolbox {
+inline namespace resp {
+using namespace std;
+namespace {
+
+/// Lengths below this are encoded from a table.
+constexpr size_t SmallLength{1024};
+
+/// Precomputed decimal digits and line terminator. The whole entry is copied with a single
+/// fixed-size copy, and the output advanced by its size.
+struct Suffix {
+    char data[8];
+    size_t size;
+};
+
+constexpr auto make_suffixes() noexcept
+{
+    array<Suffix, SmallLength> t{};
+    for (size_t n{0}; n < SmallLength; ++n) {
+        auto& s = t[n];
+        char digits[4];
+        size_t len{0};
+        auto i = n;
+        do {
+            digits[len++] = static_cast<char>('0' + i % 10);
+            i /= 10;
+        } while (i != 0);
+        for (size_t j{0}; j < len; ++j) {
+            s.data[j] = digits[len - j - 1];
+        }
+        s.data[len] = '\r';
+        s.data[len + 1] = '\n';
+        s.size = len + 2;
+    }
+    return t;
+}
+
+constexpr auto Suffixes = make_suffixes();
+
+/// Writes the header to the output, which must have room for MaxRespHeaderSize characters, and
+/// returns the end of the header.
+char* put_header(char* out, char type, size_t n) noexcept
+{
+    *out++ = type;
+    if (n < SmallLength) [[likely]] {
+        const auto& s = Suffixes[n];
+        memcpy(out, s.data, sizeof(s.data));
+        return out + s.size;
+    }
+    out = to_chars(out, out + MaxRespHeaderSize - 3, n).ptr;
+    *out++ = '\r';
+    *out++ = '\n';
+    return out;
+}
+
+char* put_bulk(char* out, string_view sv) noexcept
+{
+    out = put_header(out, '$', sv.size());
+    memcpy(out, sv.data(), sv.size());
+    out += sv.size();
+    *out++ = '\r';
+    *out++ = '\n';
+    return out;
+}
+
+} // namespace
+
+void Encoder::put_array(size_t n)
+{
+    auto* const out = buffer_cast<char*>(buf_.prepare(MaxRespHeaderSize));
+    buf_.commit(put_header(out, '*', n) - out);
+}
+
+void Encoder::put_bulk(string_view sv)
+{
+    auto* const out = buffer_cast<char*>(buf_.prepare(MaxRespHeaderSize + sv.size() + 2));
+    buf_.commit(resp::put_bulk(out, sv) - out);
+}
+
+void Encoder::put_bulk(int64_t i)
+{
+    char buf[20];
+    const auto* const end = to_chars(buf, buf + sizeof(buf), i).ptr;
+    put_bulk(string_view{buf, static_cast<size_t>(end - buf)});
+}
+
+void Encoder::put_integer(int64_t i)
+{
+    char buf[20];
+    const auto* const end = to_chars(buf, buf + sizeof(buf), i).ptr;
+    put_line(':', {buf, static_cast<size_t>(end - buf)});
+}
+
+void Encoder::put_null()
+{
+    constexpr string_view Null{"$-1\r\n"};
+    auto* const out = buffer_cast<char*>(buf_.prepare(Null.size()));
+    memcpy(out, Null.data(), Null.size());
+    buf_.commit(Null.size());
+}
+
+void Encoder::put_command(span<const string_view> args)
+{
+    size_t size{MaxRespHeaderSize};
+    for (const auto sv : args) {
+        size += MaxRespHeaderSize + sv.size() + 2;
+    }
+    auto* const first = buffer_cast<char*>(buf_.prepare(size));
+    auto* out = put_header(first, '*', args.size());
+    for (const auto sv : args) {
+        out = resp::put_bulk(out, sv);
+    }
+    buf_.commit(out - first);
+}
+
+void Encoder::put_line(char type, string_view sv)
+{
+    auto* const first = buffer_cast<char*>(buf_.prepare(sv.size() + 3));
+    auto* out = first;
+    *out++ = type;
+    memcpy(out, sv.data(), sv.size());
+    out += sv.size();
+    *out++ = '\r';
+    *out++ = '\n';
+    buf_.commit(out - first);
+}
+
+} // namespace resp
+} // namespace toolbox
@@ -0,0 +1,95 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_RESP_ENCODER_HPP
+#define TOOLBOX_RESP_ENCODER_HPP
+
+#include <toolbox/io/Buffer.hpp>
+
+#include <concepts>
+#include <span>
+#include <string_view>
+
+namespace toolbox {
+inline namespace resp {
+
+/// Maximum size of an array or bulk string header, such as "$18446744073709551615\r\n".
+constexpr std::size_t MaxRespHeaderSize{24};
+
+/// Encoder appends RESP commands to a buffer, so that a batch of pipelined commands can be written
+/// with a single system call. Each command is encoded as an array of bulk strings. Servers may also
+/// use it to encode RESP2 replies. Headers for small lengths are precomputed, and integers are
+/// formatted without iostreams.
+class TOOLBOX_API Encoder {
+  public:
+    explicit Encoder(Buffer& buf) noexcept
+    : buf_{buf}
+    {
+    }
+    ~Encoder() = default;
+
+    // Copy.
+    Encoder(const Encoder&) = delete;
+    Encoder& operator=(const Encoder&) = delete;
+
+    // Move.
+    Encoder(Encoder&&) = delete;
+    Encoder& operator=(Encoder&&) = delete;
+
+    Buffer& buffer() const noexcept { return buf_; }
+
+    /// Append the header of an array with n elements.
+    void put_array(std::size_t n);
+    /// Append a bulk string.
+    void put_bulk(std::string_view sv);
+    /// Append an integer as a bulk string, as required for command arguments.
+    void put_bulk(std::int64_t i);
+    /// Append a simple string, which must not contain CR or LF, such as "OK".
+    void put_simple(std::string_view sv) { put_line('+', sv); }
+    /// Append an error, which must not contain CR or LF, such as "ERR unknown command".
+    void put_error(std::string_view sv) { put_line('-', sv); }
+    /// Append an integer reply.
+    void put_integer(std::int64_t i);
+    /// Append a null bulk string, which is the RESP2 reply for a missing value.
+    void put_null();
+    /// Append a command whose arguments are bulk strings. The buffer is grown at most once.
+    void put_command(std::span<const std::string_view> args);
+    void put_command(std::initializer_list<std::string_view> args)
+    {
+        put_command(std::span{args.begin(), args.size()});
+    }
+    /// Append a command whose arguments are any mix of strings and integers, for example
+    /// put("SET", key, 42).
+    template <typename... ArgsT>
+    void put(const ArgsT&... args)
+    {
+        put_array(sizeof...(args));
+        (put_arg(args), ...);
+    }
+
+  private:
+    template <typename ValueT>
+        requires std::integral<ValueT>
+    void put_arg(ValueT i) { put_bulk(static_cast<std::int64_t>(i)); }
+    void put_arg(std::string_view sv) { put_bulk(sv); }
+    void put_line(char type, std::string_view sv);
+
+    Buffer& buf_;
+};
+
+} // namespace resp
+} // namespace toolbox
+
+#endif // TOOLBOX_RESP_ENCODER_HPP
@@ -0,0 +1,84 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Encoder.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace toolbox;
+
+BOOST_AUTO_TEST_SUITE(EncoderSuite)
+
+BOOST_AUTO_TEST_CASE(EncoderBulkCase)
+{
+    Buffer buf;
+    Encoder enc{buf};
+    enc.put_array(2);
+    enc.put_bulk(""sv);
+    enc.put_bulk("foo"sv);
+    enc.put_bulk(int64_t{-42});
+    BOOST_TEST(buf.str() == "*2\r\n$0\r\n\r\n$3\r\nfoo\r\n$3\r\n-42\r\n"sv);
+
+    // Lengths beyond the precomputed table.
+    for (const size_t len : {999UL, 1023UL, 1024UL, 100000UL}) {
+        buf.clear();
+        const string s(len, 'x');
+        enc.put_bulk(s);
+        BOOST_TEST(buf.str() == '$' + to_string(len) + "\r\n" + s + "\r\n");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(EncoderCommandCase)
+{
+    Buffer buf;
+    Encoder enc{buf};
+    enc.put_command({"GET"sv, "key"sv});
+    enc.put("SET", "counter"sv, 123);
+    enc.put("PING");
+    BOOST_TEST(buf.str()
+               == "*2\r\n$3\r\nGET\r\n$3\r\nkey\r\n"
+                  "*3\r\n$3\r\nSET\r\n$7\r\ncounter\r\n$3\r\n123\r\n"
+                  "*1\r\n$4\r\nPING\r\n"sv);
+}
+
+BOOST_AUTO_TEST_CASE(EncoderReplyCase)
+{
+    Buffer buf;
+    Encoder enc{buf};
+    enc.put_simple("OK");
+    enc.put_error("ERR unknown command");
+    enc.put_integer(-9223372036854775807 - 1);
+    enc.put_null();
+    enc.put_array(1);
+    enc.put_integer(0);
+    BOOST_TEST(buf.str()
+               == "+OK\r\n-ERR unknown command\r\n:-9223372036854775808\r\n"
+                  "$-1\r\n*1\r\n:0\r\n"sv);
+}
+
+BOOST_AUTO_TEST_CASE(EncoderBatchCase)
+{
+    Buffer buf;
+    Encoder enc{buf};
+    const auto cmd = "*2\r\n$3\r\nGET\r\n$3\r\nkey\r\n"sv;
+    for (int i{0}; i < 500; ++i) {
+        enc.put_command({"GET"sv, "key"sv});
+    }
+    BOOST_TEST(buf.size() == 500 * cmd.size());
+    BOOST_TEST(buf.str().substr(499 * cmd.size()) == cmd);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -19,11 +19,16 @@
 
 #include <toolbox/resp/Exception.hpp>
 
+#include <toolbox/io/Buffer.hpp>
 #include <toolbox/util/Enum.hpp>
 #include <toolbox/util/Finally.hpp>
 
 #include <boost/container/small_vector.hpp>
 
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <limits>
 #include <stack>
 
 namespace toolbox {
@@ -43,14 +48,58 @@ enum class Type : char {
     BulkString = '$',
     /// For Arrays the first byte of the reply is "*".
     Array = '*',
+    /// RESP3 null.
+    Null = '_',
+    /// RESP3 boolean, either "#t" or "#f".
+    Boolean = '#',
+    /// RESP3 floating-point number, including "inf", "-inf" and "nan".
+    Double = ',',
+    /// RESP3 integer of arbitrary size.
+    BigNumber = '(',
+    /// RESP3 error with a binary-safe length-prefixed payload.
+    BlobError = '!',
+    /// RESP3 bulk string whose payload is prefixed with a three character format and a colon.
+    VerbatimString = '=',
+    /// RESP3 map of key/value pairs.
+    Map = '%',
+    /// RESP3 set.
+    Set = '~',
+    /// RESP3 attributes, which describe the value that follows, and are not counted as an
+    /// element of the enclosing aggregate.
+    Attribute = '|',
+    /// RESP3 out-of-band push message.
+    Push = '>',
 };
 
 /// BasicParser is a class template for RESP (REdis Serialization Protocol) parsers.
+///
+/// Input may be fed either one character at a time with put(), or a buffer at a time with parse().
+/// The buffer path scans each line with memchr and delivers strings as views into the input
+/// buffer when they are complete. Tokens that are split across buffers are accumulated as with
+/// put(), so the two may be mixed freely. String callbacks receive a std::string_view that is
+/// only valid for the duration of the call.
+///
+/// Both RESP2 and RESP3 are supported. The RESP3 callbacks have default implementations that map
+/// each event onto the RESP2 callbacks, so the derived class need only handle the events that it
+/// cares about. Null bulk strings and arrays, "$-1" and "*-1", are delivered as RESP3 nulls. No
+/// event allocates, and nesting is limited to max_depth() levels, beyond which the input is
+/// rejected with a fatal protocol exception. Likewise, bulk strings longer than max_bulk_size()
+/// bytes are rejected.
 template <typename DerivedT>
 class BasicParser {
-    using Stack = std::stack<int, boost::container::small_vector<int, 8>>;
+    /// Remaining is the number of elements that have yet to be parsed at this level.
+    struct Level {
+        std::int64_t remaining;
+        Type type;
+    };
+    using Stack = std::stack<Level, boost::container::small_vector<Level, 8>>;
 
   public:
+    /// Default limit on the nesting depth of aggregates.
+    static constexpr std::size_t DefaultMaxDepth{32};
+    /// Default limit on the length of bulk strings, which matches the Redis default.
+    static constexpr std::size_t DefaultMaxBulkSize{512 * 1024 * 1024};
+
     BasicParser() = default;
     ~BasicParser() = default;
 
@@ -62,108 +111,217 @@ class BasicParser {
     BasicParser(BasicParser&&) noexcept = default;
     BasicParser& operator=(BasicParser&&) noexcept = default;
 
+    std::size_t max_depth() const noexcept { return max_depth_; }
+    void set_max_depth(std::size_t max_depth) noexcept { max_depth_ = max_depth; }
+    std::size_t max_bulk_size() const noexcept { return max_bulk_size_; }
+    void set_max_bulk_size(std::size_t max_bulk_size) noexcept { max_bulk_size_ = max_bulk_size; }
+
   protected:
+    /// Returns the number of bytes consumed by the last call to parse(). This is less than the
+    /// buffer size only if a callback threw, in which case the token that was being handled has
+    /// been consumed and parsing may resume from this position.
+    std::size_t parsed() const noexcept { return parsed_; }
+    /// Parse the buffer and return the number of bytes consumed, which is always the buffer size
+    /// unless an exception is thrown.
+    std::size_t parse(ConstBuffer buf)
+    {
+        const auto* const first = buffer_cast<const char*>(buf);
+        const auto* const last = first + buffer_size(buf);
+        const auto* it = first;
+        parsed_ = 0;
+        while (it != last) {
+            if (type_ != Type::None) {
+                // Resume a token that was split across buffers.
+                it = resume(it, last);
+            } else {
+                it = parse_token(it, last);
+            }
+            parsed_ = it - first;
+        }
+        return parsed_;
+    }
     void put(char c)
     {
-        switch (type_) {
-        case Type::None:
-            switch (c) {
-            case unbox(Type::SimpleString):
-            case unbox(Type::Error):
-            case unbox(Type::Integer):
-            case unbox(Type::BulkString):
-            case unbox(Type::Array):
-                type_ = Type{c};
-                break;
-            default:
-                type_ = Type::CommandLine;
+        if (type_ == Type::None) {
+            type_ = to_type(c);
+            if (type_ == Type::CommandLine) {
                 tok_ += c;
-                break;
             }
             return;
-        case Type::CommandLine:
-            put_command_line(c);
-            break;
-        case Type::SimpleString:
-            put_simple_string(c);
-            break;
-        case Type::Error:
-            put_error(c);
-            break;
-        case Type::Integer:
-            put_integer(c);
-            break;
-        case Type::BulkString:
-            put_bulk_string(c);
-            break;
-        case Type::Array:
-            put_array(c);
-            break;
         }
+        if (body_) {
+            put_body(c);
+            return;
+        }
+        if (c != '\n') {
+            check_char(c);
+            tok_ += c;
+            return;
+        }
+        if (!tok_.empty() && tok_.back() == '\r') {
+            tok_.pop_back();
+        }
+        on_line(tok_);
     }
 
+    // Default RESP3 handlers.
+
+    void on_resp_null() { derived()->on_resp_string({}); }
+    void on_resp_bool(bool b) { derived()->on_resp_integer(b ? 1 : 0); }
+    void on_resp_double(double d)
+    {
+        char buf[32];
+        const auto [end, ec] = std::to_chars(buf, buf + sizeof(buf), d);
+        derived()->on_resp_string({buf, static_cast<std::size_t>(end - buf)});
+    }
+    void on_resp_big_number(std::string_view sv) { derived()->on_resp_string(sv); }
+    void on_resp_verbatim(std::string_view format, std::string_view data)
+    {
+        derived()->on_resp_string(data);
+    }
+    /// Called at the start of every aggregate, including arrays. The size is the number of
+    /// entries, which for maps and attributes is the number of key/value pairs.
+    void on_resp_aggregate_begin(Type type, int n)
+    {
+        derived()->on_resp_array_begin(has_pairs(type) ? 2 * n : n);
+    }
+    void on_resp_aggregate_end(Type type) { derived()->on_resp_array_end(); }
+
   private:
-    void put_command_line(char c)
+    DerivedT* derived() noexcept { return static_cast<DerivedT*>(this); }
+    static constexpr Type to_type(char c) noexcept
     {
-        put_string(c, [this]() { static_cast<DerivedT*>(this)->on_resp_command_line(tok_); });
+        switch (c) {
+        case unbox(Type::SimpleString):
+        case unbox(Type::Error):
+        case unbox(Type::Integer):
+        case unbox(Type::BulkString):
+        case unbox(Type::Array):
+        case unbox(Type::Null):
+        case unbox(Type::Boolean):
+        case unbox(Type::Double):
+        case unbox(Type::BigNumber):
+        case unbox(Type::BlobError):
+        case unbox(Type::VerbatimString):
+        case unbox(Type::Map):
+        case unbox(Type::Set):
+        case unbox(Type::Attribute):
+        case unbox(Type::Push):
+            return Type{c};
+        default:
+            break;
+        }
+        return Type::CommandLine;
     }
-    void put_simple_string(char c)
+    static constexpr bool has_pairs(Type type) noexcept
     {
-        put_string(c, [this]() { static_cast<DerivedT*>(this)->on_resp_string(tok_); });
+        return type == Type::Map || type == Type::Attribute;
     }
-    void put_error(char c)
+    static constexpr bool is_digit(char c) noexcept { return c >= '0' && c <= '9'; }
+    /// Returns true if the line is accumulated without validation.
+    static constexpr bool is_text(Type type) noexcept
     {
-        put_string(c, [this]() { static_cast<DerivedT*>(this)->on_resp_error(tok_); });
+        switch (type) {
+        case Type::CommandLine:
+        case Type::SimpleString:
+        case Type::Error:
+        case Type::BigNumber:
+        case Type::Double:
+            return true;
+        default:
+            break;
+        }
+        return false;
     }
-    void put_integer(char c)
+    /// Integers and lengths are validated as they arrive.
+    void check_char(char c) const
     {
-        if (sign_ == 0) {
-            if (c == '+') {
-                sign_ = 1;
-                return;
-            }
-            if (c == '-') {
-                sign_ = -1;
+        if (is_text(type_) || is_digit(c) || c == '\r') {
+            return;
+        }
+        if (type_ == Type::Integer) {
+            if ((c == '+' || c == '-') && tok_.empty()) {
                 return;
             }
-            // Imply positive sign.
-            sign_ = 1;
+            // Fatal protocol exception.
+            throw Exception{"invalid integer"};
         }
-        if (c == '\r') {
-            // Ignore.
+        if (type_ == Type::Null || type_ == Type::Boolean) {
             return;
         }
-        if (c != '\n') {
-            if (c < '0' || c > '9') {
-                // Fatal protocol exception.
-                throw Exception{"invalid integer"};
-            }
-            num_ = num_ * 10 + (c - '0');
+        if (c == '-' && tok_.empty()) {
             return;
         }
-        flush([this]() { static_cast<DerivedT*>(this)->on_resp_integer(sign_ * num_); });
+        // Fatal protocol exception.
+        throw Exception{"invalid length"};
     }
-    void put_bulk_string(char c)
+    const char* resume(const char* it, const char* last)
     {
-        // TODO: add support for null bulk strings.
-        if (sign_ == 0) {
-            switch (c) {
-            case '\r':
-                // Ignore.
-                break;
-            case '\n':
-                sign_ = 1;
-                break;
-            default:
-                if (c < '0' || c > '9') {
-                    // Fatal protocol exception.
-                    throw Exception{"invalid length"};
-                }
-                num_ = num_ * 10 + (c - '0');
-                break;
+        if (body_) {
+            if (num_ > 0) {
+                // Append as much of the blob as is available.
+                const auto n = std::min<std::int64_t>(num_, last - it);
+                tok_.append(it, n);
+                num_ -= n;
+                return it + n;
             }
-            return;
+        } else if (is_text(type_)) {
+            if (const auto* const eol
+                = static_cast<const char*>(std::memchr(it, '\n', last - it))) {
+                tok_.append(it, eol);
+                parsed_ += eol + 1 - it;
+                put('\n');
+                return eol + 1;
+            }
+            tok_.append(it, last);
+            return last;
+        }
+        ++parsed_;
+        put(*it);
+        return it + 1;
+    }
+    /// Parse the token at the start of the range, where the range is not empty.
+    const char* parse_token(const char* it, const char* last)
+    {
+        const auto* const eol
+            = static_cast<const char*>(std::memchr(it + 1, '\n', last - it - 1));
+        if (!eol) {
+            // The line is incomplete, so accumulate the remainder.
+            ++parsed_;
+            put(*it);
+            return it + 1;
+        }
+        const auto* const next = eol + 1;
+        // The token is consumed before the callback, so that parsing may resume after it.
+        parsed_ += next - it;
+        type_ = to_type(*it);
+        if (type_ == Type::CommandLine) {
+            // The first character is part of the command line.
+            const auto* const end = eol[-1] == '\r' ? eol - 1 : eol;
+            on_line({it, static_cast<std::size_t>(end - it)});
+            return next;
+        }
+        const auto* const end = eol > it + 1 && eol[-1] == '\r' ? eol - 1 : eol;
+        on_line({it + 1, static_cast<std::size_t>(end - it - 1)});
+        if (!body_) {
+            return next;
         }
+        if (num_ <= last - next - 2) {
+            // Zero-copy: the whole blob is available in the input buffer.
+            const auto* const blob_end = next + num_;
+            if (blob_end[0] != '\r' || blob_end[1] != '\n') {
+                // Fatal protocol exception.
+                throw Exception{"invalid bulk string"};
+            }
+            parsed_ += num_ + 2;
+            on_blob({next, static_cast<std::size_t>(num_)});
+            return blob_end + 2;
+        }
+        // Accumulate the blob until the remainder arrives.
+        return next != last ? resume(next, last) : next;
+    }
+    void put_body(char c)
+    {
         if (num_ > 0) {
             tok_ += c;
             --num_;
@@ -178,28 +336,169 @@ class BasicParser {
             // Fatal protocol exception.
             throw Exception{"invalid bulk string"};
         }
-        flush([this]() { static_cast<DerivedT*>(this)->on_resp_string(tok_); });
+        on_blob(tok_);
     }
-    void put_array(char c)
+    /// Handle a complete line, excluding the type and line terminator.
+    void on_line(std::string_view line)
     {
-        if (c == '\r') {
-            // Ignore.
-            return;
+        switch (type_) {
+        case Type::CommandLine:
+            flush([this, line]() { derived()->on_resp_command_line(line); });
+            break;
+        case Type::SimpleString:
+            flush([this, line]() { derived()->on_resp_string(line); });
+            break;
+        case Type::Error:
+            flush([this, line]() { derived()->on_resp_error(line); });
+            break;
+        case Type::Integer: {
+            const auto i = parse_integer(line);
+            flush([this, i]() { derived()->on_resp_integer(i); });
+        } break;
+        case Type::Null:
+            flush([this]() { derived()->on_resp_null(); });
+            break;
+        case Type::Boolean:
+            if (line != "t" && line != "f") {
+                // Fatal protocol exception.
+                throw Exception{"invalid boolean"};
+            }
+            flush([this, b = line == "t"]() { derived()->on_resp_bool(b); });
+            break;
+        case Type::Double: {
+            const auto d = parse_double(line);
+            flush([this, d]() { derived()->on_resp_double(d); });
+        } break;
+        case Type::BigNumber:
+            if (line.empty() || !std::all_of(line.begin() + (line[0] == '-' ? 1 : 0), line.end(),
+                                             is_digit)) {
+                // Fatal protocol exception.
+                throw Exception{"invalid big number"};
+            }
+            flush([this, line]() { derived()->on_resp_big_number(line); });
+            break;
+        case Type::BulkString:
+        case Type::BlobError:
+        case Type::VerbatimString:
+            if (const auto len = parse_length(line, max_bulk_size()); len >= 0) {
+                // The line is no longer required, so the token holds the blob.
+                tok_.clear();
+                body_ = true;
+                num_ = len;
+            } else {
+                flush([this]() { derived()->on_resp_null(); });
+            }
+            break;
+        default:
+            if (const auto len = parse_length(line, std::numeric_limits<int>::max() / 2);
+                len >= 0) {
+                flush_aggregate(len);
+            } else {
+                flush([this]() { derived()->on_resp_null(); });
+            }
+            break;
         }
-        if (c != '\n') {
-            if (c < '0' || c > '9') {
+    }
+    void on_blob(std::string_view data)
+    {
+        switch (type_) {
+        case Type::BlobError:
+            flush([this, data]() { derived()->on_resp_error(data); });
+            break;
+        case Type::VerbatimString:
+            if (data.size() < 4 || data[3] != ':') {
+                // Fatal protocol exception.
+                throw Exception{"invalid verbatim string"};
+            }
+            flush([this, data]() {
+                derived()->on_resp_verbatim(data.substr(0, 3), data.substr(4));
+            });
+            break;
+        default:
+            flush([this, data]() { derived()->on_resp_string(data); });
+            break;
+        }
+    }
+    static std::int64_t parse_integer(std::string_view sv)
+    {
+        constexpr auto Min = std::numeric_limits<std::int64_t>::min();
+        bool neg{false};
+        if (!sv.empty() && (sv.front() == '+' || sv.front() == '-')) {
+            neg = sv.front() == '-';
+            sv.remove_prefix(1);
+        }
+        // Accumulate a negative number, so that the minimum value can be represented.
+        std::int64_t num{0};
+        for (const char c : sv) {
+            const int d{c - '0'};
+            if (!is_digit(c) || num < (Min + d) / 10) {
+                // Fatal protocol exception.
+                throw Exception{"invalid integer"};
+            }
+            num = num * 10 - d;
+        }
+        if (!neg) {
+            if (num == Min) {
+                // Fatal protocol exception.
+                throw Exception{"invalid integer"};
+            }
+            num = -num;
+        }
+        return num;
+    }
+    /// Returns -1 for a null. Lengths greater than max are rejected.
+    static std::int64_t parse_length(std::string_view sv, std::size_t max)
+    {
+        if (sv == "-1") {
+            return -1;
+        }
+        const auto lim = static_cast<std::int64_t>(
+            std::min<std::size_t>(max, std::numeric_limits<std::int64_t>::max()));
+        std::int64_t num{0};
+        for (const char c : sv) {
+            const int d{c - '0'};
+            if (!is_digit(c) || num > lim / 10 || num * 10 > lim - d) {
                 // Fatal protocol exception.
                 throw Exception{"invalid length"};
             }
-            num_ = num_ * 10 + (c - '0');
-            return;
+            num = num * 10 + d;
+        }
+        return num;
+    }
+    static double parse_double(std::string_view sv)
+    {
+        // The from_chars function does not accept a leading plus sign.
+        if (!sv.empty() && sv.front() == '+') {
+            sv.remove_prefix(1);
+        }
+        double d{0};
+        const auto [end, ec] = std::from_chars(sv.data(), sv.data() + sv.size(), d);
+        if (ec != std::errc{} || end != sv.data() + sv.size()) {
+            // Fatal protocol exception.
+            throw Exception{"invalid double"};
+        }
+        return d;
+    }
+    void flush_aggregate(std::int64_t n)
+    {
+        const auto type = type_;
+        if (n > std::numeric_limits<int>::max() / 2) {
+            // Fatal protocol exception.
+            throw Exception{"invalid length"};
         }
         bool ok{false};
+        // Empty aggregates are complete, and attributes are not counted as an element of the
+        // enclosing aggregate.
+        const bool complete{n == 0};
         int popped{0};
-        if (num_ > 0) {
-            stack_.push(num_);
+        if (!complete) {
+            if (stack_.size() >= max_depth_) {
+                // Fatal protocol exception.
+                throw Exception{"maximum nesting depth exceeded"};
+            }
+            stack_.push({has_pairs(type) ? 2 * n : n, type});
         } else {
-            popped = 1 + pop_if_end();
+            popped = 1 + (type != Type::Attribute ? pop_if_end() : clear_popped());
         }
         const auto finally = make_finally([&]() noexcept {
             if (!ok) {
@@ -208,7 +507,7 @@ class BasicParser {
                 } else if (popped > 0) {
                     assert(!ok && is_top_level() && popped > 0);
                     // Callback must be noexcept.
-                    static_cast<DerivedT*>(this)->on_resp_reset(); // noexcept
+                    derived()->on_resp_reset(); // noexcept
                 }
             }
             clear_tok();
@@ -217,29 +516,18 @@ class BasicParser {
         if (bad_) [[unlikely]] {
             if (is_top_level() && popped > 0) {
                 bad_ = false;
-                static_cast<DerivedT*>(this)->on_resp_reset(); // noexcept
+                derived()->on_resp_reset(); // noexcept
             }
         } else {
-            static_cast<DerivedT*>(this)->on_resp_array_begin(num_);
-            for (int i{0}; i < popped; ++i) {
-                static_cast<DerivedT*>(this)->on_resp_array_end();
+            derived()->on_resp_aggregate_begin(type, static_cast<int>(n));
+            if (complete) {
+                derived()->on_resp_aggregate_end(type);
+                end_popped();
             }
         }
         ok = true;
     }
     template <typename FnT>
-    void put_string(char c, FnT fn)
-    {
-        if (c != '\n') {
-            tok_ += c;
-            return;
-        }
-        if (!tok_.empty() && tok_.back() == '\r') {
-            tok_.pop_back();
-        }
-        flush(fn);
-    }
-    template <typename FnT>
     void flush(FnT fn)
     {
         bool ok{false};
@@ -251,7 +539,7 @@ class BasicParser {
                 } else if (popped > 0) {
                     assert(!ok && is_top_level() && popped > 0);
                     // Callback must be noexcept.
-                    static_cast<DerivedT*>(this)->on_resp_reset(); // noexcept
+                    derived()->on_resp_reset(); // noexcept
                 }
             }
             clear_tok();
@@ -260,13 +548,11 @@ class BasicParser {
         if (bad_) [[unlikely]] {
             if (is_top_level() && popped > 0) {
                 bad_ = false;
-                static_cast<DerivedT*>(this)->on_resp_reset(); // noexcept
+                derived()->on_resp_reset(); // noexcept
             }
         } else {
             fn();
-            for (int i{0}; i < popped; ++i) {
-                static_cast<DerivedT*>(this)->on_resp_array_end();
-            }
+            end_popped();
         }
         ok = true;
     }
@@ -274,28 +560,51 @@ class BasicParser {
     void clear_tok() noexcept
     {
         type_ = Type::None;
-        sign_ = 0;
+        body_ = false;
         num_ = 0;
         tok_.clear();
     }
     /// Returns the number of levels in the stack that were popped or unwound.
     int pop_if_end() noexcept
     {
-        int n{0};
-        while (!stack_.empty() && --stack_.top() == 0) {
+        popped_.clear();
+        while (!stack_.empty() && --stack_.top().remaining == 0) {
+            const auto type = stack_.top().type;
             stack_.pop();
-            ++n;
+            popped_.push_back(type);
+            if (type == Type::Attribute) {
+                // The attribute is not an element of the enclosing aggregate.
+                break;
+            }
+        }
+        return static_cast<int>(popped_.size());
+    }
+    int clear_popped() noexcept
+    {
+        popped_.clear();
+        return 0;
+    }
+    /// Notify the end of each level that was popped.
+    void end_popped()
+    {
+        for (const auto type : popped_) {
+            derived()->on_resp_aggregate_end(type);
         }
-        return n;
     }
     /// The bad flag is set when an application exception occurs while processing an array.
     /// The bad flag is reset when the parser has finished processing the array.
     bool bad_{false};
     Type type_{Type::None};
-    int sign_{0};
+    /// True while the payload of a bulk string or blob is being accumulated.
+    bool body_{false};
     std::int64_t num_{0};
     std::string tok_;
     Stack stack_;
+    std::size_t max_depth_{DefaultMaxDepth};
+    std::size_t max_bulk_size_{DefaultMaxBulkSize};
+    /// Types of the levels that were popped by the last token.
+    boost::container::small_vector<Type, 8> popped_;
+    std::size_t parsed_{0};
 };
 
 } // namespace resp
@@ -18,6 +18,8 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <sstream>
+
 using namespace std;
 using namespace toolbox;
 
@@ -58,14 +60,43 @@ class Parser : BasicParser<Parser> {
         }
         return result_;
     }
+    /// As above, but the input is parsed a buffer at a time, where each exception marker splits
+    /// the input into a separate buffer.
+    std::string parse_buf(string_view data)
+    {
+        for (;;) {
+            const auto pos = data.find('!');
+            parse_all(data.substr(0, pos));
+            if (pos == string_view::npos) {
+                break;
+            }
+            except_ = true;
+            data.remove_prefix(pos + 1);
+        }
+        return result_;
+    }
 
   private:
-    void on_resp_command_line(const string& line)
+    void parse_all(string_view data)
+    {
+        for (;;) {
+            try {
+                BasicParser::parse({data.data(), data.size()});
+                break;
+            } catch (const resp::Exception&) {
+                throw;
+            } catch (const exception& e) {
+                result_ += '!';
+                data.remove_prefix(parsed());
+            }
+        }
+    }
+    void on_resp_command_line(string_view line)
     {
         throw_if_except();
         result_ = line;
     }
-    void on_resp_string(const string& s)
+    void on_resp_string(string_view s)
     {
         if (!result_.empty() && result_.back() != '[') {
             result_ += ',';
@@ -74,7 +105,7 @@ class Parser : BasicParser<Parser> {
         result_ += '+';
         result_ += s;
     }
-    void on_resp_error(const string& e)
+    void on_resp_error(string_view e)
     {
         if (!result_.empty() && result_.back() != '[') {
             result_ += ',';
@@ -122,7 +153,99 @@ class Parser : BasicParser<Parser> {
 std::string parse(string_view data)
 {
     Parser p;
-    return p.parse(data);
+    auto result = p.parse(data);
+    // The buffer path must produce the same callbacks.
+    Parser q;
+    BOOST_TEST(q.parse_buf(data) == result);
+    return result;
+}
+
+/// Parser for RESP3 test-cases, which handles each RESP3 event. The results use the RESP type
+/// characters, except that aggregates are enclosed in brackets, and maps in braces.
+class Resp3Parser : BasicParser<Resp3Parser> {
+    friend class BasicParser<Resp3Parser>;
+
+  public:
+    using BasicParser::DefaultMaxDepth;
+    using BasicParser::set_max_depth;
+    using BasicParser::set_max_bulk_size;
+    std::string put_all(string_view data)
+    {
+        for (const auto c : data) {
+            put(c);
+        }
+        return result_;
+    }
+    std::string parse_all(string_view data)
+    {
+        parse({data.data(), data.size()});
+        return result_;
+    }
+
+  private:
+    void token(char type, string_view s = {})
+    {
+        if (!result_.empty() && result_.back() != '[' && result_.back() != '{') {
+            result_ += ',';
+        }
+        result_ += type;
+        result_ += s;
+    }
+    void on_resp_command_line(string_view line) { token('\1', line); }
+    void on_resp_string(string_view s) { token('+', s); }
+    void on_resp_error(string_view e) { token('-', e); }
+    void on_resp_integer(int64_t i) { token(':', to_string(i)); }
+    void on_resp_null() { token('_'); }
+    void on_resp_bool(bool b) { token('#', b ? "t" : "f"); }
+    void on_resp_double(double d)
+    {
+        ostringstream os;
+        os << d;
+        token(',', os.str());
+    }
+    void on_resp_big_number(string_view sv) { token('(', sv); }
+    void on_resp_verbatim(string_view format, string_view data)
+    {
+        token('=', string{format} + ':' + string{data});
+    }
+    void on_resp_aggregate_begin(Type type, int n)
+    {
+        switch (type) {
+        case Type::Array:
+            token('[');
+            break;
+        case Type::Map:
+            token('{');
+            break;
+        default:
+            token(unbox(type), "[");
+            break;
+        }
+    }
+    void on_resp_aggregate_end(Type type) { result_ += type == Type::Map ? '}' : ']'; }
+    void on_resp_reset() noexcept { result_ += '~'; }
+    string result_;
+};
+
+/// Parse the data with both the per-character and buffer paths, which must agree.
+std::string parse3(string_view data, size_t max_depth = Resp3Parser::DefaultMaxDepth)
+{
+    Resp3Parser p, q;
+    p.set_max_depth(max_depth);
+    q.set_max_depth(max_depth);
+    auto result = p.put_all(data);
+    BOOST_TEST(q.parse_all(data) == result);
+    return result;
+}
+
+/// Parse the data in two buffers, split at every position.
+void check_split(string_view data, string_view expected)
+{
+    for (size_t i{0}; i <= data.size(); ++i) {
+        Parser p;
+        p.parse_buf(data.substr(0, i));
+        BOOST_TEST(p.parse_buf(data.substr(i)) == expected);
+    }
 }
 
 } // namespace
@@ -207,4 +330,92 @@ BOOST_AUTO_TEST_CASE(MultiArrayCase)
                == "[:1,[:11,[!~,+OK");
 }
 
+BOOST_AUTO_TEST_CASE(SplitCase)
+{
+    check_split("+OK\r\n-ERR\r\n:-123\r\n$6\r\nfoobar\r\n"sv, "+OK,-ERR,:-123,+foobar");
+    check_split("*3\r\n:1\r\n*2\r\n$3\r\nfoo\r\n$0\r\n\r\n+bar\r\n"sv,
+                "[:1,[+foo,+],+bar]");
+    check_split("PING\r\n"sv, "PING");
+}
+
+BOOST_AUTO_TEST_CASE(NullCase)
+{
+    BOOST_TEST(parse3("_\r\n"sv) == "_");
+    BOOST_TEST(parse3("$-1\r\n"sv) == "_");
+    BOOST_TEST(parse3("*-1\r\n"sv) == "_");
+    BOOST_TEST(parse3("*3\r\n$-1\r\n_\r\n$0\r\n\r\n"sv) == "[_,_,+]");
+    // Nulls are empty strings by default.
+    BOOST_TEST(parse("*2\r\n$-1\r\n:1\r\n"sv) == "[+,:1]");
+}
+
+BOOST_AUTO_TEST_CASE(Resp3ScalarCase)
+{
+    BOOST_TEST(parse3("#t\r\n#f\r\n"sv) == "#t,#f");
+    BOOST_TEST(parse3(",1.5\r\n,-2\r\n,inf\r\n,-inf\r\n"sv) == ",1.5,,-2,,inf,,-inf");
+    BOOST_TEST(parse3("(3492890328409238509324850943850943825024385\r\n"sv)
+               == "(3492890328409238509324850943850943825024385");
+    BOOST_TEST(parse3("!21\r\nSYNTAX invalid syntax\r\n"sv) == "-SYNTAX invalid syntax");
+    BOOST_TEST(parse3("=15\r\ntxt:Some string\r\n"sv) == "=txt:Some string");
+    // Without RESP3 handlers, the values are mapped onto the RESP2 callbacks.
+    BOOST_TEST(parse("#t\r\n,1.5\r\n(123\r\n=7\r\ntxt:foo\r\n"sv) == ":1,+1.5,+123,+foo");
+
+    BOOST_CHECK_THROW(parse3("#x\r\n"sv), resp::Exception);
+    BOOST_CHECK_THROW(parse3(",1.5x\r\n"sv), resp::Exception);
+    BOOST_CHECK_THROW(parse3("(12a\r\n"sv), resp::Exception);
+    BOOST_CHECK_THROW(parse3("=3\r\nfoo\r\n"sv), resp::Exception);
+}
+
+BOOST_AUTO_TEST_CASE(Resp3AggregateCase)
+{
+    BOOST_TEST(parse3("%2\r\n+first\r\n:1\r\n+second\r\n:2\r\n"sv)
+               == "{+first,:1,+second,:2}");
+    BOOST_TEST(parse3("~2\r\n+a\r\n+b\r\n"sv) == "~[+a,+b]");
+    BOOST_TEST(parse3(">2\r\n+message\r\n+hello\r\n"sv) == ">[+message,+hello]");
+    BOOST_TEST(parse3("%0\r\n~0\r\n"sv) == "{},~[]");
+    BOOST_TEST(parse3("*2\r\n%1\r\n+k\r\n~1\r\n#t\r\n:2\r\n"sv) == "[{+k,~[#t]},:2]");
+    // The attribute is not counted as an element of the enclosing array.
+    BOOST_TEST(parse3("*2\r\n|1\r\n+ttl\r\n:3600\r\n+a\r\n+b\r\n"sv)
+               == "[|[+ttl,:3600],+a,+b]");
+    BOOST_TEST(parse3("*1\r\n|0\r\n+a\r\n"sv) == "[|[],+a]");
+    // Maps are flattened into arrays by default.
+    BOOST_TEST(parse("%1\r\n+k\r\n+v\r\n"sv) == "[+k,+v]");
+}
+
+BOOST_AUTO_TEST_CASE(MaxDepthCase)
+{
+    BOOST_TEST(parse3("*1\r\n*1\r\n*0\r\n"sv, 2) == "[[[]]]");
+    BOOST_CHECK_THROW(parse3("*1\r\n*1\r\n*1\r\n:1\r\n"sv, 2), resp::Exception);
+
+    // The default limit protects against deeply nested input.
+    string deep;
+    for (size_t i{0}; i < Resp3Parser::DefaultMaxDepth + 1; ++i) {
+        deep += "*1\r\n";
+    }
+    BOOST_CHECK_THROW(parse3(deep), resp::Exception);
+}
+
+BOOST_AUTO_TEST_CASE(MaxLengthCase)
+{
+    BOOST_TEST(parse(":9223372036854775807\r\n"sv) == ":9223372036854775807");
+    BOOST_TEST(parse(":-9223372036854775808\r\n"sv) == ":-9223372036854775808");
+    BOOST_CHECK_THROW(parse(":9223372036854775808\r\n"sv), resp::Exception);
+    BOOST_CHECK_THROW(parse(":-9223372036854775809\r\n"sv), resp::Exception);
+    BOOST_CHECK_THROW(parse(":99999999999999999999\r\n"sv), resp::Exception);
+
+    // The bulk string is incomplete, but its length is within the default limit.
+    BOOST_TEST(parse("$536870912\r\n"sv) == "");
+    BOOST_CHECK_THROW(parse("$536870913\r\n"sv), resp::Exception);
+    BOOST_CHECK_THROW(parse("$9223372036854775807\r\n"sv), resp::Exception);
+    BOOST_CHECK_THROW(parse("$99999999999999999999\r\n"sv), resp::Exception);
+
+    BOOST_CHECK_THROW(parse("*1073741824\r\n"sv), resp::Exception);
+    BOOST_CHECK_THROW(parse("*9223372036854775807\r\n"sv), resp::Exception);
+    BOOST_CHECK_THROW(parse("*99999999999999999999\r\n"sv), resp::Exception);
+
+    Resp3Parser p;
+    p.set_max_bulk_size(3);
+    BOOST_TEST(p.parse_all("$3\r\nfoo\r\n"sv) == "+foo");
+    BOOST_CHECK_THROW(p.parse_all("$4\r\nfoo!\r\n"sv), resp::Exception);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,302 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "RespClnt.hpp"
+
+#include <toolbox/sys/Log.hpp>
+
+namespace toolbox {
+inline namespace resp {
+using namespace std;
+namespace {
+
+error_code to_error_code(const exception& e) noexcept
+{
+    if (const auto* se = dynamic_cast<const system_error*>(&e)) {
+        return se->code();
+    }
+    if (dynamic_cast<const Exception*>(&e)) {
+        return make_error_code(errc::bad_message);
+    }
+    return make_error_code(errc::io_error);
+}
+
+} // namespace
+
+RespClnt::RespClnt(CyclTime now, Reactor& r, const Endpoint& ep, RespClntOptions opts)
+: reactor_{r}
+, ep_{ep}
+, opts_{opts}
+, hook_{bind<&RespClnt::on_flush>(this)}
+{
+    open(now);
+}
+
+RespClnt::~RespClnt()
+{
+    closed_ = true;
+    fail(CyclTime::current(), make_error_code(errc::operation_canceled));
+}
+
+void RespClnt::on_sock_connect(CyclTime now, IoSock&& sock, const Endpoint& ep)
+{
+    connecting_ = false;
+    connected_ = true;
+    sock_ = std::move(sock);
+    sub_ = reactor_.subscribe(*sock_, EpollIn, bind<&RespClnt::on_io_event>(this));
+    if (!out_.empty()) {
+        // Send the commands that were issued while disconnected.
+        try {
+            flush_output(now);
+        } catch (const std::exception& e) {
+            close(now, to_error_code(e), opts_.reconnect_interval);
+        }
+    }
+}
+
+void RespClnt::on_sock_connect_error(CyclTime now, const std::exception& e)
+{
+    connecting_ = false;
+    TOOLBOX_WARN << "resp client failed to connect: " << e.what();
+    // Outstanding commands are held until they time out.
+    if (!closed_) {
+        reconnect_tmr_ = reactor_.timer(now.mono_time() + opts_.reconnect_interval, Priority::Low,
+                                        bind<&RespClnt::on_reconnect_timer>(this));
+    }
+}
+
+void RespClnt::on_io_event(CyclTime now, int fd, unsigned events)
+{
+    try {
+        if (events & (EpollIn | EpollHup)) {
+            if (!drain_input(now, fd)) {
+                close(now, make_error_code(errc::connection_reset), opts_.reconnect_interval);
+                return;
+            }
+        }
+        if (write_blocked_ && (events & EpollOut)) {
+            flush_output(now);
+        }
+    } catch (const std::exception& e) {
+        close(now, to_error_code(e), opts_.reconnect_interval);
+    }
+}
+
+void RespClnt::on_flush(CyclTime now)
+{
+    hook_.unlink();
+    if (connected_ && !write_blocked_) {
+        try {
+            flush_output(now);
+        } catch (const std::exception& e) {
+            close(now, to_error_code(e), opts_.reconnect_interval);
+        }
+    }
+}
+
+void RespClnt::on_timeout_timer(CyclTime now, Timer& tmr)
+{
+    // Release the expired timer, so that a command issued by a handler will arm a new one.
+    timeout_tmr_.reset();
+    if (pending_.empty()) {
+        return;
+    }
+    const auto deadline = pending_.front().deadline;
+    if (deadline > now.mono_time()) {
+        timeout_tmr_
+            = reactor_.timer(deadline, Priority::Low, bind<&RespClnt::on_timeout_timer>(this));
+        return;
+    }
+    // Later replies can no longer be matched, so reconnect immediately.
+    close(now, make_error_code(errc::timed_out), {});
+}
+
+void RespClnt::on_reconnect_timer(CyclTime now, Timer& tmr)
+{
+    open(now);
+}
+
+void RespClnt::on_resp_aggregate_begin(Type type, int n)
+{
+    if (skip_ > 0 || type == Type::Attribute || (type == Type::Push && depth_ == 0)) {
+        ++skip_;
+        return;
+    }
+    reply_.push(type, n, 0, {});
+    ++depth_;
+}
+
+void RespClnt::on_resp_aggregate_end(Type type)
+{
+    if (skip_ > 0) {
+        --skip_;
+        return;
+    }
+    if (--depth_ == 0) {
+        on_reply();
+    }
+}
+
+void RespClnt::on_resp_reset() noexcept
+{
+    depth_ = 0;
+    skip_ = 0;
+    reply_.clear();
+}
+
+void RespClnt::on_value(Type type, int64_t integer, double real, string_view str)
+{
+    if (skip_ > 0) {
+        return;
+    }
+    reply_.push(type, integer, real, str);
+    if (depth_ == 0) {
+        on_reply();
+    }
+}
+
+void RespClnt::on_reply()
+{
+    if (pending_.empty()) {
+        // Fatal protocol exception.
+        throw Exception{"unexpected reply"};
+    }
+    const auto handler = pending_.front().handler;
+    pending_.pop_front();
+    try {
+        handler(CyclTime::current(), {}, reply_);
+    } catch (const std::exception& e) {
+        TOOLBOX_ERROR << "exception in resp reply handler: " << e.what();
+    }
+    reply_.clear();
+}
+
+void RespClnt::push(CyclTime now, Handler handler)
+{
+    pending_.push_back({handler, now.mono_time() + opts_.timeout});
+    if (!timeout_tmr_.pending()) {
+        timeout_tmr_ = reactor_.timer(pending_.front().deadline, Priority::Low,
+                                      bind<&RespClnt::on_timeout_timer>(this));
+    }
+    // Commands issued within the same reactor cycle are written together at the end of the cycle.
+    if (connected_ && !write_blocked_ && !hook_.is_linked()) {
+        reactor_.add_hook(hook_);
+    }
+}
+
+void RespClnt::open(CyclTime now)
+{
+    if (connected_ || connecting_ || closed_) {
+        return;
+    }
+    // The connection may be established synchronously, in which case on_sock_connect() is called
+    // before connect() returns.
+    connecting_ = true;
+    try {
+        connect(now, reactor_, ep_);
+    } catch (const std::exception& e) {
+        on_sock_connect_error(now, e);
+    }
+}
+
+bool RespClnt::drain_input(CyclTime now, int fd)
+{
+    bool eof{false};
+    // Limit the number of reads to avoid starvation.
+    for (int i{0}; i < 4; ++i) {
+        error_code ec;
+        const auto buf = in_.prepare(16384);
+        const auto size = os::read(fd, buf, ec);
+        if (ec) {
+            // No data available in socket buffer.
+            if (ec == errc::operation_would_block) {
+                break;
+            }
+            throw system_error{ec, "read"};
+        }
+        if (size == 0) {
+            eof = true;
+            break;
+        }
+        // Commit actual bytes read.
+        in_.commit(size);
+        // Assume that the TCP stream has been drained if we read less than the requested amount.
+        if (static_cast<size_t>(size) < buffer_size(buf)) {
+            break;
+        }
+    }
+    in_.consume(parse(in_.data()));
+    return !eof;
+}
+
+void RespClnt::flush_output(CyclTime now)
+{
+    error_code ec;
+    // Report a closed connection as an error rather than raising SIGPIPE.
+    const auto size = sock_.send(out_.data(), MSG_NOSIGNAL, ec);
+    if (ec) {
+        if (ec != errc::operation_would_block) {
+            throw system_error{ec, "write"};
+        }
+    } else {
+        out_.consume(size);
+    }
+    const bool blocked{!out_.empty()};
+    if (blocked != write_blocked_) {
+        // Poll for writability until the output buffer has been drained.
+        sub_.set_events(blocked ? EpollIn | EpollOut : EpollIn);
+        write_blocked_ = blocked;
+    }
+}
+
+void RespClnt::close(CyclTime now, error_code ec, Duration delay) noexcept
+{
+    if (connected_) {
+        hook_.unlink();
+        sub_.reset();
+        sock_.close();
+        connected_ = false;
+        write_blocked_ = false;
+        // Discard any partial reply.
+        static_cast<BasicParser<RespClnt>&>(*this) = {};
+        on_resp_reset();
+        in_.clear();
+    }
+    // Partially written commands cannot be resumed on a new connection.
+    out_.clear();
+    fail(now, ec);
+    if (!connecting_ && !closed_) {
+        reconnect_tmr_ = reactor_.timer(now.mono_time() + delay, Priority::Low,
+                                        bind<&RespClnt::on_reconnect_timer>(this));
+    }
+}
+
+void RespClnt::fail(CyclTime now, error_code ec) noexcept
+{
+    // Handlers may issue new commands, which must not be failed with this error.
+    auto pending = std::move(pending_);
+    pending_.clear();
+    const RespReply reply;
+    for (const auto& p : pending) {
+        try {
+            p.handler(now, ec, reply);
+        } catch (const std::exception& e) {
+            TOOLBOX_ERROR << "exception in resp reply handler: " << e.what();
+        }
+    }
+}
+
+} // namespace resp
+} // namespace toolbox
@@ -0,0 +1,164 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_RESP_RESPCLNT_HPP
+#define TOOLBOX_RESP_RESPCLNT_HPP
+
+#include <toolbox/resp/Encoder.hpp>
+#include <toolbox/resp/RespReply.hpp>
+
+#include <toolbox/io/Hook.hpp>
+#include <toolbox/net/IoSock.hpp>
+#include <toolbox/net/StreamConnector.hpp>
+
+#include <deque>
+
+namespace toolbox {
+inline namespace resp {
+
+struct RespClntOptions {
+    /// Time allowed for a reply, including any time spent waiting for a connection.
+    Duration timeout{std::chrono::seconds{5}};
+    /// Delay before reconnecting once the connection has been lost.
+    Duration reconnect_interval{std::chrono::seconds{1}};
+};
+
+/// RespClnt is a non-blocking, pipelined client for Redis-compatible servers.
+///
+/// Commands are encoded directly into the output buffer, and all of the commands issued within a
+/// reactor cycle are written together at the end of the cycle. Replies are matched to commands
+/// in order. Commands issued while the client is disconnected are held until the connection has
+/// been re-established, subject to their timeout.
+///
+/// If a reply is not received in time, then the outstanding commands fail with
+/// std::errc::timed_out, and the connection is closed and re-established, because later replies
+/// can no longer be matched. Attributes and RESP3 push messages are skipped. All handlers are
+/// called on the reactor thread.
+class TOOLBOX_API RespClnt
+: public StreamConnector<RespClnt>
+, BasicParser<RespClnt> {
+
+    friend StreamConnector<RespClnt>;
+    friend class BasicParser<RespClnt>;
+
+  public:
+    /// The handler is called once for each command. The error code is set if the command failed,
+    /// in which case the reply is empty. Error replies are not failures, and are delivered with
+    /// an empty error code. Handlers must not throw.
+    using Handler = BasicSlot<CyclTime, std::error_code, const RespReply&>;
+
+    RespClnt(CyclTime now, Reactor& r, const Endpoint& ep, RespClntOptions opts = {});
+    ~RespClnt();
+
+    // Copy.
+    RespClnt(const RespClnt&) = delete;
+    RespClnt& operator=(const RespClnt&) = delete;
+
+    // Move.
+    RespClnt(RespClnt&&) = delete;
+    RespClnt& operator=(RespClnt&&) = delete;
+
+    const Endpoint& endpoint() const noexcept { return ep_; }
+    bool is_connected() const noexcept { return connected_; }
+    /// Returns the number of commands awaiting a reply.
+    std::size_t pending() const noexcept { return pending_.size(); }
+
+    /// Send a command whose arguments are any mix of strings and integers, for example
+    /// send(now, handler, "INCR", key).
+    template <typename... ArgsT>
+    void send(CyclTime now, Handler handler, const ArgsT&... args)
+    {
+        enc_.put(args...);
+        push(now, handler);
+    }
+    void send(CyclTime now, std::span<const std::string_view> args, Handler handler)
+    {
+        enc_.put_command(args);
+        push(now, handler);
+    }
+
+  private:
+    struct Pending {
+        Handler handler;
+        MonoTime deadline;
+    };
+
+    void on_sock_prepare(CyclTime now, IoSock& sock) {}
+    void on_sock_connect(CyclTime now, IoSock&& sock, const Endpoint& ep);
+    void on_sock_connect_error(CyclTime now, const std::exception& e);
+    void on_io_event(CyclTime now, int fd, unsigned events);
+    /// Called at the end of the reactor cycle in which commands were issued.
+    void on_flush(CyclTime now);
+    void on_timeout_timer(CyclTime now, Timer& tmr);
+    void on_reconnect_timer(CyclTime now, Timer& tmr);
+
+    void on_resp_command_line(std::string_view line)
+    {
+        throw Exception{"invalid reply type"};
+    }
+    void on_resp_string(std::string_view s) { on_value(Type::BulkString, 0, 0, s); }
+    void on_resp_error(std::string_view e) { on_value(Type::Error, 0, 0, e); }
+    void on_resp_integer(std::int64_t i) { on_value(Type::Integer, i, 0, {}); }
+    void on_resp_null() { on_value(Type::Null, 0, 0, {}); }
+    void on_resp_bool(bool b) { on_value(Type::Boolean, b ? 1 : 0, 0, {}); }
+    void on_resp_double(double d) { on_value(Type::Double, 0, d, {}); }
+    void on_resp_big_number(std::string_view sv) { on_value(Type::BigNumber, 0, 0, sv); }
+    void on_resp_verbatim(std::string_view format, std::string_view data)
+    {
+        on_value(Type::VerbatimString, 0, 0, data);
+    }
+    void on_resp_aggregate_begin(Type type, int n);
+    void on_resp_aggregate_end(Type type);
+    void on_resp_array_begin(int n) {}
+    void on_resp_array_end() {}
+    void on_resp_reset() noexcept;
+    void on_value(Type type, std::int64_t integer, double real, std::string_view str);
+    /// Deliver the completed reply to the handler of the oldest command.
+    void on_reply();
+
+    /// Record a command that has been encoded into the output buffer.
+    void push(CyclTime now, Handler handler);
+    /// Open a connection unless one is already open or in progress.
+    void open(CyclTime now);
+    /// Returns false if the peer has closed the connection.
+    bool drain_input(CyclTime now, int fd);
+    void flush_output(CyclTime now);
+    /// Close the connection, fail the outstanding commands, and reconnect after the delay.
+    void close(CyclTime now, std::error_code ec, Duration delay) noexcept;
+    /// Fail all outstanding commands with the given error.
+    void fail(CyclTime now, std::error_code ec) noexcept;
+
+    Reactor& reactor_;
+    const Endpoint ep_;
+    const RespClntOptions opts_;
+    IoSock sock_;
+    Reactor::Handle sub_;
+    Hook hook_;
+    /// The timeout timer is armed for the oldest command, and is re-armed lazily when it fires so
+    /// that it need not be rescheduled for each reply.
+    Timer timeout_tmr_, reconnect_tmr_;
+    Buffer in_, out_;
+    Encoder enc_{out_};
+    std::deque<Pending> pending_;
+    /// The reply under construction.
+    RespReply reply_;
+    int depth_{0}, skip_{0};
+    bool connected_{false}, connecting_{false}, write_blocked_{false}, closed_{false};
+};
+
+} // namespace resp
+} // namespace toolbox
+
+#endif // TOOLBOX_RESP_RESPCLNT_HPP
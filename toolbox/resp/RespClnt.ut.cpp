@@ -0,0 +1,286 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "RespClnt.hpp"
+
+#include <toolbox/net/StreamAcceptor.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+
+#include <unistd.h>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+/// TestConn is a stand-in for a RESP server connection.
+class TestConn : BasicParser<TestConn> {
+    friend class BasicParser<TestConn>;
+
+  public:
+    TestConn(Reactor& r, IoSock&& sock, int& reads)
+    : sock_{std::move(sock)}
+    , reads_{reads}
+    {
+        sub_ = r.subscribe(*sock_, EpollIn, bind<&TestConn::on_io_event>(this));
+    }
+
+  private:
+    void on_io_event(CyclTime now, int fd, unsigned events)
+    {
+        error_code ec;
+        const auto buf = in_.prepare(16384);
+        const auto size = os::read(fd, buf, ec);
+        if (ec || size == 0) {
+            close();
+            return;
+        }
+        ++reads_;
+        in_.commit(size);
+        in_.consume(parse(in_.data()));
+        if (!out_.empty()) {
+            sock_.send(out_.data(), MSG_NOSIGNAL, ec);
+            out_.clear();
+        }
+        if (close_) {
+            close();
+        }
+    }
+    void close()
+    {
+        sub_.reset();
+        sock_.close();
+    }
+    void on_resp_command_line(string_view line) {}
+    void on_resp_string(string_view s) { args_.emplace_back(s); }
+    void on_resp_error(string_view e) {}
+    void on_resp_integer(int64_t i) {}
+    void on_resp_array_begin(int n) { args_.clear(); }
+    void on_resp_array_end()
+    {
+        const auto& cmd = args_.front();
+        if (stalled_) {
+            // Replies are in order, so nothing further is answered after a slow command.
+            return;
+        }
+        if (cmd == "PING") {
+            put("+PONG\r\n");
+        } else if (cmd == "ECHO") {
+            enc_.put_bulk(args_.at(1));
+        } else if (cmd == "NESTED") {
+            // A push message, then an array with an attribute on its first element.
+            put(">2\r\n+pubsub\r\n+msg\r\n"
+                "*2\r\n|1\r\n+key\r\n+value\r\n:1\r\n*1\r\n$1\r\nx\r\n");
+        } else if (cmd == "CLOSE") {
+            close_ = true;
+        } else if (cmd == "SLOW") {
+            stalled_ = true;
+        } else {
+            put("-ERR unknown command\r\n");
+        }
+    }
+    void on_resp_reset() noexcept {}
+    void put(string_view sv)
+    {
+        const auto buf = out_.prepare(sv.size());
+        memcpy(buffer_cast<char*>(buf), sv.data(), sv.size());
+        out_.commit(sv.size());
+    }
+
+    IoSock sock_;
+    int& reads_;
+    Reactor::Handle sub_;
+    Buffer in_, out_;
+    resp::Encoder enc_{out_};
+    vector<string> args_;
+    bool close_{false}, stalled_{false};
+};
+
+class TestServ : public StreamAcceptor<TestServ> {
+    friend StreamAcceptor<TestServ>;
+
+  public:
+    TestServ(Reactor& r, const Endpoint& ep)
+    : StreamAcceptor{r, ep}
+    , reactor_{r}
+    {
+    }
+    /// Returns the number of reads that returned data.
+    int reads() const noexcept { return reads_; }
+
+  private:
+    void on_sock_prepare(CyclTime now, IoSock& sock) {}
+    void on_sock_accept(CyclTime now, IoSock&& sock, const Endpoint& ep)
+    {
+        conns_.push_back(make_unique<TestConn>(reactor_, std::move(sock), reads_));
+    }
+
+    Reactor& reactor_;
+    vector<unique_ptr<TestConn>> conns_;
+    int reads_{0};
+};
+
+struct Result {
+    error_code ec;
+    Type type{Type::None};
+    string str;
+    int64_t integer{0};
+};
+
+class Handler {
+  public:
+    void on_reply(CyclTime now, error_code ec, const RespReply& reply)
+    {
+        results.push_back({ec, reply.type(), string{reply.str()}, reply.integer()});
+        replies.push_back(reply);
+    }
+    vector<Result> results;
+    vector<RespReply> replies;
+};
+
+struct Fixture {
+    Fixture() { unlink(path.c_str()); }
+    ~Fixture() { unlink(path.c_str()); }
+    /// Poll the reactor until the predicate is satisfied or a second has elapsed.
+    template <typename FnT>
+    bool poll_until(FnT fn)
+    {
+        const auto end = MonoClock::now() + 1s;
+        while (!fn()) {
+            if (MonoClock::now() > end) {
+                return false;
+            }
+            reactor.poll(CyclTime::now(), 10ms);
+        }
+        return true;
+    }
+    const string path{"/tmp/tb-resp-clnt-"s + to_string(getpid()) + ".sock"};
+    const StreamEndpoint ep{parse_stream_endpoint("unix://" + path)};
+    Reactor reactor{1024};
+};
+
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(RespClntSuite, Fixture)
+
+BOOST_AUTO_TEST_CASE(RespClntPipelineCase)
+{
+    const auto now = CyclTime::now();
+    TestServ serv{reactor, ep};
+    RespClnt clnt{now, reactor, ep};
+    Handler h;
+    BOOST_TEST(poll_until([&clnt]() { return clnt.is_connected(); }));
+
+    // Commands issued within the same cycle are written together.
+    clnt.send(now, bind<&Handler::on_reply>(&h), "PING");
+    for (int i{0}; i < 10; ++i) {
+        clnt.send(now, bind<&Handler::on_reply>(&h), "ECHO", i);
+    }
+    const string_view args[] = {"FOO", "bar"};
+    clnt.send(now, args, bind<&Handler::on_reply>(&h));
+    BOOST_TEST(clnt.pending() == 12U);
+    BOOST_TEST(poll_until([&h]() { return h.results.size() == 12; }));
+    BOOST_TEST(serv.reads() == 1);
+    BOOST_TEST(clnt.pending() == 0U);
+
+    BOOST_TEST(!h.results[0].ec);
+    BOOST_TEST(h.results[0].str == "PONG");
+    for (int i{0}; i < 10; ++i) {
+        BOOST_TEST(!h.results[i + 1].ec);
+        BOOST_TEST(h.results[i + 1].str == to_string(i));
+    }
+    // Error replies are not failures.
+    BOOST_TEST(!h.results[11].ec);
+    BOOST_TEST(h.replies[11].is_error());
+    BOOST_TEST(h.results[11].str == "ERR unknown command");
+}
+
+BOOST_AUTO_TEST_CASE(RespClntNestedCase)
+{
+    const auto now = CyclTime::now();
+    TestServ serv{reactor, ep};
+    RespClnt clnt{now, reactor, ep};
+    Handler h;
+
+    // Push messages and attributes are skipped.
+    clnt.send(now, bind<&Handler::on_reply>(&h), "NESTED");
+    clnt.send(now, bind<&Handler::on_reply>(&h), "PING");
+    BOOST_TEST(poll_until([&h]() { return h.results.size() == 2; }));
+    const auto& reply = h.replies[0];
+    BOOST_TEST(reply.size() == 4U);
+    BOOST_TEST((reply.type() == Type::Array));
+    BOOST_TEST(reply.integer() == 2);
+    BOOST_TEST((reply[1].type == Type::Integer));
+    BOOST_TEST(reply[1].integer == 1);
+    BOOST_TEST((reply[2].type == Type::Array));
+    BOOST_TEST(reply[2].integer == 1);
+    BOOST_TEST((reply[3].type == Type::BulkString));
+    BOOST_TEST(reply[3].str == "x");
+    BOOST_TEST(h.results[1].str == "PONG");
+}
+
+BOOST_AUTO_TEST_CASE(RespClntTimeoutCase)
+{
+    const auto now = CyclTime::now();
+    TestServ serv{reactor, ep};
+    RespClnt clnt{now, reactor, ep, {.timeout = 50ms}};
+    Handler h;
+
+    clnt.send(now, bind<&Handler::on_reply>(&h), "SLOW");
+    clnt.send(now, bind<&Handler::on_reply>(&h), "PING");
+    BOOST_TEST(poll_until([&h]() { return h.results.size() == 2; }));
+    BOOST_TEST((h.results[0].ec == errc::timed_out));
+    BOOST_TEST((h.results[1].ec == errc::timed_out));
+    BOOST_TEST(h.replies[0].empty());
+
+    // The connection is re-established immediately.
+    clnt.send(CyclTime::now(), bind<&Handler::on_reply>(&h), "PING");
+    BOOST_TEST(poll_until([&h]() { return h.results.size() == 3; }));
+    BOOST_TEST(!h.results[2].ec);
+    BOOST_TEST(h.results[2].str == "PONG");
+}
+
+BOOST_AUTO_TEST_CASE(RespClntReconnectCase)
+{
+    const auto now = CyclTime::now();
+    RespClnt clnt{now, reactor, ep, {.timeout = 500ms, .reconnect_interval = 10ms}};
+    Handler h;
+
+    // Commands are held until the server is available.
+    clnt.send(now, bind<&Handler::on_reply>(&h), "PING");
+    reactor.poll(CyclTime::now(), 20ms);
+    BOOST_TEST(!clnt.is_connected());
+    BOOST_TEST(h.results.empty());
+
+    TestServ serv{reactor, ep};
+    BOOST_TEST(poll_until([&h]() { return h.results.size() == 1; }));
+    BOOST_TEST(!h.results[0].ec);
+    BOOST_TEST(h.results[0].str == "PONG");
+
+    // Outstanding commands fail when the connection is lost.
+    clnt.send(CyclTime::now(), bind<&Handler::on_reply>(&h), "CLOSE");
+    BOOST_TEST(poll_until([&h]() { return h.results.size() == 2; }));
+    BOOST_TEST(h.results[1].ec);
+
+    clnt.send(CyclTime::now(), bind<&Handler::on_reply>(&h), "PING");
+    BOOST_TEST(poll_until([&h]() { return h.results.size() == 3; }));
+    BOOST_TEST(!h.results[2].ec);
+    BOOST_TEST(h.results[2].str == "PONG");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
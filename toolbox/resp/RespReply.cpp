@@ -0,0 +1,32 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "RespReply.hpp"
+
+namespace toolbox {
+inline namespace resp {
+
+RespReply::~RespReply() = default;
+
+// Copy.
+RespReply::RespReply(const RespReply&) = default;
+RespReply& RespReply::operator=(const RespReply&) = default;
+
+// Move.
+RespReply::RespReply(RespReply&&) noexcept = default;
+RespReply& RespReply::operator=(RespReply&&) noexcept = default;
+
+} // namespace resp
+} // namespace toolbox
@@ -0,0 +1,94 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_RESP_RESPREPLY_HPP
+#define TOOLBOX_RESP_RESPREPLY_HPP
+
+#include <toolbox/resp/Parser.hpp>
+
+#include <vector>
+
+namespace toolbox {
+inline namespace resp {
+
+/// RespValue is a single value in a reply.
+struct RespValue {
+    Type type{Type::None};
+    /// The integer value, the boolean value, or the number of entries in an aggregate, which for
+    /// maps is the number of key/value pairs.
+    std::int64_t integer{0};
+    double real{0};
+    /// The string value, the error message, or the digits of a big number.
+    std::string_view str;
+};
+
+/// RespReply is a complete reply, which is stored as a flat sequence of values. The first value
+/// is the reply itself, and the elements of each aggregate follow the aggregate in order.
+/// Simple and bulk strings are both reported as Type::BulkString. The reply owns its strings, and
+/// its storage is reused from one reply to the next.
+class TOOLBOX_API RespReply {
+  public:
+    RespReply() = default;
+    ~RespReply();
+
+    // Copy.
+    RespReply(const RespReply&);
+    RespReply& operator=(const RespReply&);
+
+    // Move.
+    RespReply(RespReply&&) noexcept;
+    RespReply& operator=(RespReply&&) noexcept;
+
+    bool empty() const noexcept { return items_.empty(); }
+    std::size_t size() const noexcept { return items_.size(); }
+    RespValue operator[](std::size_t i) const noexcept
+    {
+        const auto& item = items_[i];
+        return {item.type, item.integer, item.real, {arena_.data() + item.pos, item.len}};
+    }
+    Type type() const noexcept { return empty() ? Type::None : items_.front().type; }
+    bool is_error() const noexcept { return type() == Type::Error; }
+    bool is_null() const noexcept { return type() == Type::Null; }
+    /// Convenience accessors for the first value.
+    std::string_view str() const noexcept { return empty() ? std::string_view{} : (*this)[0].str; }
+    std::int64_t integer() const noexcept { return empty() ? 0 : items_.front().integer; }
+
+    void clear() noexcept
+    {
+        items_.clear();
+        arena_.clear();
+    }
+    void push(Type type, std::int64_t integer, double real, std::string_view str)
+    {
+        items_.push_back({type, integer, real, arena_.size(), str.size()});
+        arena_ += str;
+    }
+
+  private:
+    /// Strings are stored as offsets, because the arena may be reallocated as it grows.
+    struct Item {
+        Type type;
+        std::int64_t integer;
+        double real;
+        std::size_t pos, len;
+    };
+    std::vector<Item> items_;
+    std::string arena_;
+};
+
+} // namespace resp
+} // namespace toolbox
+
+#endif // TOOLBOX_RESP_RESPREPLY_HPP
@@ -0,0 +1,98 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Base64.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace toolbox {
+inline namespace util {
+using namespace std;
+namespace {
+
+constexpr char Base64Chars[]
+    = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/// Maps each character to its six-bit value, or to -1 if the character is not in the alphabet.
+constexpr auto make_values() noexcept
+{
+    array<int8_t, 256> t{};
+    t.fill(-1);
+    for (int i{0}; i < 64; ++i) {
+        t[static_cast<unsigned char>(Base64Chars[i])] = static_cast<int8_t>(i);
+    }
+    return t;
+}
+
+constexpr auto Base64Values = make_values();
+
+} // namespace
+
+void base64_encode(string_view data, string& out)
+{
+    const auto* const in = reinterpret_cast<const unsigned char*>(data.data());
+    const auto len = data.size();
+    auto pos = out.size();
+    out.resize(pos + (len + 2) / 3 * 4);
+    size_t i{0};
+    for (; i + 2 < len; i += 3) {
+        const uint32_t n{(uint32_t{in[i]} << 16) | (uint32_t{in[i + 1]} << 8) | in[i + 2]};
+        out[pos++] = Base64Chars[(n >> 18) & 0x3f];
+        out[pos++] = Base64Chars[(n >> 12) & 0x3f];
+        out[pos++] = Base64Chars[(n >> 6) & 0x3f];
+        out[pos++] = Base64Chars[n & 0x3f];
+    }
+    if (i < len) {
+        uint32_t n{uint32_t{in[i]} << 16};
+        if (i + 1 < len) {
+            n |= uint32_t{in[i + 1]} << 8;
+        }
+        out[pos++] = Base64Chars[(n >> 18) & 0x3f];
+        out[pos++] = Base64Chars[(n >> 12) & 0x3f];
+        out[pos++] = i + 1 < len ? Base64Chars[(n >> 6) & 0x3f] : '=';
+        out[pos++] = '=';
+    }
+}
+
+bool base64_decode(string_view in, string& out)
+{
+    while (!in.empty() && in.back() == '=') {
+        in.remove_suffix(1);
+    }
+    // A single character in the final group does not encode a whole byte.
+    if (in.size() % 4 == 1) {
+        return false;
+    }
+    out.reserve(out.size() + in.size() / 4 * 3 + 2);
+    uint32_t n{0};
+    int bits{0};
+    for (const auto c : in) {
+        const auto v = Base64Values[static_cast<unsigned char>(c)];
+        if (v < 0) {
+            return false;
+        }
+        n = (n << 6) | static_cast<uint32_t>(v);
+        bits += 6;
+        if (bits >= 8) {
+            bits -= 8;
+            out += static_cast<char>((n >> bits) & 0xff);
+        }
+    }
+    return true;
+}
+
+} // namespace util
+} // namespace toolbox
@@ -0,0 +1,45 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_UTIL_BASE64_HPP
+#define TOOLBOX_UTIL_BASE64_HPP
+
+#include <toolbox/Config.h>
+
+#include <string>
+#include <string_view>
+
+namespace toolbox {
+inline namespace util {
+
+/// Append the padded base64 encoding of the data, using the standard alphabet from RFC 4648.
+TOOLBOX_API void base64_encode(std::string_view data, std::string& out);
+
+inline std::string base64_encode(std::string_view data)
+{
+    std::string out;
+    base64_encode(data, out);
+    return out;
+}
+
+/// Append the decoded data. Padding is optional, but whitespace is not permitted.
+///
+/// \return false if the input is not valid base64, in which case the output is unspecified.
+TOOLBOX_API bool base64_decode(std::string_view in, std::string& out);
+
+} // namespace util
+} // namespace toolbox
+
+#endif // TOOLBOX_UTIL_BASE64_HPP
@@ -0,0 +1,66 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2022 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Base64.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace toolbox;
+
+BOOST_AUTO_TEST_SUITE(Base64Suite)
+
+BOOST_AUTO_TEST_CASE(Base64EncodeCase)
+{
+    // Test vectors from RFC 4648.
+    BOOST_TEST(base64_encode(""sv) == ""sv);
+    BOOST_TEST(base64_encode("f"sv) == "Zg=="sv);
+    BOOST_TEST(base64_encode("fo"sv) == "Zm8="sv);
+    BOOST_TEST(base64_encode("foo"sv) == "Zm9v"sv);
+    BOOST_TEST(base64_encode("foob"sv) == "Zm9vYg=="sv);
+    BOOST_TEST(base64_encode("fooba"sv) == "Zm9vYmE="sv);
+    BOOST_TEST(base64_encode("foobar"sv) == "Zm9vYmFy"sv);
+
+    string out{"x"};
+    base64_encode("\xff\xfe"sv, out);
+    BOOST_TEST(out == "x//4="sv);
+}
+
+BOOST_AUTO_TEST_CASE(Base64DecodeCase)
+{
+    for (const auto sv : {""sv, "f"sv, "fo"sv, "foo"sv, "foob"sv, "fooba"sv, "foobar"sv}) {
+        string out;
+        BOOST_TEST(base64_decode(base64_encode(sv), out));
+        BOOST_TEST(out == sv);
+    }
+    string all;
+    for (int i{0}; i < 256; ++i) {
+        all += static_cast<char>(i);
+    }
+    string out;
+    BOOST_TEST(base64_decode(base64_encode(all), out));
+    BOOST_TEST(out == all);
+
+    // Padding is optional.
+    out.clear();
+    BOOST_TEST(base64_decode("Zm9vYg"sv, out));
+    BOOST_TEST(out == "foob"sv);
+
+    BOOST_TEST(!base64_decode("Zm9v!"sv, out));
+    BOOST_TEST(!base64_decode("Zm9vY"sv, out));
+    BOOST_TEST(!base64_decode("Zm 9v"sv, out));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
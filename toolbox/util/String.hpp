@@ -131,6 +131,38 @@ inline std::string trim_copy(std::string s) noexcept
     return s;
 }
 
+/// Returns the ASCII lower-case form of a character.
+constexpr char to_lower(char c) noexcept
+{
+    return c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c;
+}
+
+/// Returns true if the strings are equal, ignoring ASCII case.
+constexpr bool iequals(std::string_view lhs, std::string_view rhs) noexcept
+{
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+    for (std::size_t i{0}; i < lhs.size(); ++i) {
+        if (to_lower(lhs[i]) != to_lower(rhs[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Returns the string without leading or trailing optional whitespace, i.e. spaces and tabs.
+constexpr std::string_view trim_ows(std::string_view sv) noexcept
+{
+    while (!sv.empty() && (sv.front() == ' ' || sv.front() == '\t')) {
+        sv.remove_prefix(1);
+    }
+    while (!sv.empty() && (sv.back() == ' ' || sv.back() == '\t')) {
+        sv.remove_suffix(1);
+    }
+    return sv;
+}
+
 TOOLBOX_API std::pair<std::string_view, std::string_view> split_pair(std::string_view s,
                                                                      char delim) noexcept;
 
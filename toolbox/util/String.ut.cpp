@@ -94,6 +94,24 @@ BOOST_AUTO_TEST_CASE(TrimCopyCase)
     BOOST_TEST(trim_copy("foo"s) == "foo"s);
 }
 
+BOOST_AUTO_TEST_CASE(IequalsCase)
+{
+    BOOST_TEST(iequals("Keep-Alive"sv, "keep-alive"sv));
+    BOOST_TEST(!iequals("keep-alive"sv, "keep-alivE "sv));
+    // Only ASCII letters are folded.
+    BOOST_TEST(!iequals("@"sv, "`"sv));
+    BOOST_TEST(to_lower('Z') == 'z');
+    BOOST_TEST(to_lower('[') == '[');
+}
+
+BOOST_AUTO_TEST_CASE(TrimOwsCase)
+{
+    BOOST_TEST(trim_ows(" \tgzip \t"sv) == "gzip"sv);
+    BOOST_TEST(trim_ows(" \t"sv).empty());
+    // Only spaces and tabs are optional whitespace.
+    BOOST_TEST(trim_ows("\ngzip\r"sv) == "\ngzip\r"sv);
+}
+
 BOOST_AUTO_TEST_CASE(SplitPairCase)
 {
     BOOST_TEST(split_pair(""sv, '=') == make_pair(""sv, ""sv));